@@ -22,6 +22,9 @@ namespace engine
 			StringHash hash() const;
 
 			const std::string& get_name() const;
+
+			// NOTE: Changes made in-place are not observed by `NameIndex`; prefer `Service::set_name`, or patch this component.
+			// (Cached entity targets discard entities renamed in-place; see `EntityTargetCache`)
 			void set_name(const std::string& name);
 
 			inline std::size_t size() const
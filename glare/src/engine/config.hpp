@@ -48,6 +48,12 @@ namespace engine
 	struct EntityConfig
 	{
 		std::string archetype_path = "engine/archetypes"; // std::filesystem::path
+
+		// The directory cooked archetypes are stored in. If empty, a per-user cache directory is used.
+		std::string archetype_cache_path; // std::filesystem::path
+
+		// Controls whether cooked archetypes are read and written.
+		bool use_archetype_cache = true;
 	};
 
 	struct Config
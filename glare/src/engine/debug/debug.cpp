@@ -170,6 +170,7 @@ namespace engine
 		//enable<OnThreadPaused>();
 		//enable<OnThreadResumed>();
 		enable<OnThreadVariableUpdate>();
+		enable<OnThreadBudgetExceeded>();
 	}
 
 	void DebugListener::on_skeleton(Registry& registry, Entity entity)
@@ -387,4 +388,9 @@ namespace engine
 	{
 		print("Entity #{}: Thread {} (#{} - Index: {}) Variable Updated (ID: #{})", thread_details.entity, get_known_string_from_hash(thread_details.thread_id), thread_details.thread_id, thread_details.thread_index, thread_details.resolved_variable_name);
 	}
+
+	void DebugListener::operator()(const OnThreadBudgetExceeded& thread_details)
+	{
+		print_warn("Entity #{}: Thread {} (#{}) Exceeded Realtime Budget - Index: {}, Instruction: {}", thread_details.entity, get_known_string_from_hash(thread_details.thread_id), thread_details.thread_id, thread_details.thread_index, thread_details.last_instruction_index);
+	}
 }
\ No newline at end of file
@@ -57,6 +57,7 @@ namespace engine
 	struct OnThreadPaused;
 	struct OnThreadResumed;
 	struct OnThreadVariableUpdate;
+	struct OnThreadBudgetExceeded;
 
 	// Commands:
 	struct PrintCommand;
@@ -113,6 +114,7 @@ namespace engine
 			void operator()(const OnThreadPaused& thread_details);
 			void operator()(const OnThreadResumed& thread_details);
 			void operator()(const OnThreadVariableUpdate& thread_details);
+			void operator()(const OnThreadBudgetExceeded& thread_details);
 
 			// Commands:
 			void operator()(const PrintCommand& data);
@@ -0,0 +1,343 @@
+#include "archetype_cache.hpp"
+
+#include <engine/meta/hash.hpp>
+#include <engine/meta/serial.hpp>
+
+#include <util/binary/binary_file_stream.hpp>
+#include <util/io.hpp>
+#include <util/log.hpp>
+#include <util/format.hpp>
+
+#include <fstream>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <system_error>
+#include <stdexcept>
+#include <cstdlib>
+
+namespace engine
+{
+	using ArchetypeCachePayload = std::vector<std::uint8_t>;
+
+	static ArchetypeCacheHeader::Hash hash_archetype_source(const std::string& source_text)
+	{
+		return hash(std::string_view { source_text }, false).value();
+	}
+
+	static util::json parse_archetype_source(const std::string& source_text)
+	{
+		// NOTE: Matches the parsing options used by `util::load_json`.
+		return util::json::parse(source_text, nullptr, true, true);
+	}
+
+	// Guards `archetype_cache_directory`, since factories may be built concurrently.
+	static std::mutex archetype_cache_directory_mutex;
+
+	static std::filesystem::path archetype_cache_directory = default_archetype_cache_directory();
+
+	// ArchetypeCacheHeader:
+	std::string ArchetypeCacheHeader::normalize_source_path(const std::filesystem::path& source_path)
+	{
+		auto ec = std::error_code {};
+
+		auto absolute_path = std::filesystem::absolute(source_path, ec);
+
+		if (ec)
+		{
+			absolute_path = source_path;
+		}
+
+		return absolute_path.lexically_normal().generic_string();
+	}
+
+	std::optional<ArchetypeCacheHeader> ArchetypeCacheHeader::from_source_file(const std::filesystem::path& source_path)
+	{
+		auto ec = std::error_code {};
+
+		const auto source_size = std::filesystem::file_size(source_path, ec);
+
+		if (ec)
+		{
+			return std::nullopt;
+		}
+
+		const auto source_timestamp = std::filesystem::last_write_time(source_path, ec);
+
+		if (ec)
+		{
+			return std::nullopt;
+		}
+
+		return ArchetypeCacheHeader
+		{
+			.source_path      = normalize_source_path(source_path),
+			.source_size      = static_cast<Size>(source_size),
+			.source_timestamp = static_cast<Timestamp>(source_timestamp.time_since_epoch().count())
+		};
+	}
+
+	std::filesystem::path default_archetype_cache_directory()
+	{
+		auto cache_root = std::filesystem::path {};
+
+#ifdef _WIN32
+		if (const auto local_app_data = std::getenv("LOCALAPPDATA"); ((local_app_data) && (*local_app_data)))
+		{
+			cache_root = local_app_data;
+		}
+#else
+		if (const auto xdg_cache_home = std::getenv("XDG_CACHE_HOME"); ((xdg_cache_home) && (*xdg_cache_home)))
+		{
+			cache_root = xdg_cache_home;
+		}
+		else if (const auto home = std::getenv("HOME"); ((home) && (*home)))
+		{
+			cache_root = (std::filesystem::path { home } / ".cache");
+		}
+#endif // _WIN32
+
+		if (cache_root.empty())
+		{
+			auto ec = std::error_code {};
+
+			cache_root = std::filesystem::temp_directory_path(ec);
+
+			if (ec)
+			{
+				// No suitable location; caching is disabled.
+				return {};
+			}
+		}
+
+		return (cache_root / "glare" / "archetypes");
+	}
+
+	std::filesystem::path get_archetype_cache_directory()
+	{
+		auto lock = std::scoped_lock { archetype_cache_directory_mutex };
+
+		return archetype_cache_directory;
+	}
+
+	void set_archetype_cache_directory(const std::filesystem::path& cache_directory)
+	{
+		auto lock = std::scoped_lock { archetype_cache_directory_mutex };
+
+		archetype_cache_directory = cache_directory;
+	}
+
+	std::filesystem::path get_archetype_cache_path(const std::filesystem::path& archetype_path, const std::filesystem::path& cache_directory)
+	{
+		const auto normalized_path = ArchetypeCacheHeader::normalize_source_path(archetype_path);
+
+		const auto path_hash = hash(std::string_view { normalized_path }, false).value();
+
+		// NOTE: The source's filename is included to keep the cache directory readable.
+		return (cache_directory / util::format("{}.{:08x}.bin", archetype_path.stem().string(), path_hash));
+	}
+
+	std::optional<util::json> load_archetype_cache(const std::filesystem::path& cache_path, ArchetypeCacheHeader* header_out)
+	{
+		auto file_stream = std::ifstream { cache_path, (std::ios::in | std::ios::binary) };
+
+		if (!file_stream)
+		{
+			return std::nullopt;
+		}
+
+		try
+		{
+			auto data_in = util::BinaryInputFileStream { file_stream };
+
+			const auto binary_format = impl::read_binary_format(data_in, { ArchetypeCacheHeader::format_version });
+
+			if (!binary_format)
+			{
+				return std::nullopt;
+			}
+
+			if (data_in.read<ArchetypeCacheHeader::Magic>() != ArchetypeCacheHeader::magic)
+			{
+				return std::nullopt;
+			}
+
+			auto header = ArchetypeCacheHeader {};
+
+			data_in >> header.source_path;
+			data_in >> header.source_size;
+			data_in >> header.source_timestamp;
+			data_in >> header.source_hash;
+
+			if (header_out)
+			{
+				*header_out = header;
+			}
+
+			const auto payload_size = data_in.read<ArchetypeCacheHeader::Size>();
+
+			auto payload = ArchetypeCachePayload(static_cast<std::size_t>(payload_size));
+
+			if (!file_stream.read(reinterpret_cast<char*>(payload.data()), static_cast<std::streamsize>(payload.size())))
+			{
+				return std::nullopt;
+			}
+
+			return util::json::from_cbor(payload);
+		}
+		catch (const std::exception& e)
+		{
+			print_warn("Failed to load cooked archetype ({}): {}", cache_path.string(), e.what());
+		}
+
+		return std::nullopt;
+	}
+
+	bool save_archetype_cache(const std::filesystem::path& cache_path, const util::json& instance, const ArchetypeCacheHeader& header, const BinaryFormatConfig& binary_format)
+	{
+		auto ec = std::error_code {};
+
+		if (const auto cache_directory = cache_path.parent_path(); !cache_directory.empty())
+		{
+			std::filesystem::create_directories(cache_directory, ec);
+
+			if (ec)
+			{
+				return false;
+			}
+		}
+
+		// NOTE: The thread ID is included to avoid collisions between threads cooking the same archetype.
+		auto temporary_path = cache_path;
+
+		temporary_path += util::format(".{}.tmp", std::hash<std::thread::id> {}(std::this_thread::get_id()));
+
+		try
+		{
+			const auto payload = util::json::to_cbor(instance);
+
+			{
+				auto file_stream = std::ofstream { temporary_path, (std::ios::out | std::ios::binary | std::ios::trunc) };
+
+				if (!file_stream)
+				{
+					return false;
+				}
+
+				auto data_out = util::BinaryOutputFileStream { file_stream };
+
+				auto format_used = binary_format;
+
+				format_used.format_version = ArchetypeCacheHeader::format_version;
+
+				// NOTE: Network byte-order is always used for the standard header segment. (See `impl::read_binary_format`)
+				data_out.set_network_byte_order(true);
+
+				data_out << format_used.format_version;
+				data_out << format_used.format;
+				data_out << format_used.string_format;
+
+				data_out.set_network_byte_order(format_used.big_endian());
+
+				data_out << ArchetypeCacheHeader::magic;
+
+				data_out << header.source_path;
+				data_out << header.source_size;
+				data_out << header.source_timestamp;
+				data_out << header.source_hash;
+
+				data_out << static_cast<ArchetypeCacheHeader::Size>(payload.size());
+
+				file_stream.write(reinterpret_cast<const char*>(payload.data()), static_cast<std::streamsize>(payload.size()));
+
+				if (!file_stream)
+				{
+					return false;
+				}
+			}
+
+			std::filesystem::rename(temporary_path, cache_path, ec);
+
+			if (!ec)
+			{
+				return true;
+			}
+		}
+		catch (const std::exception& e)
+		{
+			print_warn("Failed to save cooked archetype ({}): {}", cache_path.string(), e.what());
+		}
+
+		std::filesystem::remove(temporary_path, ec);
+
+		return false;
+	}
+
+	util::json load_archetype_document(const std::filesystem::path& archetype_path, const std::filesystem::path& cache_directory)
+	{
+		if (cache_directory.empty())
+		{
+			return util::load_json(archetype_path);
+		}
+
+		auto source_header = ArchetypeCacheHeader::from_source_file(archetype_path);
+
+		if (!source_header)
+		{
+			// Unable to inspect the source document; defer to the standard implementation for error reporting.
+			return util::load_json(archetype_path);
+		}
+
+		const auto cache_path = get_archetype_cache_path(archetype_path, cache_directory);
+
+		auto cached_header = ArchetypeCacheHeader {};
+		auto cached_instance = load_archetype_cache(cache_path, &cached_header);
+
+		if ((cached_instance) && (!cached_header.same_source(*source_header)))
+		{
+			// A different source document maps to the same location; the cooked archetype is replaced below.
+			cached_instance = std::nullopt;
+		}
+
+		if ((cached_instance) && (cached_header.same_revision(*source_header)))
+		{
+			return std::move(*cached_instance);
+		}
+
+		const auto source_text = util::load_string(archetype_path);
+
+		source_header->source_hash = hash_archetype_source(source_text);
+
+		if ((cached_instance) && (cached_header.same_contents(*source_header)))
+		{
+			// The source was touched, but its contents are unchanged; refresh the cached timestamp.
+			save_archetype_cache(cache_path, *cached_instance, *source_header);
+
+			return std::move(*cached_instance);
+		}
+
+		auto instance = util::json {};
+
+		try
+		{
+			instance = parse_archetype_source(source_text);
+		}
+		catch (const std::exception& e)
+		{
+			print("JSON Error: {}", e.what());
+
+			throw;
+		}
+
+		save_archetype_cache(cache_path, instance, *source_header);
+
+		return instance;
+	}
+
+	util::json load_archetype_document(const std::filesystem::path& archetype_path)
+	{
+		return load_archetype_document(archetype_path, get_archetype_cache_directory());
+	}
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <engine/meta/types.hpp>
+#include <engine/meta/binary_format_config.hpp>
+
+#include <util/json.hpp>
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <cstdint>
+
+namespace engine
+{
+	// Describes the source document a cooked archetype was produced from.
+	//
+	// A cooked archetype is only considered valid if this header matches its source.
+	struct ArchetypeCacheHeader
+	{
+		using Magic     = std::uint32_t;
+		using Size      = std::uint64_t;
+		using Timestamp = std::int64_t;
+		using Hash      = StringHash;
+
+		// Identifies a cooked archetype file. ('GLAR')
+		inline static constexpr Magic magic = 0x474C4152;
+
+		// Incremented whenever the layout of a cooked archetype changes.
+		inline static constexpr BinaryFormatConfig::FormatVersion format_version = 2;
+
+		// The normalized, absolute path of the source document. (See `normalize_source_path`)
+		std::string source_path;
+
+		// The size of the source document, in bytes.
+		Size source_size = {};
+
+		// The last write time of the source document.
+		Timestamp source_timestamp = {};
+
+		// A hash of the source document's contents.
+		Hash source_hash = {};
+
+		// Computes the form of `source_path` stored in a header. (Absolute, lexically normal, forward slashes)
+		static std::string normalize_source_path(const std::filesystem::path& source_path);
+
+		// Retrieves the path, size and timestamp of `source_path`, without reading its contents.
+		static std::optional<ArchetypeCacheHeader> from_source_file(const std::filesystem::path& source_path);
+
+		// Returns true if `header` was produced from the same source document as this header.
+		inline bool same_source(const ArchetypeCacheHeader& header) const
+		{
+			return (source_path == header.source_path);
+		}
+
+		// Returns true if `header` describes the same file revision as this header.
+		inline bool same_revision(const ArchetypeCacheHeader& header) const
+		{
+			return ((same_source(header)) && (source_size == header.source_size) && (source_timestamp == header.source_timestamp));
+		}
+
+		// Returns true if `header` describes the same file contents as this header.
+		inline bool same_contents(const ArchetypeCacheHeader& header) const
+		{
+			return ((same_source(header)) && (source_size == header.source_size) && (source_hash == header.source_hash));
+		}
+	};
+
+	// Computes the default directory used to store cooked archetypes.
+	//
+	// This is a `glare/archetypes` directory inside of the user's cache location. (`XDG_CACHE_HOME`, `~/.cache` or `LOCALAPPDATA`)
+	// If no such location exists, the system's temporary directory is used instead.
+	std::filesystem::path default_archetype_cache_directory();
+
+	// Retrieves the directory cooked archetypes are currently stored in. An empty path indicates that caching is disabled.
+	std::filesystem::path get_archetype_cache_directory();
+
+	// Changes the directory cooked archetypes are stored in. Specifying an empty path disables caching.
+	//
+	// NOTE: This affects every subsequent call to `load_archetype_document` that does not specify a directory.
+	void set_archetype_cache_directory(const std::filesystem::path& cache_directory);
+
+	// Computes the location of the cooked archetype for `archetype_path`, inside of `cache_directory`.
+	//
+	// NOTE: Distinct sources may map to the same location; the header of a cooked archetype identifies its source. (See `ArchetypeCacheHeader::same_source`)
+	std::filesystem::path get_archetype_cache_path(const std::filesystem::path& archetype_path, const std::filesystem::path& cache_directory);
+
+	// Attempts to read a cooked archetype from `cache_path`.
+	//
+	// If `header_out` is specified, it receives the header of the cooked archetype, regardless of whether the document could be read.
+	std::optional<util::json> load_archetype_cache(const std::filesystem::path& cache_path, ArchetypeCacheHeader* header_out=nullptr);
+
+	// Writes `instance` to `cache_path` as a cooked archetype, described by `header`.
+	//
+	// The output is written to a temporary file first, then moved into place; concurrent writers are safe.
+	bool save_archetype_cache(const std::filesystem::path& cache_path, const util::json& instance, const ArchetypeCacheHeader& header, const BinaryFormatConfig& binary_format={});
+
+	// Loads the archetype document located at `archetype_path`.
+	//
+	// If an up-to-date cooked archetype exists in `cache_directory`, the document is read from it directly, skipping text parsing.
+	// Otherwise, the source document is parsed as usual and a new cooked archetype is written. (If `cache_directory` is not empty)
+	//
+	// Cooked archetypes are validated against the path, size and timestamp of the source document.
+	// If the size or timestamp differ, the contents of the source are hashed, allowing the cooked archetype to be reused when only the timestamp has changed.
+	util::json load_archetype_document(const std::filesystem::path& archetype_path, const std::filesystem::path& cache_directory);
+
+	// Loads the archetype document located at `archetype_path`, using the current cache directory. (See `get_archetype_cache_directory`)
+	util::json load_archetype_document(const std::filesystem::path& archetype_path);
+}
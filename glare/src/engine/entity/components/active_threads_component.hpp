@@ -0,0 +1,22 @@
+#pragma once
+
+#include <engine/types.hpp>
+#include <engine/registry.hpp>
+
+namespace engine
+{
+	// Marks an entity whose threads need to be progressed by `EntitySystem`.
+	//
+	// Entities whose threads are all suspended (e.g. paused, yielding or complete) have this component removed,
+	// meaning they are skipped entirely until woken. (See `wake_entity_threads`)
+	struct ActiveThreadsComponent {};
+
+	// Signals that the threads of `entity` may be able to continue execution.
+	//
+	// This should be called after resuming, unyielding or starting a thread
+	// without going through a thread command or patching `EntityThreadComponent`.
+	inline void wake_entity_threads(Registry& registry, Entity entity)
+	{
+		registry.emplace_or_replace<ActiveThreadsComponent>(entity);
+	}
+}
@@ -22,6 +22,16 @@ namespace engine
 		return global_variables.get();
 	}
 
+	EntityThreadComponent::ThreadGlobalVariables* EntityThreadComponent::get_global_variables(const MetaVariableLayout& layout)
+	{
+		if (!global_variables)
+		{
+			global_variables = std::make_shared<ThreadGlobalVariables>(layout);
+		}
+
+		return global_variables.get();
+	}
+
 	// NOTE: The `thread_id` argument is currently unused,
 	// since thread names/IDs normally correspond to `EntityDescriptor` entries.
 	EntityThread* EntityThreadComponent::start_thread
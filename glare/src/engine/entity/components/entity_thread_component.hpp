@@ -53,6 +53,10 @@ namespace engine
 			// The value returned is a non-owning pointer to the remote object. (see `global_variables`)
 			ThreadGlobalVariables* get_global_variables(); // const
 
+			// Equivalent to `get_global_variables`, but reserves a slot for each name in `layout` when allocating.
+			// (See `EntityDescriptor::global_variables`)
+			ThreadGlobalVariables* get_global_variables(const MetaVariableLayout& layout);
+
 			EntityThread* start_thread
 			(
 				ScriptFiber&& fiber,
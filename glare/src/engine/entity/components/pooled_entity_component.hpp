@@ -0,0 +1,30 @@
+#pragma once
+
+#include <engine/types.hpp>
+#include <engine/entity/types.hpp>
+#include <engine/components/name_component.hpp>
+
+#include <optional>
+
+namespace engine
+{
+	// Attached to inactive instances held by an `EntityPool`.
+	//
+	// Systems that progress instances in the world (e.g. motion and animation) exclude entities with this component.
+	struct PooledEntityComponent
+	{
+		// The state of the instance prior to deactivation.
+		//
+		// NOTE: `StateComponent` is removed while inactive, ensuring that state rules no longer apply.
+		std::optional<EntityStateIndex> state_index = std::nullopt;
+
+		// The name of the instance prior to deactivation.
+		//
+		// NOTE: `NameComponent` is removed while inactive, ensuring that
+		// the instance can't be found by name. (See `NameIndex`)
+		std::optional<NameComponent> name = std::nullopt;
+
+		// Visibility of the instance's model prior to deactivation.
+		bool model_visible : 1 = true;
+	};
+}
@@ -3,6 +3,10 @@
 
 #include <engine/meta/hash.hpp>
 
+#include <unordered_map>
+#include <algorithm>
+#include <variant>
+
 namespace engine
 {
 	EntityDescriptor::EntityDescriptor(std::string_view path)
@@ -117,6 +121,239 @@ namespace engine
 		return std::nullopt;
 	}
 
+	std::size_t EntityDescriptor::compile_variables()
+	{
+		using namespace engine::instructions;
+
+		using SlotMap = std::unordered_map<MetaSymbolID, MetaVariableSlot>;
+
+		auto& threads = shared_storage.get_storage<EntityThreadDescription>();
+
+		const auto thread_count = get_next_thread_index();
+
+		// NOTE: Local variable names are prefixed with the path of their thread,
+		// so a single map is enough to resolve the slots of every thread's local variables.
+		auto local_slots = SlotMap {};
+		auto global_slots = SlotMap {};
+
+		auto add_to_layout = [](MetaVariableLayout& layout, SlotMap& slots, MetaSymbolID name)
+		{
+			if (!name)
+			{
+				return;
+			}
+
+			if (std::find(layout.begin(), layout.end(), name) != layout.end())
+			{
+				return;
+			}
+
+			if (layout.size() >= static_cast<std::size_t>(META_VARIABLE_SLOT_INVALID))
+			{
+				return;
+			}
+
+			const auto slot = static_cast<MetaVariableSlot>(layout.size());
+
+			layout.emplace_back(name);
+
+			// Names found at different slots (i.e. in multiple threads) are left unresolved.
+			if (auto [it, inserted] = slots.try_emplace(name, slot); ((!inserted) && (it->second != slot)))
+			{
+				it->second = META_VARIABLE_SLOT_INVALID;
+			}
+		};
+
+		global_variables.clear();
+
+		for (EntityThreadIndex thread_index = 0; thread_index < thread_count; thread_index++)
+		{
+			auto& thread = threads.get(thread_index);
+
+			thread.local_variables.clear();
+
+			for (const auto& instruction : thread.instructions)
+			{
+				if (const auto declaration = std::get_if<VariableDeclaration>(&instruction.value))
+				{
+					const auto& variable = declaration->variable_details;
+
+					switch (variable.scope)
+					{
+						case MetaVariableScope::Local:
+							add_to_layout(thread.local_variables, local_slots, variable.name);
+
+							break;
+						case MetaVariableScope::Global:
+							add_to_layout(global_variables, global_slots, variable.name);
+
+							break;
+
+						default:
+							// Context and universal variables are shared between entities, and are resolved by name.
+							break;
+					}
+				}
+			}
+		}
+
+		std::size_t targets_resolved = 0;
+
+		auto resolve_slot = [&local_slots, &global_slots, &targets_resolved](MetaVariableTarget& variable)
+		{
+			const SlotMap* slots = nullptr;
+
+			switch (variable.scope)
+			{
+				case MetaVariableScope::Local:
+					slots = &local_slots;
+
+					break;
+				case MetaVariableScope::Global:
+					slots = &global_slots;
+
+					break;
+
+				default:
+					return;
+			}
+
+			const auto it = slots->find(variable.name);
+
+			variable.slot = (it != slots->end())
+				? it->second
+				: META_VARIABLE_SLOT_INVALID
+			;
+
+			if (variable.slot != META_VARIABLE_SLOT_INVALID)
+			{
+				targets_resolved++;
+			}
+		};
+
+		auto resolve_slot_of_value = [&resolve_slot](MetaAny& value)
+		{
+			if (auto variable = value.try_cast<MetaVariableTarget>())
+			{
+				resolve_slot(*variable);
+			}
+		};
+
+		for (EntityThreadIndex thread_index = 0; thread_index < thread_count; thread_index++)
+		{
+			for (auto& instruction : threads.get(thread_index).instructions)
+			{
+				if (auto declaration = std::get_if<VariableDeclaration>(&instruction.value))
+				{
+					resolve_slot(declaration->variable_details);
+				}
+				else if (auto assignment = std::get_if<VariableAssignment>(&instruction.value))
+				{
+					// NOTE: Assignments targeting other entities are resolved by name.
+					if ((assignment->variable_details) && (assignment->target_entity.is_self_targeted()))
+					{
+						resolve_slot(*assignment->variable_details);
+					}
+				}
+				else if (auto capture = std::get_if<EventCapture>(&instruction.value))
+				{
+					resolve_slot(capture->variable_details);
+				}
+			}
+		}
+
+		auto& operations = shared_storage.get_storage<MetaValueOperation>();
+
+		for (SharedStorageIndex operation_index = 0; operation_index < operations.get_next_index(); operation_index++)
+		{
+			for (auto& segment : operations.get(operation_index).segments)
+			{
+				resolve_slot_of_value(segment.value);
+			}
+		}
+
+		auto& function_calls = shared_storage.get_storage<MetaFunctionCall>();
+
+		for (SharedStorageIndex call_index = 0; call_index < function_calls.get_next_index(); call_index++)
+		{
+			auto& function_call = function_calls.get(call_index);
+
+			for (auto& argument : function_call.arguments)
+			{
+				resolve_slot_of_value(argument);
+			}
+
+			resolve_slot_of_value(function_call.self);
+		}
+
+		auto& remote_variables = shared_storage.get_storage<IndirectMetaVariableTarget>();
+
+		for (SharedStorageIndex variable_index = 0; variable_index < remote_variables.get_next_index(); variable_index++)
+		{
+			auto& remote_variable = remote_variables.get(variable_index);
+
+			// NOTE: Variables of other entities may use a different layout, and are therefore resolved by name.
+			if (remote_variable.target.is_self_targeted())
+			{
+				resolve_slot(remote_variable.variable);
+			}
+		}
+
+		return targets_resolved;
+	}
+
+	std::size_t EntityDescriptor::compile_threads()
+	{
+		auto& threads = shared_storage.get_storage<EntityThreadDescription>();
+
+		const auto thread_count = get_next_thread_index();
+
+		for (EntityThreadIndex thread_index = 0; thread_index < thread_count; thread_index++)
+		{
+			threads.get(thread_index).compile();
+		}
+
+		return static_cast<std::size_t>(thread_count);
+	}
+
+	std::size_t EntityDescriptor::compile_conditions()
+	{
+		auto& conditions = shared_storage.get_storage<EventTriggerCondition>();
+
+		const auto condition_count = conditions.get_next_index();
+
+		std::size_t predicates_compiled = 0;
+
+		for (SharedStorageIndex condition_index = 0; condition_index < condition_count; condition_index++)
+		{
+			if (conditions.get(condition_index).compile(*this, condition_index))
+			{
+				predicates_compiled++;
+			}
+		}
+
+		return predicates_compiled;
+	}
+
+	std::size_t EntityDescriptor::compile_operations()
+	{
+		auto& operations = shared_storage.get_storage<MetaValueOperation>();
+
+		const auto operation_count = operations.get_next_index();
+
+		std::size_t programs_compiled = 0;
+
+		for (SharedStorageIndex operation_index = 0; operation_index < operation_count; operation_index++)
+		{
+			if (operations.get(operation_index).compile(&shared_storage))
+			{
+				programs_compiled++;
+			}
+		}
+
+		return programs_compiled;
+	}
+
 	EntityThreadID EntityDescriptor::get_thread_id(EntityThreadIndex thread_index) const
 	{
 		const auto& thread = get_thread(thread_index);
@@ -7,6 +7,7 @@
 #include "entity_thread_range.hpp"
 #include "entity_shared_storage.hpp"
 #include "meta_description.hpp"
+#include "entity_pool_config.hpp"
 
 #include <engine/meta/meta_type_descriptor.hpp>
 
@@ -83,6 +84,13 @@ namespace engine
 
 			SharedStorage shared_storage;
 
+			// The slot layout of the global variables declared by this descriptor's threads.
+			// (See `compile_variables`)
+			MetaVariableLayout global_variables;
+
+			// Controls whether instances of this descriptor are recycled. (Disabled by default)
+			EntityPoolConfig pool;
+
 			// TODO: Optimize/better integrate with `SharedStorage`.
 			template <typename ResourceType, typename ...Args>
 			EntityDescriptorShared<ResourceType> allocate(Args&&... args)
@@ -159,6 +167,29 @@ namespace engine
 
 			EntityThreadID get_thread_id(EntityThreadIndex thread_index) const;
 
+			// Assigns a fixed slot to each local and global variable declared by this descriptor's threads,
+			// then updates every variable reference found in this descriptor to use these slots. (See `MetaVariableTarget::slot`)
+			// 
+			// NOTE: This should be called before `compile_conditions` and `compile_operations`, since those may copy variable references.
+			// 
+			// The return-value of this function is the number of variable references updated.
+			std::size_t compile_variables();
+
+			// Compiles the bytecode of every thread in this descriptor. (See `EntityThreadDescription::compile`)
+			// 
+			// The return-value of this function is the number of threads compiled.
+			std::size_t compile_threads();
+
+			// Compiles a typed predicate for every event-trigger condition in this descriptor. (See `EventTriggerCondition::compile`)
+			// 
+			// The return-value of this function is the number of predicates generated.
+			std::size_t compile_conditions();
+
+			// Compiles a typed program for every value operation in this descriptor. (See `MetaValueOperation::compile`)
+			// 
+			// The return-value of this function is the number of programs generated.
+			std::size_t compile_operations();
+
 			inline const EntityState* get_state(EntityStateID name) const
 			{
 				return states.get_state(*this, name);
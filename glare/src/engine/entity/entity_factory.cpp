@@ -20,6 +20,8 @@
 
 #include <engine/meta/meta_evaluation_context.hpp>
 
+#include <algorithm>
+
 namespace engine
 {
 	Entity EntityFactory::create(const EntityConstructionContext& context) const
@@ -62,4 +64,75 @@ namespace engine
 
 		return entity;
 	}
+
+	std::size_t EntityFactory::create_batch(std::size_t count, const EntityConstructionContext& context, Entity* entities_out) const
+	{
+		if ((!count) || (!entities_out))
+		{
+			return 0;
+		}
+
+		auto& registry = context.registry;
+
+		const auto* entities_end = (entities_out + count);
+
+		registry.create(entities_out, (entities_out + count));
+
+		if (context.parent != null)
+		{
+			for (const auto* entity = entities_out; entity < entities_end; entity++)
+			{
+				RelationshipComponent::set_parent(registry, *entity, context.parent, true);
+			}
+		}
+
+		auto evaluation_context = MetaEvaluationContext
+		{
+			.variable_context = {},
+			.service          = context.opt_service,
+			.system_manager   = context.opt_system_manager
+		};
+
+		for (const auto& component_entry : descriptor.components.type_definitions)
+		{
+			const auto& component = component_entry.get(descriptor);
+
+			if (!component.has_indirection())
+			{
+				insert_component(registry, entities_out, count, component, &evaluation_context);
+			}
+		}
+
+		auto& name_storage = registry.storage<NameComponent>();
+
+		const bool has_existing_name = std::any_of
+		(
+			entities_out, entities_end,
+			[&name_storage](Entity entity)
+			{
+				return name_storage.contains(entity);
+			}
+		);
+
+		auto instance_filename = paths.instance_path.filename(); instance_filename.replace_extension();
+
+		const auto name_component = NameComponent { instance_filename.string() };
+
+		if (!has_existing_name)
+		{
+			registry.insert<NameComponent>(entities_out, entities_end, name_component);
+		}
+		else
+		{
+			for (const auto* entity = entities_out; entity < entities_end; entity++)
+			{
+				if (!name_storage.contains(*entity))
+				{
+					registry.emplace<NameComponent>(*entity, name_component);
+				}
+			}
+		}
+
+		return count;
+	}
 }
\ No newline at end of file
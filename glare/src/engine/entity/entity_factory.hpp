@@ -14,6 +14,7 @@
 #include <tuple>
 #include <optional>
 #include <string_view>
+#include <cstddef>
 
 namespace engine
 {
@@ -52,6 +53,11 @@ namespace engine
 				: EntityFactoryContext(factory_context), descriptor(factory_context)
 			{
 				process_archetype(descriptor, paths.instance_path, paths.instance_directory, child_callback, opt_parsing_context, this, resolve_external_modules, process_children, &default_state_index);
+
+				descriptor.compile_variables();
+				descriptor.compile_threads();
+				descriptor.compile_conditions();
+				descriptor.compile_operations();
 			}
 
 			inline EntityFactory
@@ -63,6 +69,11 @@ namespace engine
 				: EntityFactoryContext(factory_context), descriptor(factory_context)
 			{
 				process_archetype(descriptor, paths.instance_path, paths.instance_directory, opt_parsing_context, this, resolve_external_modules, &default_state_index);
+
+				descriptor.compile_variables();
+				descriptor.compile_threads();
+				descriptor.compile_conditions();
+				descriptor.compile_operations();
 			}
 
 			EntityFactory(const EntityFactory&) = default;
@@ -77,6 +88,19 @@ namespace engine
 			// See also: `EntityFactoryData::on_entity_create`
 			Entity create(const EntityConstructionContext& context) const;
 
+			// Generates `count` entities using `context`, storing each of them in `entities_out`.
+			// 
+			// Components without indirection are instantiated once for the entire batch,
+			// then copied into the storage of each entity in bulk. (See also: `insert_component`)
+			// 
+			// NOTE: The `opt_entity_out` field of `context` is ignored by this routine.
+			// The same restrictions as `create` apply to components that require indirection.
+			// 
+			// Unlike `create`, construction signals fire type by type across the batch:
+			// every entity receives a component before any entity receives the next one,
+			// so `on_construct` listeners may observe entities whose remaining components have not yet been attached.
+			std::size_t create_batch(std::size_t count, const EntityConstructionContext& context, Entity* entities_out) const;
+
 			inline Entity operator()(const EntityConstructionContext& context) const
 			{
 				return create(context);
@@ -8,6 +8,7 @@
 #include "components/instance_component.hpp"
 #include "components/state_component.hpp"
 #include "components/entity_thread_component.hpp"
+#include "components/active_threads_component.hpp"
 
 #include <engine/timer.hpp>
 
@@ -38,6 +39,60 @@
 
 namespace engine
 {
+	std::optional<EntityListener::EventFilter> EntityListener::make_event_filter(const EventTriggerSingleCondition& condition)
+	{
+		const auto event_type_member = condition.get_event_type_member();
+
+		if (!event_type_member)
+		{
+			return std::nullopt;
+		}
+
+		if (condition.get_comparison_method() != EventTriggerComparisonMethod::Equal)
+		{
+			return std::nullopt;
+		}
+
+		// NOTE: Indirect comparison values (e.g. variables) are not integral, and are therefore never filtered.
+		const auto& comparison_value = condition.get_comparison_value();
+
+		const auto filter_value = get_filter_value(comparison_value);
+
+		if (!filter_value)
+		{
+			return std::nullopt;
+		}
+
+		return EventFilter
+		{
+			.member = event_type_member,
+			.value_type_id = comparison_value.type().id(),
+			.value = *filter_value
+		};
+	}
+
+	std::optional<EntityListener::FilterValue> EntityListener::get_filter_value(const MetaAny& value)
+	{
+		if (!value)
+		{
+			return std::nullopt;
+		}
+
+		const auto type = value.type();
+
+		if ((!type.is_integral()) && (!type.is_enum()))
+		{
+			return std::nullopt;
+		}
+
+		if (const auto converted_value = value.allow_cast<FilterValue>())
+		{
+			return converted_value.cast<FilterValue>();
+		}
+
+		return std::nullopt;
+	}
+
 	EntityListener::EntityListener(Service* service, SystemManagerInterface* system_manager)
 		: MetaEventListener(service, system_manager) {}
 
@@ -119,9 +174,42 @@ namespace engine
 		return false;
 	}
 
+	bool EntityListener::add_waiting_thread(const WaitingThread& waiting_thread)
+	{
+		for (auto& existing_entry : waiting_threads)
+		{
+			if ((existing_entry.entity == waiting_thread.entity) && (existing_entry.local_thread_index == waiting_thread.local_thread_index))
+			{
+				existing_entry = waiting_thread;
+
+				return false;
+			}
+		}
+
+		waiting_threads.emplace_back(waiting_thread);
+
+		return true;
+	}
+
+	std::size_t EntityListener::remove_waiting_threads(Entity entity)
+	{
+		return static_cast<std::size_t>
+		(
+			std::erase_if
+			(
+				waiting_threads,
+
+				[entity](const WaitingThread& waiting_thread)
+				{
+					return (waiting_thread.entity == entity);
+				}
+			)
+		);
+	}
+
 	bool EntityListener::has_listening_entity() const
 	{
-		return !listening_entities.empty();
+		return ((!listening_entities.empty()) || (!waiting_threads.empty()));
 	}
 
 	bool EntityListener::on_disconnect(Service* service, const MetaType& type)
@@ -174,54 +262,201 @@ namespace engine
 				continue;
 			}
 
-			// Determine if this is a player-specific event type:
-			if (event_player_index)
+			if (!is_player_targeted(registry, entity, event_player_index))
 			{
-				if (*event_player_index != ANY_PLAYER)
-				{
-					// Check if this entity has a `PlayerComponent` attached:
-					if (const auto* player_comp = registry.try_get<PlayerComponent>(entity))
-					{
-						const auto entity_player_index = player_comp->player_index;
-
-						if (*event_player_index != entity_player_index)
-						{
-							continue;
-						}
-					}
-					// Check if this entity has a `PlayerTargetComponent` attached:
-					else if (const auto* player_comp = registry.try_get<PlayerTargetComponent>(entity))
-					{
-						const auto entity_player_index = player_comp->player_index;
-
-						if (*event_player_index != entity_player_index)
-						{
-							continue;
-						}
-					}
-				}
+				continue;
 			}
 
 			const auto& descriptor = instance_comp->get_descriptor();
 
-			update_entity
+			update_entity_rules
 			(
 				registry, entity,
 				descriptor,
 				event_instance
 			);
 		}
+
+		if (waiting_threads.empty())
+		{
+			return;
+		}
+
+		auto evaluation_context = MetaEvaluationContext
+		{
+			.variable_context = {},
+			.service = service,
+			.system_manager = system_manager
+		};
+
+		auto member_values = FilterMemberValues {};
+
+		// NOTE: Records are moved out of `waiting_threads` before being processed, since resuming
+		// a thread may result in new records being added to this listener. (See `EntitySystem::step_thread`)
+		auto dispatched_threads = std::move(waiting_threads_scratch);
+
+		dispatched_threads.clear();
+
+		std::swap(dispatched_threads, waiting_threads);
+
+		for (auto& waiting_thread : dispatched_threads)
+		{
+			const auto entity = waiting_thread.entity;
+
+			if (!registry.valid(entity))
+			{
+				continue;
+			}
+
+			const auto* instance_comp = registry.try_get<InstanceComponent>(entity);
+
+			if (!instance_comp)
+			{
+				continue;
+			}
+
+			auto* thread_component = registry.try_get<EntityThreadComponent>(entity);
+
+			if (!thread_component)
+			{
+				continue;
+			}
+
+			auto* thread = resolve_waiting_thread(*thread_component, waiting_thread);
+
+			// Discard records of threads that are no longer waiting. (e.g. stopped, erased or resumed externally)
+			if ((!thread) || (!thread->is_yielding))
+			{
+				continue;
+			}
+
+			const bool is_still_waiting =
+			(
+				(!is_player_targeted(registry, entity, event_player_index))
+				||
+				((waiting_thread.filter) && (is_filtered_out(*waiting_thread.filter, event_instance, member_values)))
+				||
+				update_waiting_thread
+				(
+					registry, entity,
+					instance_comp->get_descriptor(),
+					*thread_component, *thread,
+					event_instance,
+					evaluation_context
+				)
+			);
+
+			if (is_still_waiting)
+			{
+				waiting_threads.emplace_back(waiting_thread);
+			}
+		}
+
+		dispatched_threads.clear();
+
+		waiting_threads_scratch = std::move(dispatched_threads);
+	}
+
+	bool EntityListener::is_player_targeted(Registry& registry, Entity entity, std::optional<PlayerIndex> event_player_index)
+	{
+		// Determine if this is a player-specific event type:
+		if ((!event_player_index) || (*event_player_index == ANY_PLAYER))
+		{
+			return true;
+		}
+
+		// Check if this entity has a `PlayerComponent` attached:
+		if (const auto* player_comp = registry.try_get<PlayerComponent>(entity))
+		{
+			return (*event_player_index == player_comp->player_index);
+		}
+
+		// Check if this entity has a `PlayerTargetComponent` attached:
+		if (const auto* player_comp = registry.try_get<PlayerTargetComponent>(entity))
+		{
+			return (*event_player_index == player_comp->player_index);
+		}
+
+		return true;
 	}
 
-	void EntityListener::update_entity
+	EntityThread* EntityListener::resolve_waiting_thread(EntityThreadComponent& thread_component, WaitingThread& waiting_thread)
+	{
+		auto& threads = thread_component.threads;
+
+		auto is_waiting_thread = [&waiting_thread](const EntityThread& thread)
+		{
+			return ((thread.thread_index == waiting_thread.thread_index) && (thread.thread_id == waiting_thread.thread_id));
+		};
+
+		if ((waiting_thread.local_thread_index < threads.size()) && (is_waiting_thread(threads[waiting_thread.local_thread_index])))
+		{
+			return &(threads[waiting_thread.local_thread_index]);
+		}
+
+		// The thread has moved since this record was created. (e.g. an earlier thread was erased)
+		for (std::size_t local_thread_index = 0; local_thread_index < threads.size(); local_thread_index++)
+		{
+			auto& thread = threads[local_thread_index];
+
+			if ((thread.is_yielding) && (is_waiting_thread(thread)))
+			{
+				waiting_thread.local_thread_index = local_thread_index;
+
+				return &thread;
+			}
+		}
+
+		return {};
+	}
+
+	bool EntityListener::is_filtered_out(const EventFilter& filter, const MetaAny& event_instance, FilterMemberValues& member_values)
+	{
+		const FilterMemberValue* member_value = nullptr;
+
+		for (const auto& existing_value : member_values)
+		{
+			if (existing_value.member == filter.member)
+			{
+				member_value = &existing_value;
+
+				break;
+			}
+		}
+
+		if (!member_value)
+		{
+			auto& resolved_value = member_values.emplace_back(FilterMemberValue { filter.member });
+
+			if (auto data_member = resolve_data_member_by_id(event_instance.type(), true, filter.member))
+			{
+				if (const auto value = data_member.get(event_instance))
+				{
+					resolved_value.value_type_id = value.type().id();
+					resolved_value.value = get_filter_value(value);
+				}
+			}
+
+			member_value = &resolved_value;
+		}
+
+		// NOTE: Values of differing types are left to the yield condition,
+		// since they may still compare as equal after conversion.
+		if ((!member_value->value) || (member_value->value_type_id != filter.value_type_id))
+		{
+			return false;
+		}
+
+		return (*member_value->value != filter.value);
+	}
+
+	void EntityListener::update_entity_rules
 	(
 		Registry& registry, Entity entity,
 		const EntityDescriptor& descriptor,
 		const MetaAny& event_instance
 	)
 	{
-		using namespace engine::instructions;
-
 		auto evaluation_context = MetaEvaluationContext
 		{
 			.variable_context = {},
@@ -247,75 +482,70 @@ namespace engine
 				);
 			}
 		}
+	}
 
-		if (auto thread_component = registry.try_get<EntityThreadComponent>(entity))
-		{
-			// Get current instruction to see if its condition has been met.
-			// If the condition is met, attempt to remove this entity from this listener.
-			// (Decrement reference count, etc.)
+	bool EntityListener::update_waiting_thread
+	(
+		Registry& registry, Entity entity,
+		const EntityDescriptor& descriptor,
 
-			auto& active_threads = thread_component->threads;
+		EntityThreadComponent& thread_comp, EntityThread& thread,
 
-			for (auto& thread : active_threads)
-			{
-				if (!thread.is_yielding)
-				{
-					continue;
-				}
+		const MetaAny& event_instance,
 
-				// TODO: Determine if `thread_index` check is necessary.
-				if ((thread.next_instruction == ENTITY_INSTRUCTION_INDEX_INVALID) && (thread.thread_index == ENTITY_THREAD_INDEX_INVALID))
-				{
-					update_entity_coroutine_yield
-					(
-						registry, entity, descriptor,
-						*thread_component, thread,
-						event_instance,
-						evaluation_context
-					);
-				}
-				else
-				{
-					const auto& thread_data = descriptor.get_thread(thread.thread_index);
+		const MetaEvaluationContext& evaluation_context
+	)
+	{
+		using namespace engine::instructions;
 
-					const auto& current_instruction = thread_data.get_instruction(thread.next_instruction);
-				
-					using InstructionVariant = EntityInstruction::InstructionType;
+		// TODO: Determine if `thread_index` check is necessary.
+		if ((thread.next_instruction == ENTITY_INSTRUCTION_INDEX_INVALID) && (thread.thread_index == ENTITY_THREAD_INDEX_INVALID))
+		{
+			return update_entity_coroutine_yield
+			(
+				registry, entity, descriptor,
+				thread_comp, thread,
+				event_instance,
+				evaluation_context
+			);
+		}
 
-					switch (current_instruction.type_index())
-					{
-						case util::variant_index<InstructionVariant, Yield>():
-							update_entity_conditional_yield
-							(
-								registry, entity, descriptor,
-								thread_data, current_instruction,
-								*thread_component, thread,
-								event_instance,
-								evaluation_context
-							);
+		const auto& thread_data = descriptor.get_thread(thread.thread_index);
 
-							break;
+		const auto& current_instruction = thread_data.get_instruction(thread.next_instruction);
+				
+		using InstructionVariant = EntityInstruction::InstructionType;
 
-						case util::variant_index<InstructionVariant, FunctionCall>():
-						case util::variant_index<InstructionVariant, CoroutineCall>():
-						case util::variant_index<InstructionVariant, AdvancedMetaExpression>():
-							update_entity_coroutine_yield
-							(
-								registry, entity, descriptor,
-								thread_data, current_instruction,
-								*thread_component, thread,
-								event_instance,
-								evaluation_context
-							);
+		switch (current_instruction.type_index())
+		{
+			case util::variant_index<InstructionVariant, Yield>():
+				return update_entity_conditional_yield
+				(
+					registry, entity, descriptor,
+					thread_data, current_instruction,
+					thread_comp, thread,
+					event_instance,
+					evaluation_context
+				);
 
-							break;
-					}
-				}
-			}
+			case util::variant_index<InstructionVariant, FunctionCall>():
+			case util::variant_index<InstructionVariant, CoroutineCall>():
+			case util::variant_index<InstructionVariant, AdvancedMetaExpression>():
+				return update_entity_coroutine_yield
+				(
+					registry, entity, descriptor,
+					thread_data, current_instruction,
+					thread_comp, thread,
+					event_instance,
+					evaluation_context
+				);
 		}
+
+		// The thread is no longer waiting on an event.
+		return false;
 	}
 
-	void EntityListener::update_entity_conditional_yield
+	bool EntityListener::update_entity_conditional_yield
 	(
 		Registry& registry, Entity entity,
 		const EntityDescriptor& descriptor,
@@ -345,11 +575,12 @@ namespace engine
 		(
 			yield_condition,
 
-			[this, &registry, entity, &descriptor, &event_instance, &evaluation_context, &condition_reference_count, &yield_condition_met](const auto& condition)
+			[this, &registry, entity, &descriptor, &yield_condition, &event_instance, &evaluation_context, &condition_reference_count, &yield_condition_met](const auto& condition)
 			{
 				if (condition.has_type_compatible(descriptor, this->type_id))
 				{
-					yield_condition_met = (yield_condition_met || condition.condition_met(event_instance, registry, entity, evaluation_context));
+					// NOTE: Evaluated through `yield_condition` to make use of its compiled predicate, if available.
+					yield_condition_met = (yield_condition_met || yield_condition.condition_met(event_instance, registry, entity, evaluation_context));
 
 					condition_reference_count++;
 				}
@@ -426,13 +657,17 @@ namespace engine
 			// Awaken the thread past the active yield instruction + any subsequent event captures (see above).
 			thread.unyield(instruction_advance);
 
-			// Remove a reference to this listener for `entity`.
-			// NOTE: See `EntitySystem::step_thread` for corresponding `add_entity` usage prior.
-			remove_entity(entity, condition_reference_count);
+			wake_entity_threads(registry, entity);
+
+			// NOTE: The caller discards this thread's record. (See `EntitySystem::step_thread` for registration)
+			return false;
 		}
+
+		// Continue waiting, as long as the yield condition observes this event-type.
+		return (condition_reference_count > 0);
 	}
 
-	void EntityListener::update_entity_coroutine_yield
+	bool EntityListener::update_entity_coroutine_yield
 	(
 		Registry& registry, Entity entity,
 		const EntityDescriptor& descriptor,
@@ -447,7 +682,7 @@ namespace engine
 		const MetaEvaluationContext& evaluation_context
 	)
 	{
-		update_entity_coroutine_yield
+		return update_entity_coroutine_yield
 		(
 			registry, entity,
 			descriptor,
@@ -457,7 +692,7 @@ namespace engine
 		);
 	}
 
-	void EntityListener::update_entity_coroutine_yield
+	bool EntityListener::update_entity_coroutine_yield
 	(
 		Registry& registry, Entity entity,
 		const EntityDescriptor& descriptor,
@@ -471,14 +706,14 @@ namespace engine
 	{
 		if (!thread.has_fiber())
 		{
-			return;
+			return false;
 		}
 
 		auto& active_fiber = thread.get_fiber();
 
 		if (!active_fiber.has_script_handle())
 		{
-			return;
+			return false;
 		}
 
 		auto& script = *active_fiber.script;
@@ -487,7 +722,7 @@ namespace engine
 
 		if (!script.waiting_for_event(event_type))
 		{
-			return;
+			return false;
 		}
 
 		if (script.has_yield_continuation_predicate())
@@ -496,7 +731,8 @@ namespace engine
 
 			if (!yield_predicate(script, event_instance))
 			{
-				return;
+				// Continue waiting for the next event.
+				return true;
 			}
 		}
 
@@ -522,6 +758,8 @@ namespace engine
 		// Awaken the thread, allowing it to handle the event.
 		thread.unyield(instruction_advance);
 
+		wake_entity_threads(registry, entity);
+
 		if (can_generate_capture_event)
 		{
 			assert(service);
@@ -539,9 +777,8 @@ namespace engine
 			);
 		}
 
-		// Remove a reference to this listener for `entity`.
-		// NOTE: See `EntitySystem::step_thread` for corresponding `add_entity` usage prior.
-		remove_entity(entity);
+		// NOTE: The caller discards this thread's record. (See `EntitySystem::step_thread` for registration)
+		return false;
 	}
 
 	void EntityListener::handle_state_rules
@@ -560,7 +797,7 @@ namespace engine
 			// Resolve trigger condition status:
 			if (condition)
 			{
-				if (!EventTriggerConditionType::get_condition_status(condition->get(descriptor), event_instance, registry, entity, evaluation_context))
+				if (!condition->get(descriptor).condition_met(event_instance, registry, entity, evaluation_context))
 				{
 					// Condition has not been met; continue to next rule.
 					continue;
@@ -8,6 +8,9 @@
 #include <util/small_vector.hpp>
 
 #include <optional>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
 
 namespace engine
 {
@@ -26,14 +29,67 @@ namespace engine
 		public:
 			using ReferenceCount = std::uint16_t;
 			using RuleCollection = EntityStateRuleCollection;
+			using LocalThreadIndex = std::size_t; // EntityThreadComponent::LocalThreadIndex
+			using FilterValue = std::uint64_t;
+
+			// An optional pre-filter for a waiting thread, checked before evaluating the thread's yield condition.
+			// 
+			// Events whose `member` holds a value of the same type as the filter's, but
+			// with a different hashed value, are skipped. (e.g. a different button ID)
+			struct EventFilter
+			{
+				MetaSymbolID member = {};
+				MetaTypeID value_type_id = {};
+				FilterValue value = {};
+			};
+
+			// A thread waiting on the event-type encapsulated by this listener.
+			struct WaitingThread
+			{
+				Entity entity = null;
+
+				// NOTE: Threads may be erased while waiting, meaning this index is verified
+				// against `thread_index` and `thread_id` before use. (See `resolve_waiting_thread`)
+				LocalThreadIndex local_thread_index = {};
+
+				EntityThreadIndex thread_index = ENTITY_THREAD_INDEX_INVALID;
+				EntityThreadID thread_id = {};
+
+				std::optional<EventFilter> filter = std::nullopt;
+			};
+
+			// Generates an `EventFilter` from `condition`, if possible.
+			// (i.e. an equality comparison between a data member and an integral or enum value)
+			static std::optional<EventFilter> make_event_filter(const EventTriggerSingleCondition& condition);
+
+			// Computes the hashed value of `value` for use with `EventFilter`, if applicable.
+			static std::optional<FilterValue> get_filter_value(const MetaAny& value);
 
 			EntityListener(Service* service=nullptr, SystemManagerInterface* system_manager=nullptr);
 
+			// Adds a reference to `entity` for state-rule processing.
 			bool add_entity(Entity entity);
 			bool remove_entity(Entity entity, ReferenceCount references_to_remove=1, bool force=false);
 
 			bool contains(Entity entity) const;
 
+			// Registers a thread as waiting on this listener's event-type.
+			// 
+			// Records are removed automatically once the thread is resumed by this listener,
+			// or once the thread is found to no longer be waiting. (e.g. stopped or erased)
+			// 
+			// The return-value of this function indicates if a new record was added.
+			bool add_waiting_thread(const WaitingThread& waiting_thread);
+
+			// Removes every record of a thread of `entity` waiting on this listener.
+			// The return-value of this function indicates how many records were removed.
+			std::size_t remove_waiting_threads(Entity entity);
+
+			inline std::size_t waiting_thread_count() const
+			{
+				return waiting_threads.size();
+			}
+
 			void on_event(const MetaType& type, MetaAny event_instance) override;
 
 		protected:
@@ -53,17 +109,66 @@ namespace engine
 
 			// A collection of entities listening for the
 			// event-type encapsulated by this listener instance.
+			// 
+			// NOTE: Only used for state rules; see `waiting_threads` for yielding threads.
 			util::small_vector<Reference, 8> listening_entities; // 16
 
+			// Threads waiting on the event-type encapsulated by this listener instance.
+			// 
+			// This allows events to be routed directly to waiting threads,
+			// rather than checking every thread of every listening entity.
+			std::vector<WaitingThread> waiting_threads;
+
+			// Storage reused by `on_event` while dispatching to `waiting_threads`.
+			std::vector<WaitingThread> waiting_threads_scratch;
+
 		private:
-			void update_entity
+			// The hashed value of an event's data member. (See `is_filtered_out`)
+			struct FilterMemberValue
+			{
+				MetaSymbolID member = {};
+				MetaTypeID value_type_id = {};
+
+				std::optional<FilterValue> value = std::nullopt;
+			};
+
+			using FilterMemberValues = util::small_vector<FilterMemberValue, 2>;
+
+			// Determines if `entity` is targeted by an event, based on its player index.
+			static bool is_player_targeted(Registry& registry, Entity entity, std::optional<PlayerIndex> event_player_index);
+
+			// Retrieves the thread referenced by `waiting_thread`, updating its local index if needed.
+			static EntityThread* resolve_waiting_thread(EntityThreadComponent& thread_component, WaitingThread& waiting_thread);
+
+			void update_entity_rules
 			(
 				Registry& registry, Entity entity,
 				const EntityDescriptor& descriptor,
 				const MetaAny& event_instance
 			);
 
-			void update_entity_conditional_yield
+			// Delivers `event_instance` to the waiting thread described by `waiting_thread`.
+			// 
+			// The return-value of this function indicates if the
+			// thread is still waiting on this listener's event-type.
+			bool update_waiting_thread
+			(
+				Registry& registry, Entity entity,
+				const EntityDescriptor& descriptor,
+
+				EntityThreadComponent& thread_comp, EntityThread& thread,
+
+				const MetaAny& event_instance,
+
+				const MetaEvaluationContext& evaluation_context={}
+			);
+
+			// Determines if `event_instance` can be skipped for a thread waiting with `filter`.
+			// 
+			// NOTE: Member values are resolved once per event, then cached in `member_values`.
+			static bool is_filtered_out(const EventFilter& filter, const MetaAny& event_instance, FilterMemberValues& member_values);
+
+			bool update_entity_conditional_yield
 			(
 				Registry& registry, Entity entity,
 				const EntityDescriptor& descriptor,
@@ -78,7 +183,7 @@ namespace engine
 				const MetaEvaluationContext& evaluation_context={}
 			);
 
-			void update_entity_coroutine_yield
+			bool update_entity_coroutine_yield
 			(
 				Registry& registry, Entity entity,
 				const EntityDescriptor& descriptor,
@@ -93,7 +198,7 @@ namespace engine
 				const MetaEvaluationContext& evaluation_context={}
 			);
 
-			void update_entity_coroutine_yield
+			bool update_entity_coroutine_yield
 			(
 				Registry& registry, Entity entity,
 				const EntityDescriptor& descriptor,
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <engine/meta/types.hpp>
+
+#include <util/small_vector.hpp>
+
+#include <cstdint>
+
+namespace engine
+{
+	// Opt-in configuration for recycling instances of an archetype, rather than destroying them. (See `EntityPool`)
+	// 
+	// Archetypes enable pooling using the "pool" key, e.g. `"pool": 16`, or:
+	// `"pool": { "size": 16, "capacity": 64, "reset": ["Health", "Velocity"] }`
+	struct EntityPoolConfig
+	{
+		using Size = std::uint32_t;
+
+		using ComponentTypes = util::small_vector<MetaTypeID, 8>;
+
+		// The number of instances generated ahead of time. (i.e. when a level is loaded)
+		Size size = 0;
+
+		// The maximum number of inactive instances retained by a pool.
+		// Released instances beyond this limit are destroyed.
+		// 
+		// If this value is zero, no limit is imposed.
+		Size capacity = 0;
+
+		// Components reset to the values described by the archetype when an instance is reused.
+		// 
+		// NOTE: All other components (including collision objects) retain their current state.
+		ComponentTypes reset_components;
+
+		bool enabled : 1 = false;
+
+		inline bool is_reset_component(MetaTypeID type_id) const
+		{
+			for (const auto& reset_type_id : reset_components)
+			{
+				if (reset_type_id == type_id)
+				{
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		inline explicit operator bool() const
+		{
+			return enabled;
+		}
+	};
+}
@@ -13,6 +13,7 @@
 #include "components/state_storage_component.hpp"
 #include "components/frozen_state_component.hpp"
 #include "components/entity_thread_component.hpp"
+#include "components/active_threads_component.hpp"
 
 // Debugging related:
 #include <util/log.hpp>
@@ -384,6 +385,8 @@ namespace engine
 
 		// TODO: Change to use of `EntityThreadSpawnCommand` instead of direct call.
 		thread_component.start_threads(descriptor, *this, self_index);
+
+		wake_entity_threads(registry, entity);
 	}
 
 	void EntityState::decay_threads(const EntityDescriptor& descriptor, Registry& registry, Entity entity, EntityStateIndex self_index) const
@@ -13,6 +13,8 @@
 #include "components/entity_thread_component.hpp"
 #include "components/instance_component.hpp"
 #include "components/entity_context_component.hpp"
+#include "components/active_threads_component.hpp"
+#include "components/pooled_entity_component.hpp"
 
 #include "commands/commands.hpp"
 
@@ -23,6 +25,7 @@
 #include <engine/system_manager_interface.hpp>
 
 #include <engine/components/relationship_component.hpp>
+#include <engine/components/name_component.hpp>
 
 #include <engine/script/script_handle.hpp>
 #include <engine/script/script.hpp>
@@ -48,12 +51,16 @@
 #include <engine/commands/expr_command.hpp>
 
 #include <util/variant.hpp>
+#include <util/concurrency.hpp>
+#include <util/small_vector.hpp>
 
 #include <optional>
+#include <algorithm>
 #include <iterator>
 #include <type_traits>
 #include <tuple>
 #include <utility>
+#include <exception>
 
 #include <cassert>
 
@@ -94,6 +101,22 @@ namespace engine
 		// TODO: Implement universal variables.
 		MetaVariableStorageInterface* universal_variables = {};
 
+		// Retrieves the descriptor of `opt_entity`, used to reserve variable slots during allocation.
+		auto get_descriptor = [opt_registry, opt_entity]() -> const EntityDescriptor*
+		{
+			if ((!opt_registry) || (opt_entity == null))
+			{
+				return {};
+			}
+
+			if (const auto instance_comp = opt_registry->try_get<InstanceComponent>(opt_entity))
+			{
+				return &(instance_comp->get_descriptor());
+			}
+
+			return {};
+		};
+
 		if (referenced_scope)
 		{
 			switch (*referenced_scope)
@@ -101,7 +124,21 @@ namespace engine
 				case MetaVariableScope::Local:
 					if (opt_thread)
 					{
-						local_variables = opt_thread->get_variables();
+						if (!local_variables)
+						{
+							const auto descriptor = get_descriptor();
+
+							if ((descriptor) && (opt_thread->thread_index < descriptor->get_next_thread_index()))
+							{
+								local_variables = opt_thread->get_variables(descriptor->get_thread(opt_thread->thread_index).local_variables);
+							}
+						}
+
+						// NOTE: Slot reservation is skipped if the thread's description couldn't be resolved.
+						if (!local_variables)
+						{
+							local_variables = opt_thread->get_variables();
+						}
 					}
 
 					break;
@@ -109,7 +146,18 @@ namespace engine
 				case MetaVariableScope::Global:
 					if (opt_thread_comp)
 					{
-						global_variables = opt_thread_comp->get_global_variables();
+						if (!global_variables)
+						{
+							if (const auto descriptor = get_descriptor())
+							{
+								global_variables = opt_thread_comp->get_global_variables(descriptor->global_variables);
+							}
+						}
+
+						if (!global_variables)
+						{
+							global_variables = opt_thread_comp->get_global_variables();
+						}
 					}
 
 					break;
@@ -153,6 +201,18 @@ namespace engine
 		};
 	}
 
+	// A contiguous range of `parallel_thread_groups`, progressed by a single worker task.
+	struct EntitySystem::ParallelThreadTask
+	{
+		std::size_t groups_begin = 0;
+		std::size_t groups_end   = 0;
+
+		// Side effects produced by this task, in entity order.
+		ServiceCommandBuffer commands;
+
+		std::size_t threads_updated = 0; // EntityThreadCount
+	};
+
 	EntitySystem::EntitySystem
 	(
 		Service& service,
@@ -182,19 +242,98 @@ namespace engine
 		}
 	}
 
+	EntitySystem::~EntitySystem() = default;
+
+	void EntitySystem::set_parallel_thread_execution(std::size_t worker_count, std::size_t min_parallel_entities)
+	{
+		parallel_thread_threshold = min_parallel_entities;
+
+		if (worker_count == parallel_thread_worker_count)
+		{
+			return;
+		}
+
+		parallel_thread_worker_count = worker_count;
+
+		if (worker_count == 0)
+		{
+			thread_pool = {};
+			parallel_thread_tasks = {};
+
+			return;
+		}
+
+		auto runtime_options = util::concurrency::runtime_options {};
+
+		runtime_options.max_cpu_threads = worker_count;
+
+		thread_pool = std::make_unique<util::concurrency::runtime>(runtime_options);
+	}
+
+	std::size_t EntitySystem::get_parallel_thread_worker_count() const
+	{
+		return parallel_thread_worker_count;
+	}
+
+	std::size_t EntitySystem::get_parallel_thread_update_count() const
+	{
+		return parallel_thread_update_count;
+	}
+
+	void EntitySystem::set_realtime_thread_budget(std::chrono::microseconds budget)
+	{
+		realtime_thread_scheduler.set_budget(budget);
+	}
+
+	std::chrono::microseconds EntitySystem::get_realtime_thread_budget() const
+	{
+		return realtime_thread_scheduler.get_budget();
+	}
+
+	const EntitySystem::RealtimeThreadStatistics& EntitySystem::get_realtime_thread_statistics() const
+	{
+		return realtime_thread_scheduler.get_statistics();
+	}
+
+	std::size_t EntitySystem::get_scheduled_thread_count(EntityThreadCadence cadence) const
+	{
+		return get_cadence_thread_list(cadence).thread_count();
+	}
+
+	std::size_t EntitySystem::get_scheduled_thread_count(EntityThreadCadence cadence, Entity entity) const
+	{
+		return get_cadence_thread_list(cadence).get_entity_threads(entity).size();
+	}
+
 	bool EntitySystem::on_subscribe(Service& service)
 	{
 		auto& registry = service.get_registry();
 
+		// Thread changes made while unsubscribed were not observed.
+		invalidate_cadence_thread_lists();
+
 		// Registry events:
 		registry.on_construct<StateComponent>().connect<&EntitySystem::on_state_init>(*this);
 		registry.on_update<StateComponent>().connect<&EntitySystem::on_state_update>(*this);
 		registry.on_destroy<StateComponent>().connect<&EntitySystem::on_state_destroyed>(*this);
 
+		registry.on_construct<PooledEntityComponent>().connect<&EntitySystem::on_entity_pooled>(*this);
+
 		registry.on_construct<EntityContextComponent>().connect<&EntitySystem::on_context_init>(*this);
 
+		registry.on_construct<EntityThreadComponent>().connect<&EntitySystem::on_entity_threads_wake>(*this);
+		registry.on_update<EntityThreadComponent>().connect<&EntitySystem::on_entity_threads_wake>(*this);
 		registry.on_update<EntityThreadComponent>().connect<&EntitySystem::on_entity_threads_updated_generate_delayed_event>(*this);
 
+		registry.on_construct<ActiveThreadsComponent>().connect<&EntitySystem::on_active_threads_changed>(*this);
+		registry.on_destroy<ActiveThreadsComponent>().connect<&EntitySystem::on_active_threads_changed>(*this);
+
+		registry.on_construct<NameComponent>().connect<&EntitySystem::on_target_name_changed>(*this);
+		registry.on_update<NameComponent>().connect<&EntitySystem::on_target_name_changed>(*this);
+		registry.on_destroy<NameComponent>().connect<&EntitySystem::on_target_name_changed>(*this);
+
+		registry.on_destroy<RelationshipComponent>().connect<&EntitySystem::on_target_relationship_destroyed>(*this);
+
 		// Commands:
 		service.register_event<StateChangeCommand,        &EntitySystem::on_state_change_command>(*this);
 		service.register_event<StateActivationCommand,    &EntitySystem::on_state_activation_command>(*this);
@@ -236,6 +375,20 @@ namespace engine
 		registry.on_update<StateComponent>().disconnect(this);
 		registry.on_destroy<StateComponent>().disconnect(this);
 
+		registry.on_construct<PooledEntityComponent>().disconnect(this);
+
+		registry.on_construct<EntityThreadComponent>().disconnect(this);
+		registry.on_update<EntityThreadComponent>().disconnect(this);
+
+		registry.on_construct<ActiveThreadsComponent>().disconnect(this);
+		registry.on_destroy<ActiveThreadsComponent>().disconnect(this);
+
+		registry.on_construct<NameComponent>().disconnect(this);
+		registry.on_update<NameComponent>().disconnect(this);
+		registry.on_destroy<NameComponent>().disconnect(this);
+
+		registry.on_destroy<RelationshipComponent>().disconnect(this);
+
 		service.unregister(*this);
 
 		return true;
@@ -566,6 +719,9 @@ namespace engine
 
 	void EntitySystem::on_state_update_impl(Registry& registry, Entity entity, bool handle_existing)
 	{
+		// State changes start and stop threads directly. (See `EntityState::update`)
+		invalidate_entity_thread_lists(entity);
+
 		const auto* descriptor = get_descriptor(entity);
 
 		assert(descriptor);
@@ -652,6 +808,24 @@ namespace engine
 	{
 		// TODO: Implement state cleanup.
 	}
+
+	void EntitySystem::on_entity_pooled(Registry& registry, Entity entity)
+	{
+		// NOTE: State rules are registered again once the default state
+		// is re-applied upon reuse. (See `EntityFactoryData::on_entity_reuse`)
+		for (auto& listener_entry : listeners)
+		{
+			auto& listener = listener_entry.second;
+
+			listener.remove_entity(entity, 1, true);
+
+			// Threads are restarted upon reuse, meaning that these records would otherwise
+			// resolve to new threads with the same index and identifier.
+			listener.remove_waiting_threads(entity);
+		}
+
+		invalidate_entity_thread_lists(entity);
+	}
 	
 	// Handles logging/printing for debugging purposes.
 	void EntitySystem::on_state_change(const OnStateChange& state_change)
@@ -678,6 +852,176 @@ namespace engine
 		print("Entity {}: state #{} activated", state_activate.entity, *state_activate.state.id);
 	}
 
+	void EntitySystem::on_entity_threads_wake(Registry& registry, Entity entity)
+	{
+		// NOTE: Patches made by `progress_threads` only reflect progress, rather than structural changes.
+		if (!is_progressing_threads)
+		{
+			invalidate_entity_thread_lists(entity);
+		}
+
+		wake_entity_threads(registry, entity);
+	}
+
+	void EntitySystem::on_active_threads_changed(Registry& registry, Entity entity)
+	{
+		invalidate_entity_thread_lists(entity);
+	}
+
+	void EntitySystem::refresh_cadence_thread_lists(Registry& registry)
+	{
+		if (cadence_thread_lists_dirty)
+		{
+			rebuild_cadence_thread_lists(registry);
+
+			return;
+		}
+
+		for (const auto entity : pending_thread_list_entities)
+		{
+			update_entity_thread_lists(registry, entity);
+		}
+
+		pending_thread_list_entities.clear();
+	}
+
+	void EntitySystem::rebuild_cadence_thread_lists(Registry& registry)
+	{
+		for (auto& thread_list : cadence_thread_lists)
+		{
+			thread_list.clear();
+		}
+
+		registry.view<EntityThreadComponent, ActiveThreadsComponent>().each
+		(
+			[this](Entity entity, const EntityThreadComponent& thread_component)
+			{
+				add_entity_thread_lists(entity, thread_component);
+			}
+		);
+
+		pending_thread_list_entities.clear();
+
+		cadence_thread_lists_dirty = false;
+	}
+
+	void EntitySystem::update_entity_thread_lists(Registry& registry, Entity entity)
+	{
+		for (auto& thread_list : cadence_thread_lists)
+		{
+			thread_list.remove_entity(entity);
+		}
+
+		// NOTE: Entities may have been destroyed, or put to sleep, since being invalidated.
+		if (!registry.valid(entity))
+		{
+			return;
+		}
+
+		if (!registry.all_of<ActiveThreadsComponent>(entity))
+		{
+			return;
+		}
+
+		if (const auto* thread_component = registry.try_get<EntityThreadComponent>(entity))
+		{
+			add_entity_thread_lists(entity, *thread_component);
+		}
+	}
+
+	void EntitySystem::add_entity_thread_lists(Entity entity, const EntityThreadComponent& thread_component)
+	{
+		const auto& threads = thread_component.threads;
+
+		for (std::size_t local_thread_index = 0; local_thread_index < threads.size(); local_thread_index++)
+		{
+			const auto cadence_index = static_cast<std::size_t>(threads[local_thread_index].cadence);
+
+			assert(cadence_index < CADENCE_COUNT);
+
+			cadence_thread_lists[cadence_index].add_thread(entity, local_thread_index);
+		}
+	}
+
+	void EntitySystem::CadenceThreadList::add_thread(Entity entity, LocalThreadIndex local_thread_index)
+	{
+		const auto [it, inserted] = group_indices.try_emplace(entity, entities.size());
+
+		if (inserted)
+		{
+			entities.emplace_back(entity);
+			local_thread_indices.emplace_back();
+		}
+
+		local_thread_indices[it->second].emplace_back(local_thread_index);
+	}
+
+	bool EntitySystem::CadenceThreadList::remove_entity(Entity entity)
+	{
+		const auto it = group_indices.find(entity);
+
+		if (it == group_indices.end())
+		{
+			return false;
+		}
+
+		const auto group_index = it->second;
+		const auto last_group_index = (entities.size() - 1);
+
+		group_indices.erase(it);
+
+		if (group_index != last_group_index)
+		{
+			entities[group_index] = entities[last_group_index];
+			local_thread_indices[group_index] = std::move(local_thread_indices[last_group_index]);
+
+			group_indices[entities[group_index]] = group_index;
+		}
+
+		entities.pop_back();
+		local_thread_indices.pop_back();
+
+		return true;
+	}
+
+	std::size_t EntitySystem::CadenceThreadList::thread_count() const
+	{
+		std::size_t count = 0;
+
+		for (const auto& threads : local_thread_indices)
+		{
+			count += threads.size();
+		}
+
+		return count;
+	}
+
+	void EntitySystem::set_thread_cadence(Entity entity, EntityThread& thread, EntityThreadCadence cadence)
+	{
+		if (thread.cadence == cadence)
+		{
+			return;
+		}
+
+		thread.cadence = cadence;
+
+		// NOTE: Deferred while progressing threads in parallel, since this may be executing on a worker thread.
+		if (auto command_buffer = Service::get_thread_command_buffer())
+		{
+			command_buffer->emplace
+			(
+				[this, entity](Service& service)
+				{
+					invalidate_entity_thread_lists(entity);
+				}
+			);
+
+			return;
+		}
+
+		invalidate_entity_thread_lists(entity);
+	}
+
 	void EntitySystem::on_entity_threads_updated_generate_delayed_event(Registry& registry, Entity entity)
 	{
 		// Enqueue the `OnEntityThreadsUpdated` event so that we don't process thread removals before other commands/events have been processed.
@@ -692,7 +1036,10 @@ namespace engine
 
 		auto& thread_component = registry.get<EntityThreadComponent>(entity);
 
-		thread_component.erase_completed_threads();
+		if (thread_component.erase_completed_threads())
+		{
+			invalidate_entity_thread_lists(entity);
+		}
 	}
 
 	void EntitySystem::on_state_change_command(const StateChangeCommand& state_change)
@@ -747,6 +1094,11 @@ namespace engine
 			: registry.get<EntityThreadComponent>(entity)
 		;
 
+		// Any thread command may allow a suspended thread to continue. (e.g. resuming, skipping, spawning)
+		wake_entity_threads(registry, entity);
+
+		invalidate_entity_thread_lists(entity);
+
 		util::visit
 		(
 			thread_target.value,
@@ -1211,6 +1563,8 @@ namespace engine
 
 		const auto entity = thread_command.entity();
 
+		invalidate_entity_thread_lists(entity);
+
 		registry.patch<EntityThreadComponent>
 		(
 			entity,
@@ -1314,9 +1668,70 @@ namespace engine
 	{
 		auto& registry = get_registry();
 
+		// NOTE: Names within the moved hierarchy may now resolve differently from other entities.
+		invalidate_target_caches(registry, parent_changed.entity);
+
 		on_parent_context_changed(registry, parent_changed);
 	}
 
+	void EntitySystem::on_target_name_changed(Registry& registry, Entity entity)
+	{
+		// NOTE: Only the current name is invalidated here. Entries resolved using a
+		// previous name are discarded once their entity's name no longer matches.
+		if (const auto* name_component = registry.try_get<NameComponent>(entity))
+		{
+			target_cache_generations.invalidate(name_component->hash());
+		}
+	}
+
+	void EntitySystem::on_target_relationship_destroyed(Registry& registry, Entity entity)
+	{
+		// NOTE: Descendants are not enumerated here, since they are either destroyed
+		// or re-parented alongside this entity, invalidating their names separately.
+		if (const auto* name_component = registry.try_get<NameComponent>(entity))
+		{
+			target_cache_generations.invalidate(name_component->hash());
+		}
+	}
+
+	void EntitySystem::invalidate_target_caches()
+	{
+		target_cache_generations.invalidate_all();
+	}
+
+	void EntitySystem::invalidate_target_caches(Registry& registry, Entity entity)
+	{
+		if (!registry.valid(entity))
+		{
+			return;
+		}
+
+		if (const auto* name_component = registry.try_get<NameComponent>(entity))
+		{
+			target_cache_generations.invalidate(name_component->hash());
+		}
+
+		if (const auto* relationship = registry.try_get<RelationshipComponent>(entity))
+		{
+			relationship->enumerate_children
+			(
+				registry,
+
+				[this, &registry](Entity child, const RelationshipComponent& child_relationship, Entity next_child)
+				{
+					if (const auto* name_component = registry.try_get<NameComponent>(child))
+					{
+						target_cache_generations.invalidate(name_component->hash());
+					}
+
+					return true;
+				},
+
+				true
+			);
+		}
+	}
+
 	void EntitySystem::on_context_init(Registry& registry, Entity entity)
 	{
 		auto& context_comp = registry.get<EntityContextComponent>(entity);
@@ -1508,167 +1923,555 @@ namespace engine
 		return false;
 	}
 
-	template <EntityThreadCadence... target_cadence>
-	std::size_t EntitySystem::progress_threads() // EntityThreadCount
+	bool EntitySystem::threads_are_dormant(const EntityThreadComponent& thread_component)
 	{
-		using namespace engine::instructions;
+		for (const auto& thread : thread_component.threads)
+		{
+			if (!thread.is_suspended())
+			{
+				return false;
+			}
 
-		auto& registry = get_registry();
+			if ((thread.is_sleeping()) && (thread.has_fiber()) && (thread.active_fiber.has_script_handle()))
+			{
+				if (thread.active_fiber.script->has_yield_continuation_predicate())
+				{
+					return false;
+				}
+			}
+		}
 
-		std::size_t threads_updated = 0; // EntityThreadCount
+		return true;
+	}
 
-		registry.view<EntityThreadComponent>().each
-		(
-			[&](Entity entity, EntityThreadComponent& thread_component)
-			{
-				const auto instance_component = registry.try_get<InstanceComponent>(entity);
+	bool EntitySystem::try_sleep_entity_threads(Registry& registry, Entity entity)
+	{
+		if (!registry.valid(entity))
+		{
+			return false;
+		}
 
-				// TODO: Allow `EntityThreadComponent` to work without `InstanceComponent`, then remove this assert.
-				assert(instance_component);
+		const auto* thread_component = registry.try_get<EntityThreadComponent>(entity);
 
-				const EntityDescriptor* descriptor = (instance_component)
-					? (&(instance_component->get_descriptor()))
-					: nullptr
-				;
+		if ((!thread_component) || (!threads_are_dormant(*thread_component)))
+		{
+			return false;
+		}
 
-				bool has_updated_thread = false;
+		return (registry.remove<ActiveThreadsComponent>(entity) > 0);
+	}
 
-				for (auto& thread_entry : thread_component.threads)
-				{
-					if (((thread_entry.cadence == target_cadence) || ...))
+	template <EntityThreadCadence... target_cadence>
+	std::size_t EntitySystem::progress_threads() // EntityThreadCount
+	{
+		auto& registry = get_registry();
+
+		// NOTE: Lists are only updated between passes, meaning that changes made during this
+		// pass (e.g. a thread changing to another cadence) take effect on the next pass.
+		refresh_cadence_thread_lists(registry);
+
+		std::size_t threads_updated = 0; // EntityThreadCount
+
+		is_progressing_threads = true;
+
+		try
+		{
+			// NOTE: Each cadence is progressed separately, in the order specified.
+			((threads_updated += progress_cadence_threads<target_cadence>(registry)), ...);
+		}
+		catch (...)
+		{
+			is_progressing_threads = false;
+
+			throw;
+		}
+
+		is_progressing_threads = false;
+
+		return threads_updated;
+	}
+
+	template <EntityThreadCadence target_cadence>
+	std::size_t EntitySystem::progress_cadence_threads(Registry& registry) // EntityThreadCount
+	{
+		// NOTE: Realtime threads are always progressed serially. (See `can_progress_threads_in_parallel`)
+		if constexpr (target_cadence == EntityThreadCadence::Realtime)
+		{
+			return progress_realtime_threads(registry);
+		}
+		else
+		{
+			if (thread_pool)
+			{
+				return progress_threads_parallel<target_cadence>(registry);
+			}
+
+			return progress_threads_serial<target_cadence>(registry);
+		}
+	}
+
+	template <EntityThreadCadence target_cadence>
+	std::size_t EntitySystem::progress_threads_serial(Registry& registry) // EntityThreadCount
+	{
+		const auto& thread_list = get_cadence_thread_list(target_cadence);
+
+		std::size_t threads_updated = 0; // EntityThreadCount
+
+		for (std::size_t group_index = 0; group_index < thread_list.size(); group_index++)
+		{
+			threads_updated += progress_thread_group<target_cadence>(registry, thread_list, group_index);
+		}
+
+		return threads_updated;
+	}
+
+	template <EntityThreadCadence target_cadence>
+	std::size_t EntitySystem::progress_threads_parallel(Registry& registry) // EntityThreadCount
+	{
+		const auto& thread_list = get_cadence_thread_list(target_cadence);
+
+		parallel_thread_groups.clear();
+		serial_thread_groups.clear();
+
+		for (std::size_t group_index = 0; group_index < thread_list.size(); group_index++)
+		{
+			const auto entity = thread_list.entities[group_index];
+
+			const auto* thread_component = (registry.valid(entity))
+				? registry.try_get<EntityThreadComponent>(entity)
+				: nullptr
+			;
+
+			if (!thread_component)
+			{
+				continue;
+			}
+
+			if (can_progress_threads_in_parallel<target_cadence>(registry, entity, *thread_component, thread_list.get_threads(group_index)))
+			{
+				parallel_thread_groups.emplace_back(group_index);
+			}
+			else
+			{
+				serial_thread_groups.emplace_back(group_index);
+			}
+		}
+
+		const auto group_count = parallel_thread_groups.size();
+
+		// Not enough work to justify scheduling overhead.
+		if (group_count < parallel_thread_threshold)
+		{
+			return progress_threads_serial<target_cadence>(registry);
+		}
+
+		// NOTE: Tasks are over-partitioned relative to the number of workers, allowing idle workers to pick up remaining tasks.
+		const auto task_count = std::min((parallel_thread_worker_count * PARALLEL_THREAD_TASKS_PER_WORKER), group_count);
+		const auto groups_per_task = ((group_count + task_count - 1) / task_count);
+
+		if (parallel_thread_tasks.size() < task_count)
+		{
+			parallel_thread_tasks.resize(task_count);
+		}
+
+		auto executor = thread_pool->thread_pool_executor();
+
+		auto task_results = util::small_vector<util::VoidResult, 32> {};
+
+		for (std::size_t task_index = 0; task_index < task_count; task_index++)
+		{
+			auto& task = parallel_thread_tasks[task_index];
+
+			task.groups_begin = std::min((task_index * groups_per_task), group_count);
+			task.groups_end = std::min((task.groups_begin + groups_per_task), group_count);
+			task.threads_updated = 0;
+
+			task_results.emplace_back
+			(
+				executor->submit
+				(
+					[this, &registry, &thread_list, &task]()
 					{
-						if (thread_entry.is_suspended()) // || thread_entry.is_complete (implied)
+						// Capture events raised on this worker, rather than dispatching them.
+						const auto previous_command_buffer = Service::set_thread_command_buffer(&task.commands);
+
+						try
 						{
-							if (!try_resume_thread(thread_entry))
+							for (auto group_entry = task.groups_begin; group_entry < task.groups_end; group_entry++)
 							{
-								continue;
+								const auto group_index = parallel_thread_groups[group_entry];
+								const auto entity = thread_list.entities[group_index];
+
+								auto& thread_component = registry.get<EntityThreadComponent>(entity);
+
+								const auto entity_threads_updated = progress_entity_threads<target_cadence>(registry, entity, thread_component, thread_list.get_threads(group_index));
+
+								if (entity_threads_updated)
+								{
+									// NOTE: Component patches are deferred alongside other side effects,
+									// since they notify listeners that may not be thread-safe.
+									task.commands.emplace
+									(
+										[entity](Service& service)
+										{
+											service.get_registry().patch<EntityThreadComponent>(entity);
+										}
+									);
+
+									task.threads_updated += entity_threads_updated;
+								}
+
+								if (threads_are_dormant(thread_component))
+								{
+									// NOTE: Dormancy is checked again once this is executed, since
+									// previously flushed commands may have woken this entity's threads.
+									task.commands.emplace
+									(
+										[this, entity](Service& service)
+										{
+											try_sleep_entity_threads(service.get_registry(), entity);
+										}
+									);
+								}
 							}
 						}
+						catch (...)
+						{
+							Service::set_thread_command_buffer(previous_command_buffer);
 
-						const auto thread_source_index = thread_entry.thread_index;
-						const bool has_thread_source_index = (thread_source_index != ENTITY_THREAD_INDEX_INVALID);
+							throw;
+						}
 
-						// TODO: Look into making this more generic with an additional ID-based lookup as a fallback.
-						const EntityThreadDescription* thread_source = ((has_thread_source_index) && (descriptor))
-							? (&(descriptor->get_thread(thread_entry.thread_index)))
-							: nullptr
-						;
+						Service::set_thread_command_buffer(previous_command_buffer);
+					}
+				)
+			);
+		}
 
-						auto step = [&]()
-						{
-							const auto updated_instruction_index = step_thread
-							(
-								registry,
-								entity,
-								
-								// TODO: Make `descriptor` an optional pointer argument.
-								*descriptor,
-								thread_source,
+		// NOTE: Every task is awaited before handling exceptions, since
+		// the remaining tasks may still be modifying thread components.
+		auto task_exception = std::exception_ptr {};
 
-								thread_component,
-								thread_entry
-							);
+		for (auto& task_result : task_results)
+		{
+			try
+			{
+				task_result.get();
+			}
+			catch (...)
+			{
+				if (!task_exception)
+				{
+					task_exception = std::current_exception();
+				}
+			}
+		}
 
-							thread_entry.next_instruction = updated_instruction_index;
+		std::size_t threads_updated = 0; // EntityThreadCount
 
-							return updated_instruction_index;
-						};
+		auto& service = get_service();
 
-						const auto initial_thread_cadence = thread_entry.cadence;
+		// Dispatch side effects in entity order, regardless of which worker produced them.
+		// (Includes side effects captured by failed tasks prior to their exception)
+		for (std::size_t task_index = 0; task_index < task_count; task_index++)
+		{
+			auto& task = parallel_thread_tasks[task_index];
 
-						switch (initial_thread_cadence)
-						{
-							case EntityThreadCadence::Multi:
-								while (true)
-								{
-									const auto initial_instruction_index = thread_entry.next_instruction;
-									const auto updated_instruction_index = step();
+			task.commands.flush(service);
 
-									if (updated_instruction_index == initial_instruction_index)
-									{
-										break;
-									}
+			threads_updated += task.threads_updated;
+		}
 
-									if (thread_entry.is_suspended()) // is_complete
-									{
-										break;
-									}
+		parallel_thread_update_count += threads_updated;
 
-									bool is_implicit_yield_instruction = false;
+		if (task_exception)
+		{
+			std::rethrow_exception(task_exception);
+		}
 
-									if (thread_source)
-									{
-										const auto& current_instruction = thread_source->get_instruction(initial_instruction_index);
+		for (const auto group_index : serial_thread_groups)
+		{
+			threads_updated += progress_thread_group<target_cadence>(registry, thread_list, group_index);
+		}
 
-										// After handling a rewind instruction, pause execution until the next `progress_threads` call.
-										// (Ensures continuous loops don't stall the application)
-										switch (current_instruction.type_index())
-										{
-											case util::variant_index<EntityInstruction::InstructionType, Rewind>():
-											{
-												is_implicit_yield_instruction = true;
+		return threads_updated;
+	}
 
-												break;
-											}
+	template <EntityThreadCadence target_cadence>
+	std::size_t EntitySystem::progress_thread_group(Registry& registry, const CadenceThreadList& thread_list, std::size_t group_index) // EntityThreadCount
+	{
+		const auto entity = thread_list.entities[group_index];
 
-											case util::variant_index<EntityInstruction::InstructionType, CadenceControlBlock>():
-											{
-												const auto& cadence_control_block = std::get<CadenceControlBlock>(current_instruction.value);
+		// NOTE: Entities may have been destroyed since `thread_list` was built.
+		if (!registry.valid(entity))
+		{
+			return 0;
+		}
 
-												if (cadence_control_block.cadence != initial_thread_cadence)
-												{
-													is_implicit_yield_instruction = true;
-												}
+		auto* thread_component = registry.try_get<EntityThreadComponent>(entity);
 
-												break;
-											}
-										}
-									}
+		if (!thread_component)
+		{
+			return 0;
+		}
 
-									if (is_implicit_yield_instruction)
-									{
-										break;
-									}
-								}
+		const auto entity_threads_updated = progress_entity_threads<target_cadence>(registry, entity, *thread_component, thread_list.get_threads(group_index));
+
+		if (entity_threads_updated)
+		{
+			registry.patch<EntityThreadComponent>(entity);
+		}
+
+		// NOTE: Checked after patching, since patches wake the entity.
+		try_sleep_entity_threads(registry, entity);
+
+		return entity_threads_updated;
+	}
+
+	std::size_t EntitySystem::progress_realtime_threads(Registry& registry) // EntityThreadCount
+	{
+		const auto& thread_list = get_cadence_thread_list(EntityThreadCadence::Realtime);
+
+		std::size_t threads_updated = 0; // EntityThreadCount
+
+		realtime_thread_scheduler.begin_pass(thread_list.size());
+
+		while (const auto group_index = realtime_thread_scheduler.next_group())
+		{
+			threads_updated += progress_thread_group<EntityThreadCadence::Realtime>(registry, thread_list, *group_index);
+		}
+
+		realtime_thread_scheduler.end_pass(threads_updated);
+
+		return threads_updated;
+	}
+
+	template <EntityThreadCadence target_cadence>
+	bool EntitySystem::can_progress_threads_in_parallel(Registry& registry, Entity entity, const EntityThreadComponent& thread_component, LocalThreadIndices local_thread_indices) const
+	{
+		// Multi-instruction execution relies on commands being handled immediately.
+		if constexpr (target_cadence == EntityThreadCadence::Multi)
+		{
+			return false;
+		}
+
+		const auto instance_component = registry.try_get<InstanceComponent>(entity);
 
+		const EntityDescriptor* descriptor = (instance_component)
+			? (&(instance_component->get_descriptor()))
+			: nullptr
+		;
+
+		for (const auto local_thread_index : local_thread_indices)
+		{
+			if (local_thread_index >= thread_component.threads.size())
+			{
+				continue;
+			}
+
+			const auto& thread_entry = thread_component.threads[local_thread_index];
+
+			if (thread_entry.cadence != target_cadence)
+			{
+				continue;
+			}
+
+			// Fibers execute arbitrary script code, and resuming a sleeping fiber evaluates its yield predicate.
+			if (thread_entry.has_fiber())
+			{
+				return false;
+			}
+
+			if ((!descriptor) || (thread_entry.thread_index == ENTITY_THREAD_INDEX_INVALID))
+			{
+				continue;
+			}
+
+			const auto& thread_source = descriptor->get_thread(thread_entry.thread_index);
+
+			if (thread_entry.next_instruction >= thread_source.instructions.size())
+			{
+				continue;
+			}
+
+			// NOTE: Outside of the multi-cadence (handled above), each thread executes exactly one instruction per update,
+			// meaning that `next_instruction` is the entire run this thread could execute during this pass.
+			// 
+			// Serial-only instructions include multi/cadence control blocks, non-local variable access,
+			// and anything evaluating reflected expressions. (e.g. function calls and conditions)
+			if (thread_source.get_bytecode_instruction(thread_entry.next_instruction).is_serial_only())
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	template <EntityThreadCadence target_cadence>
+	std::size_t EntitySystem::progress_entity_threads(Registry& registry, Entity entity, EntityThreadComponent& thread_component, LocalThreadIndices local_thread_indices) // EntityThreadCount
+	{
+		using namespace engine::instructions;
+
+		const auto instance_component = registry.try_get<InstanceComponent>(entity);
+
+		// TODO: Allow `EntityThreadComponent` to work without `InstanceComponent`, then remove this assert.
+		assert(instance_component);
+
+		const EntityDescriptor* descriptor = (instance_component)
+			? (&(instance_component->get_descriptor()))
+			: nullptr
+		;
+
+		std::size_t threads_updated = 0; // EntityThreadCount
+
+		for (const auto local_thread_index : local_thread_indices)
+		{
+			// NOTE: Threads may have been erased since this list of indices was built.
+			if (local_thread_index >= thread_component.threads.size())
+			{
+				continue;
+			}
+
+			auto& thread_entry = thread_component.threads[local_thread_index];
+
+			// NOTE: Threads may change cadence after being listed.
+			if (thread_entry.cadence == target_cadence)
+			{
+				if (thread_entry.is_suspended()) // || thread_entry.is_complete (implied)
+				{
+					if (!try_resume_thread(thread_entry))
+					{
+						continue;
+					}
+				}
+
+				const auto thread_source_index = thread_entry.thread_index;
+				const bool has_thread_source_index = (thread_source_index != ENTITY_THREAD_INDEX_INVALID);
+
+				// TODO: Look into making this more generic with an additional ID-based lookup as a fallback.
+				const EntityThreadDescription* thread_source = ((has_thread_source_index) && (descriptor))
+					? (&(descriptor->get_thread(thread_entry.thread_index)))
+					: nullptr
+				;
+
+				auto step = [&]()
+				{
+					const auto updated_instruction_index = step_thread
+					(
+						registry,
+						entity,
+						
+						// TODO: Make `descriptor` an optional pointer argument.
+						*descriptor,
+						thread_source,
+
+						thread_component,
+						thread_entry
+					);
+
+					thread_entry.next_instruction = updated_instruction_index;
+
+					return updated_instruction_index;
+				};
+
+				const auto initial_thread_cadence = thread_entry.cadence;
+
+				// Set if this thread is preempted by the realtime budget.
+				bool is_preempted = false;
+
+				switch (initial_thread_cadence)
+				{
+					case EntityThreadCadence::Multi:
+						while (true)
+						{
+							const auto initial_instruction_index = thread_entry.next_instruction;
+							const auto updated_instruction_index = step();
+
+							if (updated_instruction_index == initial_instruction_index)
+							{
 								break;
+							}
 
-							default:
-								step();
+							if (thread_entry.is_suspended()) // is_complete
+							{
+								break;
+							}
 
+							// After handling a rewind or cadence change, pause execution until the next `progress_threads` call.
+							// (Ensures continuous loops don't stall the application)
+							const bool is_implicit_yield_instruction =
+							(
+								(thread_source)
+								&& (thread_source->get_bytecode_instruction(initial_instruction_index).is_implicit_yield())
+							);
+
+							if (is_implicit_yield_instruction)
+							{
 								break;
+							}
+
+							if constexpr (target_cadence == EntityThreadCadence::Multi)
+							{
+								// Once the realtime budget has been exhausted, the remaining work
+								// is carried over to the next update. (See `set_realtime_thread_budget`)
+								if (realtime_thread_scheduler.deadline_reached())
+								{
+									realtime_thread_scheduler.on_thread_preempted();
+
+									is_preempted = true;
+
+									break;
+								}
+							}
 						}
 
-						threads_updated++;
+						break;
 
-						if (thread_entry.is_complete)
-						{
-							if (auto local_thread_index = thread_component.get_local_index(thread_entry))
-							{
-								service->event<OnThreadComplete> // queue_event
-								(
-									entity,
+					default:
+						step();
+
+						break;
+				}
+
+				threads_updated++;
 
-									thread_entry.thread_index,
-									thread_entry.thread_id,
+				if (thread_entry.is_complete)
+				{
+					if (auto local_thread_index = thread_component.get_local_index(thread_entry))
+					{
+						service->event<OnThreadComplete> // queue_event
+						(
+							entity,
 
-									static_cast<OnThreadComplete::LocalThreadIndex>(*local_thread_index),
+							thread_entry.thread_index,
+							thread_entry.thread_id,
 
-									thread_entry.next_instruction
-								);
-							}
-						}
+							static_cast<OnThreadComplete::LocalThreadIndex>(*local_thread_index),
 
-						has_updated_thread = true;
+							thread_entry.next_instruction
+						);
 					}
 				}
-
-				if (has_updated_thread)
+				else if (is_preempted)
 				{
-					registry.patch<EntityThreadComponent>(entity);
+					if (auto local_thread_index = thread_component.get_local_index(thread_entry))
+					{
+						service->event<OnThreadBudgetExceeded> // queue_event
+						(
+							entity,
+
+							thread_entry.thread_index,
+							thread_entry.thread_id,
+
+							static_cast<OnThreadBudgetExceeded::LocalThreadIndex>(*local_thread_index),
+
+							thread_entry.next_instruction
+						);
+					}
 				}
 			}
-		);
+		}
 
 		return threads_updated;
 	}
@@ -1705,6 +2508,15 @@ namespace engine
 				// Return the last valid instruction.
 				return thread.next_instruction;
 			}
+
+			// Instructions with a dedicated opcode bypass the general-purpose interpreter below.
+			if (!thread.active_fiber.exists())
+			{
+				if (const auto updated_instruction_index = try_step_thread_bytecode(registry, entity, descriptor, *source, thread_comp, thread))
+				{
+					return *updated_instruction_index;
+				}
+			}
 		}
 
 		auto& service = get_service();
@@ -1890,32 +2702,9 @@ namespace engine
 			);
 		};
 
-		auto resolve_thread_instruction = [this, &registry, &descriptor, entity, thread_index, thread_id](const auto& thread_instruction) -> std::tuple<Entity, EntityThreadTarget>
+		auto resolve_thread_instruction = [this, &registry, entity, &thread](const auto& thread_instruction) -> std::tuple<Entity, EntityThreadTarget>
 		{
-			const auto target_entity = thread_instruction.target_entity.get(registry, entity);
-			
-			EntityThreadTarget target_thread = thread_instruction.thread_id;
-
-			if (target_entity == entity)
-			{
-				if (!target_thread)
-				{
-					if (thread_id)
-					{
-						target_thread = thread_id;
-					}
-
-					if (!target_thread)
-					{
-						if (thread_index != ENTITY_THREAD_INDEX_INVALID)
-						{
-							target_thread = EntityThreadRange { thread_index, 1 };
-						}
-					}
-				}
-			}
-
-			return { target_entity, target_thread };
+			return resolve_thread_instruction_target(registry, entity, thread, thread_instruction);
 		};
 
 		auto control_flow_command = [&service, entity, &resolve_thread_instruction] <typename CommandType>
@@ -2049,8 +2838,49 @@ namespace engine
 			return false;
 		};
 
-		auto start_listening = [this, entity](auto type_id) -> bool
+		auto start_listening = [this, entity, &thread_comp, &thread](auto type_id, std::optional<EntityListener::EventFilter> filter=std::nullopt) -> bool
 		{
+			const auto local_index = thread_comp.get_local_index(thread);
+
+			assert(local_index);
+
+			if (!local_index)
+			{
+				return false;
+			}
+
+			const auto waiting_thread = EntityListener::WaitingThread
+			{
+				.entity = entity,
+				.local_thread_index = *local_index,
+				.thread_index = thread.thread_index,
+				.thread_id = thread.thread_id,
+				.filter = filter
+			};
+
+			// NOTE: Listener registration is not thread-safe, and is therefore
+			// deferred while threads are being progressed in parallel.
+			if (auto command_buffer = Service::get_thread_command_buffer())
+			{
+				if (!type_id)
+				{
+					return false;
+				}
+
+				command_buffer->emplace
+				(
+					[this, type_id, waiting_thread](Service& service)
+					{
+						if (auto listener = listen(type_id))
+						{
+							listener->add_waiting_thread(waiting_thread);
+						}
+					}
+				);
+
+				return true;
+			}
+
 			auto listener = listen(type_id);
 								
 			if (!listener)
@@ -2063,8 +2893,8 @@ namespace engine
 				return false;
 			}
 
-			// See `EntityListener::update_entity` for corresponding `remove_entity` usage.
-			listener->add_entity(entity);
+			// See `EntityListener::on_event` for corresponding removal.
+			listener->add_waiting_thread(waiting_thread);
 
 			return true;
 		};
@@ -2218,19 +3048,25 @@ namespace engine
 
 						bool yielded_successfully = false;
 
+						// Simple comparisons (e.g. against a button ID) allow the listener to skip unrelated events.
+						const auto filter = (std::holds_alternative<EventTriggerSingleCondition>(condition_raw.value))
+							? EntityListener::make_event_filter(std::get<EventTriggerSingleCondition>(condition_raw.value))
+							: std::nullopt
+						;
+
 						EventTriggerConditionType::visit_type_enabled
 						(
 							condition_raw,
 
-							[this, entity, &descriptor, &start_listening, &yielded_successfully](const auto& condition)
+							[this, entity, &descriptor, &start_listening, &filter, &yielded_successfully](const auto& condition)
 							{
 								condition.enumerate_types
 								(
 									descriptor,
 
-									[this, entity, &start_listening, &yielded_successfully](MetaTypeID type_id)
+									[this, entity, &start_listening, &filter, &yielded_successfully](MetaTypeID type_id)
 									{
-										if (start_listening(type_id))
+										if (start_listening(type_id, filter))
 										{
 											yielded_successfully = true;
 										}
@@ -2342,7 +3178,7 @@ namespace engine
 						}
 					},
 
-					[&instruct, &thread](const CadenceControlBlock& control_block)
+					[this, entity, &instruct, &thread](const CadenceControlBlock& control_block)
 					{
 						switch (control_block.cadence)
 						{
@@ -2358,12 +3194,12 @@ namespace engine
 									);
 								}
 
-								thread.cadence = EntityThreadCadence::Multi; // control_block.cadence;
+								set_thread_cadence(entity, thread, EntityThreadCadence::Multi); // control_block.cadence;
 
 								break;
 
 							default:
-								thread.cadence = control_block.cadence;
+								set_thread_cadence(entity, thread, control_block.cadence);
 
 								break;
 						}
@@ -2426,13 +3262,13 @@ namespace engine
 						}
 					},
 
-					[&registry, &service, &system_manager, entity, &descriptor, &thread, &thread_comp, thread_index, &get_variable_context](const VariableAssignment& variable_assignment)
+					[this, &registry, &service, &system_manager, entity, &descriptor, &thread, &thread_comp, thread_index, &get_variable_context](const VariableAssignment& variable_assignment)
 					{
 						auto& source_descriptor = descriptor;
 
-						auto as_remote_variable = [source=entity, &service, &system_manager, &registry, &variable_assignment, &source_descriptor, &get_variable_context]()
+						auto as_remote_variable = [this, source=entity, &service, &system_manager, &registry, &thread, &variable_assignment, &source_descriptor, &get_variable_context]()
 						{
-							const auto& target = variable_assignment.target_entity.resolve(registry, source);
+							const auto target = thread.target_cache.resolve(registry, source, variable_assignment.target_entity, get_target_cache_generations());
 
 							if (target == null)
 							{
@@ -2962,4 +3798,325 @@ namespace engine
 		// Return the next instruction index to the caller.
 		return updated_instruction_index;
 	}
+
+	std::optional<EntityInstructionIndex> EntitySystem::try_step_thread_bytecode
+	(
+		Registry& registry,
+		Entity entity,
+
+		const EntityDescriptor& descriptor,
+		const EntityThreadDescription& source,
+
+		EntityThreadComponent& thread_comp,
+		EntityThread& thread
+	)
+	{
+		using namespace instructions;
+
+		if (!source.has_bytecode())
+		{
+			return std::nullopt;
+		}
+
+		const auto instruction_index = thread.next_instruction;
+		const auto& bytecode_instruction = source.bytecode[instruction_index];
+
+		// NOTE: Relative to `thread.next_instruction` after execution, since commands
+		// triggered immediately may reposition this thread. (e.g. skipping)
+		EntityInstructionCount step_stride = 1;
+
+		// Resolves the target of the source instruction, reading it only if the executing thread isn't targeted.
+		auto resolve_target = [this, &registry, entity, &source, &thread, &bytecode_instruction, instruction_index]
+		<typename InstructionType>() -> std::tuple<Entity, EntityThreadTarget>
+		{
+			if (bytecode_instruction.is_local_target())
+			{
+				return { entity, get_executing_thread_target(thread) };
+			}
+
+			const auto& thread_instruction = std::get<InstructionType>(source.get_instruction(instruction_index).value);
+
+			return resolve_thread_instruction_target(registry, entity, thread, thread_instruction);
+		};
+
+		// Handles instructions forwarded to thread commands, matching the behavior of `step_thread`.
+		auto thread_command = [this, &resolve_target, entity]
+		<typename CommandType, typename InstructionType>(bool defer_event, auto&&... additional_args) -> bool
+		{
+			const auto [target_entity, target_thread] = resolve_target.template operator()<InstructionType>();
+
+			assert(target_thread);
+
+			if (!target_thread)
+			{
+				return false;
+			}
+
+			auto& service = get_service();
+
+			auto command = CommandType
+			{
+				entity, target_entity,
+
+				std::move(target_thread),
+
+				std::forward<decltype(additional_args)>(additional_args)...
+			};
+
+			if (defer_event)
+			{
+				service.queue_event(std::move(command));
+			}
+			else
+			{
+				service.event(std::move(command));
+			}
+
+			return true;
+		};
+
+		switch (bytecode_instruction.opcode)
+		{
+			case EntityThreadOpcode::NoOp:
+				break;
+
+			case EntityThreadOpcode::Link:
+			{
+				const auto local_index = thread_comp.get_local_index(thread);
+
+				assert(local_index);
+
+				if (local_index)
+				{
+					auto result = thread_comp.link_local_thread(*local_index);
+
+					assert(result);
+				}
+
+				break;
+			}
+
+			case EntityThreadOpcode::SetCadence:
+				set_thread_cadence(entity, thread, bytecode_instruction.cadence);
+
+				break;
+
+			case EntityThreadOpcode::BranchIfNot:
+			{
+				const auto& control_block = std::get<IfControlBlock>(source.get_instruction(instruction_index).value);
+
+				auto& service = get_service();
+
+				auto variable_context = resolve_variable_context(&service, &registry, entity, &thread_comp, &thread);
+
+				const auto result = EventTriggerConditionType::get_condition_status
+				(
+					control_block.condition.get(descriptor),
+
+					MetaAny {},
+
+					registry, entity,
+
+					MetaEvaluationContext
+					{
+						.variable_context = &variable_context,
+						.service = &service,
+						.system_manager = system_manager
+					}
+				);
+
+				if (!result)
+				{
+					// Jump over the body of the if-block.
+					step_stride = static_cast<EntityInstructionCount>(bytecode_instruction.operand - instruction_index);
+				}
+
+				break;
+			}
+
+			case EntityThreadOpcode::Sleep:
+			{
+				const auto [target_entity, target_thread] = resolve_target.template operator()<Sleep>();
+
+				assert(target_thread);
+
+				if (!target_thread)
+				{
+					break;
+				}
+
+				const auto& sleep = std::get<Sleep>(source.get_instruction(instruction_index).value);
+
+				auto& service = get_service();
+
+				// NOTE: This event must happen immediately to ensure compatibility with multi-instructions.
+				service.event<EntityThreadPauseCommand>
+				(
+					entity, target_entity,
+
+					target_thread,
+
+					bytecode_instruction.check_linked()
+				);
+
+				service.timed_event<EntityThreadResumeCommand>
+				(
+					sleep.duration,
+
+					entity, target_entity,
+
+					target_thread,
+
+					bytecode_instruction.check_linked()
+				);
+
+				break;
+			}
+
+			case EntityThreadOpcode::Skip:
+				thread_command.template operator()<EntityThreadSkipCommand, Skip>(false, bytecode_instruction.check_linked(), bytecode_instruction.operand);
+
+				break;
+
+			case EntityThreadOpcode::Rewind:
+			{
+				const auto [target_entity, target_thread] = resolve_target.template operator()<Rewind>();
+
+				assert(target_thread);
+
+				if (!target_thread)
+				{
+					break;
+				}
+
+				// Rewinding the executing thread positions it directly.
+				if ((target_entity == entity) && ((bytecode_instruction.is_local_target()) || (!std::get<Rewind>(source.get_instruction(instruction_index).value).thread_id)))
+				{
+					step_stride = 0;
+				}
+
+				get_service().event<EntityThreadRewindCommand>
+				(
+					entity, target_entity,
+
+					target_thread,
+
+					bytecode_instruction.check_linked(),
+					bytecode_instruction.operand
+				);
+
+				break;
+			}
+
+			case EntityThreadOpcode::Start:
+				thread_command.template operator()<EntityThreadSpawnCommand, Start>(true, static_cast<bool>(bytecode_instruction.operand));
+
+				break;
+
+			case EntityThreadOpcode::Stop:
+			{
+				const auto [target_entity, target_thread] = resolve_target.template operator()<Stop>();
+
+				assert(target_thread);
+
+				if (!target_thread)
+				{
+					break;
+				}
+
+				// Force-pause while awaiting the 'stop' command's execution. (See `step_thread`)
+				if (target_entity == entity)
+				{
+					if ((target_thread == thread.thread_id) || (target_thread == EntityThreadRange { thread.thread_index, 1 }))
+					{
+						thread.pause();
+					}
+				}
+
+				get_service().queue_event<EntityThreadStopCommand>
+				(
+					entity, target_entity,
+
+					target_thread,
+
+					bytecode_instruction.check_linked()
+				);
+
+				break;
+			}
+
+			// NOTE: Pause and resume commands are triggered immediately to remain compatible with multi-instructions.
+			case EntityThreadOpcode::Pause:
+				thread_command.template operator()<EntityThreadPauseCommand, Pause>(false, bytecode_instruction.check_linked());
+
+				break;
+
+			case EntityThreadOpcode::Resume:
+				thread_command.template operator()<EntityThreadResumeCommand, Resume>(false, bytecode_instruction.check_linked());
+
+				break;
+
+			case EntityThreadOpcode::TransitionState:
+			{
+				const auto& transition = std::get<EntityStateTransitionAction>(source.get_instruction(instruction_index).value);
+
+				// Equivalent to `execute_action`, without a delay.
+				get_service().queue_event<StateChangeCommand>(entity, entity, transition.state_name);
+
+				break;
+			}
+
+			default:
+				return std::nullopt;
+		}
+
+		const auto updated_instruction_index = static_cast<EntityInstructionIndex>(thread.next_instruction + step_stride);
+
+		// NOTE: Completion rules match those used by `step_thread`.
+		if ((!thread.is_suspended()) && (updated_instruction_index >= source.instructions.size()))
+		{
+			thread.is_complete = true;
+		}
+		else
+		{
+			thread.next_instruction = updated_instruction_index;
+		}
+
+		return updated_instruction_index;
+	}
+
+	std::tuple<Entity, EntityThreadTarget> EntitySystem::resolve_thread_instruction_target
+	(
+		Registry& registry,
+		Entity entity,
+		EntityThread& thread,
+		const EntityThreadInstruction& thread_instruction
+	)
+	{
+		const auto target_entity = thread.target_cache.resolve(registry, entity, thread_instruction.target_entity, get_target_cache_generations());
+
+		EntityThreadTarget target_thread = thread_instruction.thread_id;
+
+		if ((target_entity == entity) && (!target_thread))
+		{
+			target_thread = get_executing_thread_target(thread);
+		}
+
+		return { target_entity, target_thread };
+	}
+
+	EntityThreadTarget EntitySystem::get_executing_thread_target(const EntityThread& thread)
+	{
+		if (thread.thread_id)
+		{
+			return thread.thread_id;
+		}
+
+		if (thread.thread_index != ENTITY_THREAD_INDEX_INVALID)
+		{
+			return EntityThreadRange { thread.thread_index, 1 };
+		}
+
+		return {};
+	}
 }
\ No newline at end of file
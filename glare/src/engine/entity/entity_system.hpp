@@ -2,6 +2,8 @@
 
 #include "entity_listener.hpp"
 #include "entity_thread_cadence.hpp"
+#include "entity_target_cache.hpp"
+#include "realtime_thread_scheduler.hpp"
 
 #include <engine/types.hpp>
 #include <engine/basic_system.hpp>
@@ -13,7 +15,19 @@
 
 #include <string_view>
 #include <optional>
+#include <tuple>
 #include <unordered_map>
+#include <vector>
+#include <array>
+#include <span>
+#include <memory>
+#include <chrono>
+#include <cstddef>
+
+namespace concurrencpp
+{
+	class runtime;
+}
 
 namespace engine
 {
@@ -52,6 +66,8 @@ namespace engine
 	struct EntityThreadFiberSpawnCommand;
 
 	struct EntityThread;
+	struct EntityThreadTarget;
+	struct EntityThreadInstruction;
 	struct EntityThreadDescription;
 	struct EntityThreadComponent;
 	struct EntityInstruction;
@@ -90,6 +106,59 @@ namespace engine
 				bool subscribe_immediately=false
 			);
 
+			~EntitySystem();
+
+			// The default minimum number of eligible entities required to progress threads in parallel.
+			static constexpr std::size_t DEFAULT_PARALLEL_THREAD_THRESHOLD = 256;
+
+			// Enables parallel progression of entity threads using `worker_count` worker threads.
+			// A `worker_count` of zero disables parallel progression. (Default)
+			// 
+			// Threads are only progressed in parallel once at least `min_parallel_entities` entities are eligible.
+			// 
+			// Events raised by entity threads during the parallel phase are captured in per-task command buffers,
+			// then dispatched (along with component patches) in entity order once every task has completed.
+			// This keeps the order of side effects independent of how tasks were scheduled.
+			// 
+			// NOTE: Entities executing instructions that depend on immediate side effects (multi-instructions, cadence changes),
+			// shared state (non-local variables) or reflected code (function calls, coroutines, conditions, assignments)
+			// are progressed serially, once parallel side effects have been dispatched.
+			void set_parallel_thread_execution(std::size_t worker_count, std::size_t min_parallel_entities=DEFAULT_PARALLEL_THREAD_THRESHOLD);
+
+			// Retrieves the number of worker threads used to progress entity threads. (See `set_parallel_thread_execution`)
+			std::size_t get_parallel_thread_worker_count() const;
+
+			// Retrieves the total number of thread updates performed by worker tasks, rather than serially.
+			std::size_t get_parallel_thread_update_count() const;
+
+			using RealtimeThreadStatistics = RealtimeThreadScheduler::Statistics;
+
+			// Limits the time spent progressing `EntityThreadCadence::Realtime` threads during each update.
+			// A `budget` of zero disables this limit. (Default)
+			// 
+			// Realtime threads are scheduled cooperatively: once the budget has been exhausted, the executing thread
+			// is preempted between instructions and the remaining entities are deferred. Unfinished work resumes on the next update,
+			// beginning with the entity following the last one progressed. (Round-robin; see `RealtimeThreadScheduler`)
+			// 
+			// Preempted threads are reported via `OnThreadBudgetExceeded`.
+			// 
+			// NOTE: Each thread visited during an update executes at least one instruction, meaning that
+			// the budget may be exceeded by one instruction for each thread of the last entity progressed.
+			void set_realtime_thread_budget(std::chrono::microseconds budget);
+
+			std::chrono::microseconds get_realtime_thread_budget() const;
+
+			// Retrieves a summary of the most recent update of `EntityThreadCadence::Realtime` threads.
+			const RealtimeThreadStatistics& get_realtime_thread_statistics() const;
+
+			// Retrieves the number of threads scheduled to be progressed with `cadence`, as of the most recent update.
+			// 
+			// NOTE: Threads of sleeping entities are not scheduled. (See `ActiveThreadsComponent`)
+			std::size_t get_scheduled_thread_count(EntityThreadCadence cadence) const;
+
+			// Retrieves the number of threads of `entity` scheduled to be progressed with `cadence`, as of the most recent update.
+			std::size_t get_scheduled_thread_count(EntityThreadCadence cadence, Entity entity) const;
+
 			std::optional<EntityStateIndex> get_state_index(Entity entity) const;
 			std::optional<EntityStateIndex> get_prev_state_index(Entity entity) const;
 
@@ -107,11 +176,40 @@ namespace engine
 			EntityListener* listen(MetaTypeID event_type_id);
 			EntityListener* listen(const MetaType& event_type);
 
+			// Invalidates every entity target resolved and cached by thread instances. (See `EntityTargetCache`)
+			// 
+			// Targets are invalidated by name automatically when entities are renamed,
+			// re-parented or removed from a hierarchy. (See `invalidate_target_caches(Registry&, Entity)`)
+			void invalidate_target_caches();
+
+			// Invalidates cached entity targets referring to the names of `entity` and its descendants.
+			void invalidate_target_caches(Registry& registry, Entity entity);
+
+			inline const EntityTargetCache::Generations& get_target_cache_generations() const
+			{
+				return target_cache_generations;
+			}
+
 		protected:
 			std::unordered_map<MetaTypeID, EntityListener> listeners;
 
 			SystemManagerInterface* system_manager = nullptr;
 
+			// Worker pool used to progress entity threads in parallel. (See `set_parallel_thread_execution`)
+			std::unique_ptr<concurrencpp::runtime> thread_pool;
+
+			std::size_t parallel_thread_worker_count = 0;
+			std::size_t parallel_thread_threshold = DEFAULT_PARALLEL_THREAD_THRESHOLD;
+
+			// See `get_parallel_thread_update_count`.
+			std::size_t parallel_thread_update_count = 0;
+
+			// Advanced by name whenever cached entity targets may no longer be accurate. (See `invalidate_target_caches`)
+			// 
+			// NOTE: Read by worker threads during parallel thread progression. This is safe, since names
+			// and relationships can only change from the main thread. (See `EntityThreadBytecodeInstruction::SerialOnly`)
+			EntityTargetCache::Generations target_cache_generations;
+
 			// Used internally by `on_state_activation_command` for 'delayed activation' behavior.
 			bool activate_state(Entity entity, StringHash state_id) const;
 
@@ -130,9 +228,15 @@ namespace engine
 			void on_state_update(Registry& registry, Entity entity);
 			void on_state_destroyed(Registry& registry, Entity entity);
 
+			// Unregisters an entity deactivated by an `EntityPool` from every listener. (See `PooledEntityComponent`)
+			void on_entity_pooled(Registry& registry, Entity entity);
+
 			void on_state_change(const OnStateChange& state_change);
 			void on_state_activate(const OnStateActivate& state_activate);
 
+			// Ensures that threads are progressed after `EntityThreadComponent` is created or patched. (See `ActiveThreadsComponent`)
+			void on_entity_threads_wake(Registry& registry, Entity entity);
+
 			void on_entity_threads_updated_generate_delayed_event(Registry& registry, Entity entity);
 			void on_entity_threads_updated(const OnEntityThreadsUpdated& update_event);
 
@@ -158,6 +262,12 @@ namespace engine
 			void on_component_destroy(const OnComponentDestroy& component_details);
 
 			void on_parent_changed(const OnParentChanged& parent_changed);
+
+			// Invalidates cached entity targets when a name is assigned, changed or removed.
+			void on_target_name_changed(Registry& registry, Entity entity);
+
+			// Invalidates cached entity targets referring to an entity removed from a hierarchy.
+			void on_target_relationship_destroyed(Registry& registry, Entity entity);
 			
 			void on_context_init(Registry& registry, Entity entity);
 			void realign_child_contexts(Registry& registry, Entity entity, EntityContextComponent& context_comp, const RelationshipComponent& relationship_comp);
@@ -179,15 +289,210 @@ namespace engine
 				EntityThreadComponent& thread_comp,
 				EntityThread& thread
 			);
+
+			// Executes the next instruction of `thread` directly from `source`'s bytecode, if possible.
+			// 
+			// If the instruction requires the general-purpose interpreter (see `step_thread`),
+			// this returns `std::nullopt` without modifying `thread`.
+			std::optional<EntityInstructionIndex> try_step_thread_bytecode
+			(
+				Registry& registry,
+				Entity entity,
+
+				const EntityDescriptor& descriptor,
+				const EntityThreadDescription& source,
+
+				EntityThreadComponent& thread_comp,
+				EntityThread& thread
+			);
+
+			// Resolves the entity and thread targeted by `thread_instruction`, executed by `thread`.
+			// 
+			// If the instruction targets `entity` without specifying a thread ID,
+			// the executing thread is targeted. (See `get_executing_thread_target`)
+			std::tuple<Entity, EntityThreadTarget> resolve_thread_instruction_target
+			(
+				Registry& registry,
+				Entity entity,
+				EntityThread& thread,
+				const EntityThreadInstruction& thread_instruction
+			);
+
+			// Retrieves the target used by thread instructions to refer to the executing `thread`.
+			static EntityThreadTarget get_executing_thread_target(const EntityThread& thread);
 		private:
+			struct ParallelThreadTask;
+
+			// Threads of a single cadence, grouped by entity.
+			// 
+			// The threads of `entities[i]` are the local indices found in `local_thread_indices[i]`.
+			// Entities are added and removed individually as their threads change. (See `update_entity_thread_lists`)
+			struct CadenceThreadList
+			{
+				using LocalThreadIndex = std::size_t; // EntityThreadComponent::LocalThreadIndex
+				using LocalThreadIndexContainer = util::small_vector<LocalThreadIndex, 4>;
+
+				std::vector<Entity> entities;
+				std::vector<LocalThreadIndexContainer> local_thread_indices;
+
+				// Maps each listed entity to its position in `entities`.
+				std::unordered_map<Entity, std::size_t> group_indices;
+
+				// Retrieves the number of entities in this list.
+				inline std::size_t size() const
+				{
+					return entities.size();
+				}
+
+				inline std::span<const LocalThreadIndex> get_threads(std::size_t group_index) const
+				{
+					const auto& threads = local_thread_indices[group_index];
+
+					return { threads.data(), threads.size() };
+				}
+
+				// Retrieves the threads listed for `entity`, if any.
+				inline std::span<const LocalThreadIndex> get_entity_threads(Entity entity) const
+				{
+					if (const auto it = group_indices.find(entity); it != group_indices.end())
+					{
+						return get_threads(it->second);
+					}
+
+					return {};
+				}
+
+				// Lists `local_thread_index` under `entity`, adding a group for `entity` if needed.
+				void add_thread(Entity entity, LocalThreadIndex local_thread_index);
+
+				// Removes the group for `entity`, moving the last group into its position.
+				// 
+				// The return-value of this function indicates whether `entity` was listed.
+				bool remove_entity(Entity entity);
+
+				// Retrieves the total number of threads listed.
+				std::size_t thread_count() const;
+
+				inline void clear()
+				{
+					entities.clear();
+					local_thread_indices.clear();
+					group_indices.clear();
+				}
+			};
+
+			using LocalThreadIndices = std::span<const CadenceThreadList::LocalThreadIndex>;
+
+			// Number of distinct `EntityThreadCadence` values. (See `cadence_thread_lists`)
+			static constexpr std::size_t CADENCE_COUNT = (static_cast<std::size_t>(EntityThreadCadence::Realtime) + 1);
+
+			// Number of tasks scheduled per worker thread during parallel thread progression.
+			static constexpr std::size_t PARALLEL_THREAD_TASKS_PER_WORKER = 4;
+
 			bool try_resume_thread(EntityThread& thread);
 
+			// Changes the cadence of `thread` (owned by `entity`), invalidating its entry in `cadence_thread_lists` if needed.
+			void set_thread_cadence(Entity entity, EntityThread& thread, EntityThreadCadence cadence);
+
+			// Indicates whether every thread in `thread_component` is waiting on an external signal.
+			// (i.e. a thread command, an event delivered by `EntityListener`, etc.)
+			// 
+			// NOTE: Paused script threads with a yield-continuation predicate are not dormant,
+			// since their predicate is polled each update. (See `try_resume_thread`)
+			static bool threads_are_dormant(const EntityThreadComponent& thread_component);
+
+			// Stops progressing the threads of `entity` if they are dormant, until they are woken again.
+			// (See `wake_entity_threads`)
+			// 
+			// The return-value of this function indicates whether `entity` was put to sleep.
+			bool try_sleep_entity_threads(Registry& registry, Entity entity);
+
+			// Marks the entries of `entity` in `cadence_thread_lists` as out-of-date.
+			// This must be called whenever threads of `entity` are spawned, stopped, erased, change cadence, or are woken/put to sleep.
+			// 
+			// NOTE: Changes are applied at the beginning of the next `progress_threads` call. (See `refresh_cadence_thread_lists`)
+			inline void invalidate_entity_thread_lists(Entity entity)
+			{
+				pending_thread_list_entities.emplace_back(entity);
+			}
+
+			// Marks every entry of `cadence_thread_lists` as out-of-date, forcing a full rebuild.
+			inline void invalidate_cadence_thread_lists()
+			{
+				cadence_thread_lists_dirty = true;
+			}
+
+			void on_active_threads_changed(Registry& registry, Entity entity);
+
+			// Applies changes recorded by `invalidate_entity_thread_lists`, or rebuilds
+			// `cadence_thread_lists` entirely if `invalidate_cadence_thread_lists` was called.
+			void refresh_cadence_thread_lists(Registry& registry);
+
+			void rebuild_cadence_thread_lists(Registry& registry);
+
+			// Removes `entity` from `cadence_thread_lists`, then lists each of its active threads under their current cadence.
+			void update_entity_thread_lists(Registry& registry, Entity entity);
+
+			// Lists every thread of `entity`, assuming that it is not currently listed.
+			void add_entity_thread_lists(Entity entity, const EntityThreadComponent& thread_component);
+
+			inline const CadenceThreadList& get_cadence_thread_list(EntityThreadCadence cadence) const
+			{
+				return cadence_thread_lists[static_cast<std::size_t>(cadence)];
+			}
+
+			// Progresses each cadence in `target_cadence` in order, returning the number of threads updated.
 			template <EntityThreadCadence... target_cadence>
 			std::size_t progress_threads(); // EntityThreadCount
 
+			template <EntityThreadCadence target_cadence>
+			std::size_t progress_cadence_threads(Registry& registry); // EntityThreadCount
+
+			template <EntityThreadCadence target_cadence>
+			std::size_t progress_threads_serial(Registry& registry); // EntityThreadCount
+
+			template <EntityThreadCadence target_cadence>
+			std::size_t progress_threads_parallel(Registry& registry); // EntityThreadCount
+
+			// Progresses `EntityThreadCadence::Realtime` threads within the budget set by `set_realtime_thread_budget`.
+			std::size_t progress_realtime_threads(Registry& registry); // EntityThreadCount
+
+			// Progresses the threads listed for the entity at `group_index` of `thread_list`, marking them as patched if needed.
+			template <EntityThreadCadence target_cadence>
+			std::size_t progress_thread_group(Registry& registry, const CadenceThreadList& thread_list, std::size_t group_index); // EntityThreadCount
+
+			// Progresses the threads of `entity` found in `local_thread_indices`, returning the number of threads updated.
+			// 
+			// NOTE: This does not mark `thread_component` as patched.
+			template <EntityThreadCadence target_cadence>
+			std::size_t progress_entity_threads(Registry& registry, Entity entity, EntityThreadComponent& thread_component, LocalThreadIndices local_thread_indices); // EntityThreadCount
+
+			// Determines if the threads of `entity` found in `local_thread_indices` can be safely progressed on a worker thread.
+			template <EntityThreadCadence target_cadence>
+			bool can_progress_threads_in_parallel(Registry& registry, Entity entity, const EntityThreadComponent& thread_component, LocalThreadIndices local_thread_indices) const;
+
 			template <bool allow_emplace, typename EventType=void, typename ThreadCommandType=void, typename RangeCallback=void, typename IDCallback=void, typename ...EventArgs>
 			bool thread_command_impl(const ThreadCommandType& thread_command, RangeCallback&& range_callback, IDCallback&& id_callback, std::string_view dbg_name, std::string_view dbg_name_past_tense, EventArgs&&... event_args);
 
 			void on_state_update_impl(Registry& registry, Entity entity, bool handle_existing=true);
+
+			// Active threads, indexed by `EntityThreadCadence`. (See `refresh_cadence_thread_lists`)
+			std::array<CadenceThreadList, CADENCE_COUNT> cadence_thread_lists;
+
+			// Entities whose threads have changed since `cadence_thread_lists` was last refreshed. (May contain duplicates)
+			std::vector<Entity> pending_thread_list_entities;
+
+			bool cadence_thread_lists_dirty : 1 = true;
+
+			// Set while `progress_threads` is executing; patches made during this time are not structural.
+			bool is_progressing_threads     : 1 = false;
+
+			// Scratch storage for `progress_threads_parallel`: (Indices into a `CadenceThreadList`)
+			std::vector<std::size_t> parallel_thread_groups;
+			std::vector<std::size_t> serial_thread_groups;
+			std::vector<ParallelThreadTask> parallel_thread_tasks;
+
+			// Tracks the time budget and round-robin position of `progress_realtime_threads`.
+			RealtimeThreadScheduler realtime_thread_scheduler;
 	};
 }
\ No newline at end of file
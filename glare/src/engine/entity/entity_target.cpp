@@ -10,6 +10,8 @@
 #include <engine/components/name_component.hpp>
 #include <engine/components/player_component.hpp>
 
+#include <engine/name_index.hpp>
+
 #include <util/string.hpp>
 #include <util/parse.hpp>
 #include <util/variant.hpp>
@@ -24,6 +26,16 @@ namespace engine
 			return null;
 		}
 
+		if (const auto name_index = NameIndex::get(registry))
+		{
+			if (const auto indexed_child = name_index->find_child(registry, source, child_name, recursive))
+			{
+				return *indexed_child;
+			}
+
+			// Multiple candidates; fall back to enumerating the hierarchy to preserve traversal order.
+		}
+
 		const RelationshipComponent* relationship = registry.try_get<RelationshipComponent>(source);
 
 		if (!relationship)
@@ -108,8 +120,6 @@ namespace engine
 
 			[&registry, source, &target_entity](const EntityNameTarget& named_target)
 			{
-				auto named_range = registry.view<NameComponent>().each();
-
 				if (named_target.search_children_first)
 				{
 					if (auto child = find_child_impl(registry, source, named_target.entity_name, false); (child != null)) // true
@@ -120,6 +130,15 @@ namespace engine
 					}
 				}
 
+				if (const auto name_index = NameIndex::get(registry))
+				{
+					target_entity = name_index->get_first(named_target.entity_name);
+
+					return;
+				}
+
+				auto named_range = registry.view<NameComponent>().each();
+
 				for (auto it = named_range.begin(); it != named_range.end(); it++)
 				{
 					const auto& [e_out, name] = *it;
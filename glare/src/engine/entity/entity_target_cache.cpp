@@ -0,0 +1,117 @@
+#include "entity_target_cache.hpp"
+#include "entity_target.hpp"
+
+#include <engine/components/name_component.hpp>
+
+#include <variant>
+
+namespace engine
+{
+	EntityTargetCache::Generation EntityTargetCache::Generations::get(StringHash name_hash) const
+	{
+		if (const auto it = name_generations.find(name_hash); it != name_generations.end())
+		{
+			return (base_generation + it->second);
+		}
+
+		return base_generation;
+	}
+
+	void EntityTargetCache::Generations::invalidate(StringHash name_hash)
+	{
+		// NOTE: Entries are never erased, ensuring that generations only ever increase.
+		name_generations[name_hash]++;
+	}
+
+	void EntityTargetCache::Generations::invalidate_all()
+	{
+		base_generation++;
+	}
+
+	bool EntityTargetCache::is_cacheable(const EntityTarget& target)
+	{
+		switch (target.target_index())
+		{
+			case EntityTarget::TargetIndex::EntityName:
+			case EntityTarget::TargetIndex::Child:
+				return true;
+		}
+
+		return false;
+	}
+
+	StringHash EntityTargetCache::get_name_hash(const EntityTarget& target)
+	{
+		if (target.is_child_target())
+		{
+			return std::get<EntityTarget::ChildTarget>(target.type).child_name;
+		}
+
+		return std::get<EntityTarget::EntityNameTarget>(target.type).entity_name;
+	}
+
+	Entity EntityTargetCache::resolve(Registry& registry, Entity source, const EntityTarget& target, const Generations& generations)
+	{
+		if (!is_cacheable(target))
+		{
+			return target.get(registry, source);
+		}
+
+		auto* entry = find_entry(target, source);
+
+		if (entry)
+		{
+			// NOTE: Validity and names are checked here, since destroyed entities are not guaranteed
+			// to invalidate this cache, and names may be changed in-place. (See `NameComponent::set_name`)
+			if ((entry->generation == generations.get(entry->name_hash)) && (registry.valid(entry->resolved)))
+			{
+				if (const auto* name_component = registry.try_get<NameComponent>(entry->resolved))
+				{
+					if (name_component->hash() == entry->name_hash)
+					{
+						return entry->resolved;
+					}
+				}
+			}
+		}
+
+		const auto resolved = target.get(registry, source);
+
+		if (resolved == null)
+		{
+			return null;
+		}
+
+		if (!entry)
+		{
+			entry = &(entries.emplace_back());
+
+			entry->target = &target;
+			entry->source = source;
+			entry->name_hash = get_name_hash(target);
+		}
+
+		entry->resolved = resolved;
+		entry->generation = generations.get(entry->name_hash);
+
+		return resolved;
+	}
+
+	void EntityTargetCache::clear()
+	{
+		entries.clear();
+	}
+
+	EntityTargetCache::Entry* EntityTargetCache::find_entry(const EntityTarget& target, Entity source)
+	{
+		for (auto& entry : entries)
+		{
+			if ((entry.target == &target) && (entry.source == source))
+			{
+				return &entry;
+			}
+		}
+
+		return nullptr;
+	}
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <util/small_vector.hpp>
+
+#include <unordered_map>
+#include <cstdint>
+
+namespace engine
+{
+	struct EntityTarget;
+
+	// Caches the entities resolved from `EntityTarget` objects, on behalf of a single thread instance.
+	//
+	// Entries are keyed by the address of the (descriptor-owned) `EntityTarget` and the source entity.
+	// Each entry records the generation of the name it was resolved with; an entry is discarded once
+	// the generation of that name moves past it. (See `Generations`, `EntitySystem::invalidate_target_caches`)
+	//
+	// Only targets that require name lookups are cached. (See `is_cacheable`)
+	class EntityTargetCache
+	{
+		public:
+			using Generation = std::uint32_t;
+
+			// Tracks a generation for each name, shared by every cache validated against it.
+			//
+			// The generation of a name should be advanced whenever an entity with that name is
+			// created, renamed, destroyed or moved within a hierarchy. (See `EntitySystem::on_target_name_changed`)
+			class Generations
+			{
+				public:
+					Generation get(StringHash name_hash) const;
+
+					// Invalidates cached targets referring to `name_hash`.
+					void invalidate(StringHash name_hash);
+
+					// Invalidates every cached target.
+					void invalidate_all();
+
+				private:
+					std::unordered_map<StringHash, Generation> name_generations;
+
+					// Added to the generation of every name. (See `invalidate_all`)
+					Generation base_generation = {};
+			};
+
+			// Indicates whether resolutions of `target` may be stored by this cache.
+			//
+			// NOTE: Parent targets are resolved directly, since doing so is no more expensive than validating a cached result.
+			static bool is_cacheable(const EntityTarget& target);
+
+			// Resolves `target` from `source`, reusing a previous result if it is still valid in `generations`.
+			//
+			// NOTE: Unresolved (`null`) targets are never cached, since the entity
+			// they refer to may be created without invalidating this cache.
+			Entity resolve(Registry& registry, Entity source, const EntityTarget& target, const Generations& generations);
+
+			// Discards every cached entry.
+			void clear();
+
+			inline std::size_t size() const
+			{
+				return entries.size();
+			}
+
+			inline bool empty() const
+			{
+				return entries.empty();
+			}
+
+		private:
+			struct Entry
+			{
+				const EntityTarget* target = nullptr;
+
+				Entity source = null;
+				Entity resolved = null;
+
+				StringHash name_hash = {};
+				Generation generation = {};
+			};
+
+			// Retrieves the name `target` refers to. (Cacheable targets only)
+			static StringHash get_name_hash(const EntityTarget& target);
+
+			Entry* find_entry(const EntityTarget& target, Entity source);
+
+			util::small_vector<Entry, 2> entries;
+	};
+}
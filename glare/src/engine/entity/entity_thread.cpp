@@ -142,6 +142,16 @@ namespace engine
 		return variables.get();
 	}
 
+	EntityThread::ThreadLocalVariables* EntityThread::get_variables(const MetaVariableLayout& layout)
+	{
+		if (!variables)
+		{
+			variables = std::make_shared<ThreadLocalVariables>(layout);
+		}
+
+		return variables.get();
+	}
+
 	EntityInstructionCount EntityThread::skip(EntityInstructionCount forward_stride)
 	{
 		next_instruction += forward_stride;
@@ -6,6 +6,7 @@
 #include "entity_thread_flags.hpp"
 #include "entity_thread_cadence.hpp"
 #include "entity_thread_fiber.hpp"
+#include "entity_target_cache.hpp"
 
 #include <optional>
 #include <memory>
@@ -130,6 +131,10 @@ namespace engine
 			// The value returned is a non-owning pointer to the remote object. (see `variables`)
 			ThreadLocalVariables* get_variables();
 
+			// Equivalent to `get_variables`, but reserves a slot for each name in `layout` when allocating.
+			// (See `EntityThreadDescription::local_variables`)
+			ThreadLocalVariables* get_variables(const MetaVariableLayout& layout);
+
 			EntityInstructionCount skip(EntityInstructionCount forward_stride);
 			EntityInstructionCount rewind(EntityInstructionCount backward_stride);
 
@@ -156,6 +161,9 @@ namespace engine
 			// The active fiber to be executed, if any.
 			EntityThreadFiber active_fiber;
 
+			// Entities previously resolved from the targets of this thread's instructions.
+			EntityTargetCache target_cache;
+
 		private:
 			static constexpr EntityStateIndex resolve_state_index(std::optional<EntityStateIndex> state_index)
 			{
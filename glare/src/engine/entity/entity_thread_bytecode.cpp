@@ -0,0 +1,201 @@
+#include "entity_thread_bytecode.hpp"
+
+#include "entity_instruction.hpp"
+#include "entity_target.hpp"
+#include "entity_thread_description.hpp"
+
+#include <engine/meta/meta_variable_scope.hpp>
+
+#include <util/variant.hpp>
+
+namespace engine
+{
+	bool EntityThreadBytecode::is_parallel_safe_target(const EntityTarget& target)
+	{
+		// NOTE: Indirect targets evaluate reflected expressions, and player targets
+		// create the registry's storage for `PlayerComponent` on first use.
+		switch (target.target_index())
+		{
+			case EntityTarget::TargetIndex::Self:
+			case EntityTarget::TargetIndex::Parent:
+			case EntityTarget::TargetIndex::ExactEntity:
+			case EntityTarget::TargetIndex::EntityName:
+			case EntityTarget::TargetIndex::Child:
+				return true;
+		}
+
+		return false;
+	}
+
+	EntityThreadBytecode::Instruction EntityThreadBytecode::lower(const EntityInstruction& instruction, EntityInstructionIndex instruction_index)
+	{
+		using namespace instructions;
+
+		using Flags = Instruction::Flags;
+
+		auto bytecode_instruction = Instruction { EntityThreadOpcode::Dispatch };
+
+		auto on_thread_instruction = [&bytecode_instruction](const EntityThreadInstruction& thread_instruction)
+		{
+			if (!is_parallel_safe_target(thread_instruction.target_entity))
+			{
+				bytecode_instruction.flags |= Flags::SerialOnly;
+			}
+		};
+
+		// Lowers `thread_instruction` to `opcode`, recording how its target is resolved.
+		auto lower_thread_instruction = [&bytecode_instruction, &on_thread_instruction](EntityThreadOpcode opcode, const EntityThreadInstruction& thread_instruction, bool check_linked)
+		{
+			bytecode_instruction.opcode = opcode;
+
+			if ((thread_instruction.target_entity.target_index() == EntityTarget::TargetIndex::Self) && (!thread_instruction.thread_id))
+			{
+				bytecode_instruction.flags |= Flags::LocalTarget;
+			}
+
+			if (check_linked)
+			{
+				bytecode_instruction.flags |= Flags::CheckLinked;
+			}
+
+			on_thread_instruction(thread_instruction);
+		};
+
+		util::visit
+		(
+			instruction.value,
+
+			[&bytecode_instruction](const NoOp&)
+			{
+				bytecode_instruction.opcode = EntityThreadOpcode::NoOp;
+			},
+
+			[&bytecode_instruction](const Link&)
+			{
+				bytecode_instruction.opcode = EntityThreadOpcode::Link;
+			},
+
+			[&bytecode_instruction, instruction_index](const IfControlBlock& control_block)
+			{
+				bytecode_instruction.opcode = EntityThreadOpcode::BranchIfNot;
+
+				// Step over this instruction, as well as the body of the if-block.
+				bytecode_instruction.operand = static_cast<EntityInstructionIndex>(instruction_index + 1 + control_block.execution_range.size);
+
+				// Conditions are evaluated reflectively, and may include function calls.
+				bytecode_instruction.flags |= Flags::SerialOnly;
+			},
+
+			[&bytecode_instruction](const CadenceControlBlock& control_block)
+			{
+				// NOTE: Multi-cadence blocks are handled by the interpreter, since they may include instructions.
+				if (control_block.cadence != EntityThreadCadence::Multi)
+				{
+					bytecode_instruction.opcode = EntityThreadOpcode::SetCadence;
+					bytecode_instruction.cadence = control_block.cadence;
+
+					// Leaving the multi-cadence, which is the only cadence that observes implicit yields.
+					bytecode_instruction.flags |= Flags::ImplicitYield;
+				}
+
+				// Multi-instruction execution relies on commands being handled immediately.
+				bytecode_instruction.flags |= Flags::SerialOnly;
+			},
+
+			[&bytecode_instruction](const MultiControlBlock&)
+			{
+				bytecode_instruction.flags |= Flags::SerialOnly;
+			},
+
+			// After handling a rewind instruction, pause execution until the next update.
+			// (Ensures continuous loops don't stall the application)
+			[&bytecode_instruction, &lower_thread_instruction](const Rewind& rewind)
+			{
+				lower_thread_instruction(EntityThreadOpcode::Rewind, rewind, rewind.check_linked);
+
+				bytecode_instruction.operand = rewind.instructions_rewound;
+				bytecode_instruction.flags |= Flags::ImplicitYield;
+			},
+
+			[&bytecode_instruction, &lower_thread_instruction](const Skip& skip)
+			{
+				lower_thread_instruction(EntityThreadOpcode::Skip, skip, skip.check_linked);
+
+				bytecode_instruction.operand = skip.instructions_skipped.size;
+			},
+
+			[&bytecode_instruction, &lower_thread_instruction](const Start& start)
+			{
+				lower_thread_instruction(EntityThreadOpcode::Start, start, false);
+
+				bytecode_instruction.operand = static_cast<EntityInstructionIndex>(start.restart_existing);
+			},
+
+			[&bytecode_instruction, &lower_thread_instruction](const Restart& restart)
+			{
+				lower_thread_instruction(EntityThreadOpcode::Start, restart, false);
+
+				bytecode_instruction.operand = 1;
+			},
+
+			[&lower_thread_instruction](const Stop& stop)     { lower_thread_instruction(EntityThreadOpcode::Stop, stop, stop.check_linked); },
+			[&lower_thread_instruction](const Pause& pause)   { lower_thread_instruction(EntityThreadOpcode::Pause, pause, pause.check_linked); },
+			[&lower_thread_instruction](const Resume& resume) { lower_thread_instruction(EntityThreadOpcode::Resume, resume, resume.check_linked); },
+			[&lower_thread_instruction](const Sleep& sleep)   { lower_thread_instruction(EntityThreadOpcode::Sleep, sleep, sleep.check_linked); },
+
+			// Non-local variables may be shared with other entities.
+			[&bytecode_instruction](const VariableDeclaration& variable_declaration)
+			{
+				if (variable_declaration.variable_details.scope != MetaVariableScope::Local)
+				{
+					bytecode_instruction.flags |= Flags::SerialOnly;
+				}
+			},
+
+			// Instructions whose side effects are limited to the executing thread, or are raised as `Service` events.
+			// (Captured by the command buffer bound to each worker; see `Service::set_thread_command_buffer`)
+			[&bytecode_instruction](const EntityStateTransitionAction&)
+			{
+				bytecode_instruction.opcode = EntityThreadOpcode::TransitionState;
+			},
+
+			[](const EntityThreadSpawnAction&) {},
+			[](const EntityThreadStopAction&) {},
+			[](const EntityThreadPauseAction&) {},
+			[](const EntityThreadResumeAction&) {},
+			[](const EntityThreadAttachAction&) {},
+			[](const EntityThreadDetachAction&) {},
+			[](const EntityThreadUnlinkAction&) {},
+			[](const EntityThreadSkipAction&) {},
+			[](const EntityThreadRewindAction&) {},
+
+			// Thread instructions additionally resolve `target_entity` on the executing thread.
+			[&on_thread_instruction](const Unlink& unlink)     { on_thread_instruction(unlink); },
+			[&on_thread_instruction](const Attach& attach)     { on_thread_instruction(attach); },
+			[&on_thread_instruction](const Detach& detach)     { on_thread_instruction(detach); },
+
+			// Everything else may evaluate reflected expressions (function calls, coroutines,
+			// yield and if-block conditions, assigned values, etc.) or write to the registry directly.
+			[&bytecode_instruction](const auto&)
+			{
+				bytecode_instruction.flags |= Flags::SerialOnly;
+			}
+		);
+
+		return bytecode_instruction;
+	}
+
+	EntityThreadBytecode::Container EntityThreadBytecode::compile(const EntityThreadDescription& thread)
+	{
+		auto bytecode = Container {};
+
+		bytecode.reserve(thread.instructions.size());
+
+		for (EntityInstructionIndex instruction_index = 0; instruction_index < thread.size(); instruction_index++)
+		{
+			bytecode.emplace_back(lower(thread.get_instruction(instruction_index), instruction_index));
+		}
+
+		return bytecode;
+	}
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+#include "types.hpp"
+#include "entity_thread_cadence.hpp"
+
+#include <vector>
+#include <cstdint>
+
+namespace engine
+{
+	struct EntityInstruction;
+	struct EntityThreadDescription;
+
+	struct EntityTarget;
+
+	// Opcodes used by `EntityThreadBytecode`.
+	enum class EntityThreadOpcode : std::uint8_t
+	{
+		// No operation; execution continues to the next instruction.
+		NoOp,
+
+		// Executed by the general-purpose instruction interpreter. (See `EntitySystem::step_thread`)
+		Dispatch,
+
+		// Links the executing thread to its entity's active state. (See `instructions::Link`)
+		Link,
+
+		// Changes the cadence of the executing thread to `cadence`. (Non-multi `instructions::CadenceControlBlock`)
+		SetCadence,
+
+		// Evaluates the condition of the source `instructions::IfControlBlock`.
+		// If the condition is not met, execution continues from `operand`.
+		BranchIfNot,
+
+		// Pauses the targeted thread immediately, then resumes it once
+		// the duration of the source `instructions::Sleep` has elapsed.
+		Sleep,
+
+		// Skips `operand` instructions of the targeted thread. (See `instructions::Skip`)
+		Skip,
+
+		// Rewinds the targeted thread by `operand` instructions. (See `instructions::Rewind`)
+		Rewind,
+
+		// Spawns the targeted thread, restarting an existing instance if `operand` is non-zero.
+		// (See `instructions::Start` and `instructions::Restart`)
+		Start,
+
+		// Stops the targeted thread. (See `instructions::Stop`)
+		Stop,
+
+		// Pauses the targeted thread immediately. (See `instructions::Pause`)
+		Pause,
+
+		// Resumes the targeted thread immediately. (See `instructions::Resume`)
+		Resume,
+
+		// Transitions the executing entity to the state named by the source `EntityStateTransitionAction`.
+		TransitionState,
+	};
+
+	// A compact representation of an `EntityInstruction`.
+	//
+	// Instructions with a dedicated opcode are executed without visiting the source instruction,
+	// whereas `EntityThreadOpcode::Dispatch` forwards to the source instruction's handler.
+	// (Opcodes may still read fields that don't fit in `operand`, such as durations, conditions and non-local targets)
+	struct EntityThreadBytecodeInstruction
+	{
+		enum Flags : std::uint8_t
+		{
+			None          = 0,
+
+			// Execution of a `Multi`-cadence thread stops after this instruction until the next update.
+			// (e.g. rewinding, or changing to a different cadence)
+			ImplicitYield = (1 << 0),
+
+			// This instruction may affect entities or variables other than those owned by the executing thread,
+			// either directly or by evaluating reflected expressions. (See `EntitySystem::can_progress_threads_in_parallel`)
+			SerialOnly    = (1 << 1),
+
+			// This thread instruction targets the executing thread, using the default entity target and thread ID.
+			// (i.e. its target is resolved without visiting the source instruction)
+			LocalTarget   = (1 << 2),
+
+			// The `check_linked` field of the source thread instruction.
+			CheckLinked   = (1 << 3),
+		};
+
+		EntityThreadOpcode opcode = EntityThreadOpcode::NoOp;
+
+		// The target cadence, used by `EntityThreadOpcode::SetCadence`.
+		EntityThreadCadence cadence = EntityThreadCadence::Default;
+
+		std::uint8_t flags = Flags::None;
+
+		// An opcode-dependent operand.
+		// For branches, this is the precomputed absolute index of the jump target.
+		// For skips and rewinds, this is the number of instructions to move by.
+		EntityInstructionIndex operand = {};
+
+		inline bool has_flag(Flags flag) const
+		{
+			return ((flags & flag) != 0);
+		}
+
+		inline bool is_implicit_yield() const
+		{
+			return has_flag(Flags::ImplicitYield);
+		}
+
+		inline bool is_serial_only() const
+		{
+			return has_flag(Flags::SerialOnly);
+		}
+
+		inline bool is_local_target() const
+		{
+			return has_flag(Flags::LocalTarget);
+		}
+
+		inline bool check_linked() const
+		{
+			return has_flag(Flags::CheckLinked);
+		}
+	};
+
+	static_assert(sizeof(EntityThreadBytecodeInstruction) <= 8);
+
+	// Lowers the instructions of an `EntityThreadDescription` into `EntityThreadBytecodeInstruction` objects.
+	//
+	// Bytecode is stored alongside the source instructions, using the same indices.
+	// (i.e. each bytecode instruction maps to exactly one source instruction)
+	struct EntityThreadBytecode
+	{
+		using Instruction = EntityThreadBytecodeInstruction;
+		using Container   = std::vector<Instruction>;
+
+		// Lowers a single instruction located at `instruction_index`.
+		static Instruction lower(const EntityInstruction& instruction, EntityInstructionIndex instruction_index);
+
+		// Lowers every instruction of `thread`.
+		static Container compile(const EntityThreadDescription& thread);
+
+		// Indicates whether `target` can be resolved from a worker thread.
+		// Instructions referring to other targets are flagged as `Instruction::Flags::SerialOnly`.
+		static bool is_parallel_safe_target(const EntityTarget& target);
+	};
+}
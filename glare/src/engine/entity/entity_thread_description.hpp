@@ -3,6 +3,9 @@
 #include "types.hpp"
 #include "entity_instruction.hpp"
 #include "entity_thread_cadence.hpp"
+#include "entity_thread_bytecode.hpp"
+
+#include <engine/meta/types.hpp>
 
 #include <util/small_vector.hpp>
 
@@ -23,11 +26,44 @@ namespace engine
 		// A series of instructions to be executed in-order.
 		util::small_vector<EntityInstruction, 64> instructions; // 32 // 48
 
+		// Compiled form of `instructions`. (See `compile`)
+		// 
+		// NOTE: Empty until compiled; threads without bytecode are executed by the general-purpose interpreter.
+		EntityThreadBytecode::Container bytecode;
+
+		// The slot layout of this thread's local variables, in declaration order.
+		// (See `EntityDescriptor::compile_variables`)
+		MetaVariableLayout local_variables;
+
 		inline const EntityInstruction& get_instruction(InstructionIndex index) const
 		{
 			return instructions[index]; // .at(index);
 		}
 
+		// Retrieves the bytecode for the instruction at `index`, lowering the source instruction if this thread has not been compiled.
+		inline EntityThreadBytecodeInstruction get_bytecode_instruction(InstructionIndex index) const
+		{
+			if (has_bytecode())
+			{
+				return bytecode[index];
+			}
+
+			return EntityThreadBytecode::lower(instructions[index], index);
+		}
+
+		// Indicates whether `bytecode` is up-to-date with `instructions`.
+		inline bool has_bytecode() const
+		{
+			return ((!bytecode.empty()) && (bytecode.size() == instructions.size()));
+		}
+
+		// Lowers `instructions` into `bytecode`.
+		// This should be called again if `instructions` is modified.
+		inline void compile()
+		{
+			bytecode = EntityThreadBytecode::compile(*this);
+		}
+
 		inline EntityThreadID name() const
 		{
 			return thread_id;
@@ -24,6 +24,27 @@ namespace engine
 		public:
 			using Names  = util::small_vector<MetaSymbolID, preallocated>;
 			using Values = util::small_vector<MetaAny, preallocated>;
+			using Flags  = util::small_vector<bool, preallocated>;
+
+			EntityVariables() = default;
+
+			// Reserves a slot for each name in `layout`, in order.
+			// (i.e. The variable named `layout[i]` is always found at slot `i`)
+			// 
+			// NOTE: Reserved variables are not considered declared until a value has been assigned to them.
+			explicit EntityVariables(const MetaVariableLayout& layout)
+			{
+				names.reserve(layout.size());
+				values.reserve(layout.size());
+				vacant.reserve(layout.size());
+
+				for (const auto& name : layout)
+				{
+					names.emplace_back(name);
+					values.emplace_back();
+					vacant.emplace_back(true);
+				}
+			}
 
 			std::optional<std::size_t> get_index(MetaSymbolID name) const override
 			{
@@ -34,7 +55,7 @@ namespace engine
 
 				for (std::size_t i = 0; i < names.size(); i++)
 				{
-					if (names[i] == name)
+					if ((names[i] == name) && (!vacant[i]))
 					{
 						assert(values.size() > i);
 
@@ -45,6 +66,12 @@ namespace engine
 				return std::nullopt;
 			}
 
+			// Returns true if `slot` holds a declared variable named `name`.
+			bool has_slot(MetaSymbolID name, MetaVariableSlot slot) const
+			{
+				return ((slot < names.size()) && (names[slot] == name) && (!vacant[slot]) && (name));
+			}
+
 			bool contains(MetaSymbolID name) const override
 			{
 				return (get_index(name) != std::nullopt);
@@ -68,6 +95,24 @@ namespace engine
 				);
 			}
 
+			const MetaAny* get(MetaSymbolID name, MetaVariableSlot slot) const override
+			{
+				if (has_slot(name, slot))
+				{
+					return &(values[slot]);
+				}
+
+				return get(name);
+			}
+
+			MetaAny* get(MetaSymbolID name, MetaVariableSlot slot) override
+			{
+				return const_cast<MetaAny*>
+				(
+					const_cast<const EntityVariables*>(this)->get(name, slot)
+				);
+			}
+
 			MetaAny* set(MetaVariable&& variable) override
 			{
 				if (!variable.has_name())
@@ -140,6 +185,11 @@ namespace engine
 
 				for (std::size_t i = offset; i < end_point; i++)
 				{
+					if (vacant[i])
+					{
+						continue;
+					}
+
 					const auto& variable_name = names[i];
 					auto& variable_value = values[i];
 
@@ -199,30 +249,57 @@ namespace engine
 			Names names;
 			Values values;
 
+			// Indicates which entries of `names` are reserved slots that have not been declared yet.
+			Flags vacant;
+
 		private:
 			template <typename ...EvaluationArgs>
 			MetaAny* emplace(MetaSymbolID name, MetaAny&& value, EvaluationArgs&&... args)
 			{
-				names.emplace_back(name);
+				MetaAny* value_ptr_out = get_reserved_slot(name);
 
-				MetaAny* value_ptr_out = nullptr;
+				if (!value_ptr_out)
+				{
+					names.emplace_back(name);
+					vacant.emplace_back(false);
+
+					value_ptr_out = &(values.emplace_back());
+				}
 
 				if (auto underlying = try_get_underlying_value(value, std::forward<EvaluationArgs>(args)...))
 				{
-					value_ptr_out = &(values.emplace_back(std::move(underlying)));
+					*value_ptr_out = std::move(underlying);
 				}
 				else
 				{
 					assert(!value_has_indirection(value));
 
-					value_ptr_out = &(values.emplace_back(std::move(value)));
+					*value_ptr_out = std::move(value);
 				}
 
 				assert(names.size() == values.size());
+				assert(names.size() == vacant.size());
 
 				return value_ptr_out;
 			}
 
+			// Marks the reserved slot for `name` as declared, returning a pointer to its value.
+			// If `name` does not have a reserved slot, this will return `nullptr`.
+			MetaAny* get_reserved_slot(MetaSymbolID name)
+			{
+				for (std::size_t i = 0; i < names.size(); i++)
+				{
+					if ((names[i] == name) && (vacant[i]))
+					{
+						vacant[i] = false;
+
+						return &(values[i]);
+					}
+				}
+
+				return nullptr;
+			}
+
 			template <typename ...EvaluationArgs>
 			MetaAny* set_existing_impl(MetaSymbolID name, MetaAny&& value, EvaluationArgs&&... args) // MetaAny&
 			{
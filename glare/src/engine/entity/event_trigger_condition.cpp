@@ -1078,6 +1078,24 @@ namespace engine
 		return get_inverse(get_descriptor(registry, entity));
 	}
 
+	// EventTriggerCondition:
+	bool EventTriggerCondition::compile(const EntityDescriptor& descriptor, SharedStorageIndex condition_index)
+	{
+		predicate = EventTriggerPredicate::compile(descriptor, *this, condition_index);
+
+		return has_predicate();
+	}
+
+	bool EventTriggerCondition::condition_met(const MetaAny& event_instance, Registry& registry, Entity entity, const MetaEvaluationContext& context) const
+	{
+		if (has_predicate())
+		{
+			return predicate.condition_met(event_instance, registry, entity, context);
+		}
+
+		return EventTriggerConditionType::get_condition_status(*this, event_instance, registry, entity, context);
+	}
+
 	std::tuple<MetaTypeID, entt::meta_data>
 	resolve_trigger_condition_member(const entt::meta_type& type, std::string_view member_name)
 	{
@@ -2,6 +2,7 @@
 
 #include "types.hpp"
 #include "entity_descriptor_shared.hpp"
+#include "event_trigger_predicate.hpp"
 
 #include <engine/meta/types.hpp>
 #include <engine/meta/hash.hpp>
@@ -487,6 +488,11 @@ namespace engine
 				return event_type_id;
 			}
 
+			inline bool can_fallback_to_component() const
+			{
+				return fallback_to_component;
+			}
+
 			MetaType get_type() const;
 
 			// Interface added for compatibility with compound condition types:
@@ -1016,6 +1022,11 @@ namespace engine
 			const EventTriggerConditionType& get_inverse(const EntityDescriptor& descriptor) const;
 			const EventTriggerConditionType& get_inverse(Registry& registry, Entity entity) const;
 
+			inline const RemoteConditionType& get_inverse_condition() const
+			{
+				return inv_condition;
+			}
+
 			// Interface added for compatibility with compound condition types:
 			template <typename Callback>
 			inline std::size_t enumerate_conditions(Callback&& callback, bool recursive=true) const
@@ -1179,8 +1190,16 @@ namespace engine
 
 			inline auto index() const { return value.index(); }
 
-			bool operator==(const EventTriggerCondition&) const noexcept = default;
-			bool operator!=(const EventTriggerCondition&) const noexcept = default;
+			// NOTE: Compiled predicates are derived from `value`, and are therefore excluded from comparisons.
+			inline bool operator==(const EventTriggerCondition& condition) const noexcept
+			{
+				return (value == condition.value);
+			}
+
+			inline bool operator!=(const EventTriggerCondition& condition) const noexcept
+			{
+				return (value != condition.value);
+			}
 
 			inline bool operator==(const ValueType& value_in) const noexcept
 			{
@@ -1191,6 +1210,23 @@ namespace engine
 			{
 				return (value != value_in);
 			}
+
+			// Compiles `predicate` from `value`. (See `EventTriggerPredicate::compile`)
+			// 
+			// The return-value of this function indicates if a predicate could be generated.
+			bool compile(const EntityDescriptor& descriptor, SharedStorageIndex condition_index);
+
+			inline bool has_predicate() const
+			{
+				return !predicate.empty();
+			}
+
+			// Evaluates this condition, using the compiled predicate when available.
+			bool condition_met(const MetaAny& event_instance, Registry& registry, Entity entity, const MetaEvaluationContext& context) const;
+
+			// A typed representation of `value`, used to bypass reflective evaluation.
+			// NOTE: This is empty until `compile` is called.
+			EventTriggerPredicate predicate;
 	};
 
 	std::tuple<MetaTypeID, entt::meta_data>
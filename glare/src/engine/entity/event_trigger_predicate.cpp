@@ -0,0 +1,559 @@
+#include "event_trigger_predicate.hpp"
+
+#include "event_trigger_condition.hpp"
+#include "entity_descriptor.hpp"
+
+#include <engine/meta/hash.hpp>
+#include <engine/meta/data_member.hpp>
+#include <engine/meta/meta_evaluation_context.hpp>
+
+#include <util/variant.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <type_traits>
+
+namespace engine
+{
+	namespace impl
+	{
+		template <typename LeftType, typename RightType>
+		static bool compare_primitive_values(const LeftType& left, const RightType& right, EventTriggerComparisonMethod comparison_method)
+		{
+			using ComparisonMethod = EventTriggerComparisonMethod;
+
+			if constexpr ((std::is_floating_point_v<LeftType>) || (std::is_floating_point_v<RightType>))
+			{
+				const auto left_value = static_cast<double>(left);
+				const auto right_value = static_cast<double>(right);
+
+				switch (comparison_method)
+				{
+					case ComparisonMethod::Equal:
+						return (left_value == right_value);
+					case ComparisonMethod::NotEqual:
+						return (left_value != right_value);
+					case ComparisonMethod::LessThan:
+						return (left_value < right_value);
+					case ComparisonMethod::LessThanOrEqual:
+						return (left_value <= right_value);
+					case ComparisonMethod::GreaterThan:
+						return (left_value > right_value);
+					case ComparisonMethod::GreaterThanOrEqual:
+						return (left_value >= right_value);
+				}
+			}
+			else
+			{
+				// NOTE: Mixed signed and unsigned values are compared by value, rather than by representation.
+				switch (comparison_method)
+				{
+					case ComparisonMethod::Equal:
+						return std::cmp_equal(left, right);
+					case ComparisonMethod::NotEqual:
+						return std::cmp_not_equal(left, right);
+					case ComparisonMethod::LessThan:
+						return std::cmp_less(left, right);
+					case ComparisonMethod::LessThanOrEqual:
+						return std::cmp_less_equal(left, right);
+					case ComparisonMethod::GreaterThan:
+						return std::cmp_greater(left, right);
+					case ComparisonMethod::GreaterThanOrEqual:
+						return std::cmp_greater_equal(left, right);
+				}
+			}
+
+			return false;
+		}
+
+		template <typename T>
+		static EventTriggerPrimitive read_primitive_as(const MetaAny& value)
+		{
+			if (const auto* exact_value = value.try_cast<const T>())
+			{
+				if constexpr (std::is_same_v<T, bool>)
+				{
+					return *exact_value;
+				}
+				else if constexpr (std::is_floating_point_v<T>)
+				{
+					return static_cast<double>(*exact_value);
+				}
+				else if constexpr (std::is_signed_v<T>)
+				{
+					return static_cast<std::int64_t>(*exact_value);
+				}
+				else
+				{
+					return static_cast<std::uint64_t>(*exact_value);
+				}
+			}
+
+			return {};
+		}
+	}
+
+	EventTriggerPredicate EventTriggerPredicate::compile(const EntityDescriptor& descriptor, const EventTriggerCondition& condition, SharedStorageIndex condition_index)
+	{
+		auto predicate = EventTriggerPredicate {};
+
+		if (!lower(descriptor, condition, condition_index, predicate.instructions))
+		{
+			return {};
+		}
+
+		const bool has_typed_instruction = std::any_of
+		(
+			predicate.instructions.cbegin(), predicate.instructions.cend(),
+
+			[](const Instruction& instruction)
+			{
+				return (instruction.opcode != EventTriggerPredicateOpcode::Reflect);
+			}
+		);
+
+		// Nothing to gain over evaluating the source condition directly.
+		if (!has_typed_instruction)
+		{
+			return {};
+		}
+
+		return predicate;
+	}
+
+	bool EventTriggerPredicate::lower(const EntityDescriptor& descriptor, const EventTriggerCondition& condition, SharedStorageIndex condition_index, Container& instructions_out)
+	{
+		using Opcode = EventTriggerPredicateOpcode;
+
+		const auto instruction_index = instructions_out.size();
+
+		auto reflect = [&instructions_out, condition_index]()
+		{
+			instructions_out.emplace_back(Instruction { .opcode = Opcode::Reflect, .condition_index = condition_index });
+		};
+
+		// Appends a compound instruction, followed by each of its operands.
+		auto lower_compound = [&descriptor, &instructions_out, condition_index, instruction_index](Opcode opcode, const auto& operands) -> bool
+		{
+			instructions_out.emplace_back(Instruction { .opcode = opcode, .condition_index = condition_index });
+
+			for (const auto& operand : operands)
+			{
+				if (!lower(descriptor, operand.get(descriptor), operand.get_index(), instructions_out))
+				{
+					return false;
+				}
+			}
+
+			const auto compound_size = (instructions_out.size() - instruction_index);
+
+			if (compound_size > static_cast<std::size_t>(std::numeric_limits<decltype(Instruction::size)>::max()))
+			{
+				return false;
+			}
+
+			instructions_out[instruction_index].size = static_cast<decltype(Instruction::size)>(compound_size);
+
+			return true;
+		};
+
+		bool result = true;
+
+		util::visit
+		(
+			condition.value,
+
+			[&reflect, condition_index, &instructions_out](const EventTriggerSingleCondition& single_condition)
+			{
+				if (auto comparison = lower_comparison(single_condition, condition_index))
+				{
+					instructions_out.emplace_back(std::move(*comparison));
+				}
+				else
+				{
+					reflect();
+				}
+			},
+
+			// NOTE: Component members are resolved indirectly, and are therefore always evaluated reflectively.
+			[&reflect](const EventTriggerMemberCondition& member_condition)
+			{
+				reflect();
+			},
+
+			[&lower_compound, &result](const EventTriggerAndCondition& and_condition)
+			{
+				result = lower_compound(Opcode::And, and_condition.get_conditions());
+			},
+
+			[&lower_compound, &result](const EventTriggerOrCondition& or_condition)
+			{
+				result = lower_compound(Opcode::Or, or_condition.get_conditions());
+			},
+
+			[&instructions_out](const EventTriggerTrueCondition& true_condition)
+			{
+				instructions_out.emplace_back(Instruction { .opcode = Opcode::True });
+			},
+
+			[&instructions_out](const EventTriggerFalseCondition& false_condition)
+			{
+				instructions_out.emplace_back(Instruction { .opcode = Opcode::False });
+			},
+
+			[&lower_compound, &result](const EventTriggerInverseCondition& inverse_condition)
+			{
+				const EventTriggerConditionType::RemoteConditionType operands[] = { inverse_condition.get_inverse_condition() };
+
+				result = lower_compound(Opcode::Not, operands);
+			}
+		);
+
+		return result;
+	}
+
+	std::optional<EventTriggerPredicate::Instruction> EventTriggerPredicate::lower_comparison(const EventTriggerSingleCondition& condition, SharedStorageIndex condition_index)
+	{
+		using namespace engine::literals;
+
+		// NOTE: Conditions without an explicit type or member are resolved against each incoming event's type.
+		const auto event_type_id = condition.get_type_id();
+		const auto event_type_member = condition.get_event_type_member();
+
+		if ((!event_type_id) || (!event_type_member))
+		{
+			return std::nullopt;
+		}
+
+		const auto event_type = resolve(event_type_id);
+
+		if (!event_type)
+		{
+			return std::nullopt;
+		}
+
+		const auto data_member = resolve_data_member_by_id(event_type, true, event_type_member);
+
+		if (!data_member)
+		{
+			return std::nullopt;
+		}
+
+		const auto member_type = get_primitive_type(data_member.type());
+
+		if (member_type == EventTriggerPrimitiveType::None)
+		{
+			return std::nullopt;
+		}
+
+		// NOTE: Indirect comparison values (e.g. variables, function calls) are never primitive types.
+		const auto& comparison_value = condition.get_comparison_value();
+
+		if (!comparison_value)
+		{
+			return std::nullopt;
+		}
+
+		const auto comparison_type = get_primitive_type(comparison_value.type());
+
+		// Enumerations are only compared against values of the same enumeration.
+		if ((member_type == EventTriggerPrimitiveType::Enum) || (comparison_type == EventTriggerPrimitiveType::Enum))
+		{
+			if (data_member.type().id() != comparison_value.type().id())
+			{
+				return std::nullopt;
+			}
+		}
+
+		// Booleans are only compared against other booleans.
+		if ((member_type == EventTriggerPrimitiveType::Bool) != (comparison_type == EventTriggerPrimitiveType::Bool))
+		{
+			return std::nullopt;
+		}
+
+		auto instruction = Instruction
+		{
+			.opcode            = EventTriggerPredicateOpcode::Compare,
+			.comparison_method = condition.get_comparison_method(),
+			.member_type       = member_type,
+			.condition_index   = condition_index,
+			.event_type_id     = event_type_id,
+			.data_member       = data_member,
+			.comparison_value  = read_primitive(comparison_value, comparison_type)
+		};
+
+		if (std::holds_alternative<std::monostate>(instruction.comparison_value))
+		{
+			return std::nullopt;
+		}
+
+		// Booleans only support equality comparisons.
+		if (!compare(instruction.comparison_value, instruction.comparison_value, instruction.comparison_method))
+		{
+			return std::nullopt;
+		}
+
+		if (condition.can_fallback_to_component())
+		{
+			instruction.get_component_fn = event_type.func("get_component"_hs);
+		}
+
+		return instruction;
+	}
+
+	EventTriggerPrimitiveType EventTriggerPredicate::get_primitive_type(const MetaType& type)
+	{
+		if (!type)
+		{
+			return EventTriggerPrimitiveType::None;
+		}
+
+		if (type.is_enum())
+		{
+			return EventTriggerPrimitiveType::Enum;
+		}
+
+		switch (type.id())
+		{
+			case entt::type_hash<bool>::value():
+				return EventTriggerPrimitiveType::Bool;
+
+			case entt::type_hash<std::int8_t>::value():
+				return EventTriggerPrimitiveType::Int8;
+			case entt::type_hash<std::int16_t>::value():
+				return EventTriggerPrimitiveType::Int16;
+			case entt::type_hash<std::int32_t>::value():
+				return EventTriggerPrimitiveType::Int32;
+			case entt::type_hash<std::int64_t>::value():
+				return EventTriggerPrimitiveType::Int64;
+
+			case entt::type_hash<std::uint8_t>::value():
+				return EventTriggerPrimitiveType::UInt8;
+			case entt::type_hash<std::uint16_t>::value():
+				return EventTriggerPrimitiveType::UInt16;
+			case entt::type_hash<std::uint32_t>::value():
+				return EventTriggerPrimitiveType::UInt32;
+			case entt::type_hash<std::uint64_t>::value():
+				return EventTriggerPrimitiveType::UInt64;
+
+			case entt::type_hash<float>::value():
+				return EventTriggerPrimitiveType::Float;
+			case entt::type_hash<double>::value():
+				return EventTriggerPrimitiveType::Double;
+		}
+
+		return EventTriggerPrimitiveType::None;
+	}
+
+	EventTriggerPrimitive EventTriggerPredicate::read_primitive(const MetaAny& value, EventTriggerPrimitiveType primitive_type)
+	{
+		switch (primitive_type)
+		{
+			case EventTriggerPrimitiveType::Bool:
+				return impl::read_primitive_as<bool>(value);
+
+			case EventTriggerPrimitiveType::Int8:
+				return impl::read_primitive_as<std::int8_t>(value);
+			case EventTriggerPrimitiveType::Int16:
+				return impl::read_primitive_as<std::int16_t>(value);
+			case EventTriggerPrimitiveType::Int32:
+				return impl::read_primitive_as<std::int32_t>(value);
+			case EventTriggerPrimitiveType::Int64:
+				return impl::read_primitive_as<std::int64_t>(value);
+
+			case EventTriggerPrimitiveType::UInt8:
+				return impl::read_primitive_as<std::uint8_t>(value);
+			case EventTriggerPrimitiveType::UInt16:
+				return impl::read_primitive_as<std::uint16_t>(value);
+			case EventTriggerPrimitiveType::UInt32:
+				return impl::read_primitive_as<std::uint32_t>(value);
+			case EventTriggerPrimitiveType::UInt64:
+				return impl::read_primitive_as<std::uint64_t>(value);
+
+			case EventTriggerPrimitiveType::Float:
+				return impl::read_primitive_as<float>(value);
+			case EventTriggerPrimitiveType::Double:
+				return impl::read_primitive_as<double>(value);
+
+			case EventTriggerPrimitiveType::Enum:
+				if (const auto underlying_value = value.allow_cast<std::int64_t>())
+				{
+					return underlying_value.cast<std::int64_t>();
+				}
+
+				break;
+		}
+
+		return {};
+	}
+
+	std::optional<bool> EventTriggerPredicate::compare(const EventTriggerPrimitive& current_value, const EventTriggerPrimitive& comparison_value, EventTriggerComparisonMethod comparison_method)
+	{
+		std::optional<bool> result = std::nullopt;
+
+		std::visit
+		(
+			[comparison_method, &result](const auto& left, const auto& right)
+			{
+				using LeftType = std::decay_t<decltype(left)>;
+				using RightType = std::decay_t<decltype(right)>;
+
+				if constexpr ((std::is_same_v<LeftType, std::monostate>) || (std::is_same_v<RightType, std::monostate>))
+				{
+					return;
+				}
+				else if constexpr ((std::is_same_v<LeftType, bool>) || (std::is_same_v<RightType, bool>))
+				{
+					if constexpr (std::is_same_v<LeftType, RightType>)
+					{
+						switch (comparison_method)
+						{
+							case EventTriggerComparisonMethod::Equal:
+								result = (left == right);
+
+								break;
+							case EventTriggerComparisonMethod::NotEqual:
+								result = (left != right);
+
+								break;
+						}
+					}
+				}
+				else
+				{
+					result = impl::compare_primitive_values(left, right, comparison_method);
+				}
+			},
+
+			current_value, comparison_value
+		);
+
+		return result;
+	}
+
+	bool EventTriggerPredicate::condition_met(const MetaAny& event_instance, Registry& registry, Entity entity, const MetaEvaluationContext& context) const
+	{
+		if (empty())
+		{
+			return false;
+		}
+
+		return evaluate(0, event_instance, registry, entity, context);
+	}
+
+	bool EventTriggerPredicate::evaluate(std::size_t instruction_index, const MetaAny& event_instance, Registry& registry, Entity entity, const MetaEvaluationContext& context) const
+	{
+		using Opcode = EventTriggerPredicateOpcode;
+
+		const auto& instruction = instructions[instruction_index];
+
+		// Visits each operand of a compound instruction, stopping early if `callback` returns false.
+		auto for_each_operand = [this, &instruction, instruction_index](auto&& callback)
+		{
+			const auto operands_end = (instruction_index + instruction.size);
+
+			for (auto operand_index = (instruction_index + 1); operand_index < operands_end; operand_index += instructions[operand_index].size)
+			{
+				if (!callback(operand_index))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		};
+
+		switch (instruction.opcode)
+		{
+			case Opcode::True:
+				return true;
+
+			case Opcode::False:
+				return false;
+
+			case Opcode::And:
+				return for_each_operand
+				(
+					[&](std::size_t operand_index)
+					{
+						return evaluate(operand_index, event_instance, registry, entity, context);
+					}
+				);
+
+			case Opcode::Or:
+				return !for_each_operand
+				(
+					[&](std::size_t operand_index)
+					{
+						return !evaluate(operand_index, event_instance, registry, entity, context);
+					}
+				);
+
+			case Opcode::Not:
+				return ((instruction.size > 1) && (!evaluate((instruction_index + 1), event_instance, registry, entity, context)));
+
+			case Opcode::Compare:
+				return evaluate_comparison(instruction, event_instance, registry, entity, context);
+
+			case Opcode::Reflect:
+				return evaluate_reflective(instruction, event_instance, registry, entity, context);
+		}
+
+		return false;
+	}
+
+	bool EventTriggerPredicate::evaluate_comparison(const Instruction& instruction, const MetaAny& event_instance, Registry& registry, Entity entity, const MetaEvaluationContext& context) const
+	{
+		auto compare_instance = [&instruction](const MetaAny& instance) -> std::optional<bool>
+		{
+			const auto current_value = read_primitive(instruction.data_member.get(instance), instruction.member_type);
+
+			return compare(current_value, instruction.comparison_value, instruction.comparison_method);
+		};
+
+		if ((event_instance) && (event_instance.type().id() == instruction.event_type_id))
+		{
+			const auto result = compare_instance(event_instance);
+
+			// Unable to read the member as expected; defer to the source condition.
+			if (!result)
+			{
+				return evaluate_reflective(instruction, event_instance, registry, entity, context);
+			}
+
+			if (*result)
+			{
+				return true;
+			}
+		}
+
+		// Fallback to checking against a component of `entity`:
+		if (instruction.get_component_fn)
+		{
+			if (auto component_ptr = instruction.get_component_fn.invoke({}, entt::forward_as_meta(registry), entt::forward_as_meta(entity)))
+			{
+				if (const auto component = *component_ptr)
+				{
+					return compare_instance(component).value_or(false);
+				}
+			}
+		}
+
+		return false;
+	}
+
+	bool EventTriggerPredicate::evaluate_reflective(const Instruction& instruction, const MetaAny& event_instance, Registry& registry, Entity entity, const MetaEvaluationContext& context) const
+	{
+		const auto* descriptor = EventTriggerConditionType::try_get_descriptor(registry, entity);
+
+		if (!descriptor)
+		{
+			return false;
+		}
+
+		const auto& condition = EventTriggerConditionType::RemoteConditionType { instruction.condition_index }.get(*descriptor);
+
+		return EventTriggerConditionType::get_condition_status(condition, event_instance, registry, entity, context);
+	}
+}
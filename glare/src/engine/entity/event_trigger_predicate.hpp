@@ -0,0 +1,147 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <engine/meta/types.hpp>
+
+#include <variant>
+#include <vector>
+#include <optional>
+#include <cstdint>
+#include <cstddef>
+
+namespace engine
+{
+	class EntityDescriptor;
+	class EventTriggerCondition;
+	class EventTriggerSingleCondition;
+
+	struct MetaEvaluationContext;
+
+	enum class EventTriggerComparisonMethod : std::uint8_t;
+
+	// Opcodes used by `EventTriggerPredicate`.
+	enum class EventTriggerPredicateOpcode : std::uint8_t
+	{
+		// Constant results. (`EventTriggerTrueCondition` and `EventTriggerFalseCondition`)
+		True,
+		False,
+
+		// Compound operations; the operands of these instructions immediately follow them. (See `EventTriggerPredicateInstruction::size`)
+		And,
+		Or,
+		Not,
+
+		// Compares a data member of the event (or component) against a constant primitive value.
+		Compare,
+
+		// Evaluates the source condition through `EventTriggerConditionType::condition_met`.
+		// (e.g. indirect comparison values, component members, non-primitive types)
+		Reflect,
+	};
+
+	// The exact type of a primitive value read by `EventTriggerPredicate`.
+	enum class EventTriggerPrimitiveType : std::uint8_t
+	{
+		None,
+
+		Bool,
+
+		Int8,
+		Int16,
+		Int32,
+		Int64,
+
+		UInt8,
+		UInt16,
+		UInt32,
+		UInt64,
+
+		Float,
+		Double,
+
+		// Enumerations are read through their underlying integral value.
+		Enum,
+	};
+
+	// A primitive value, widened for comparison purposes.
+	using EventTriggerPrimitive = std::variant<std::monostate, bool, std::int64_t, std::uint64_t, double>;
+
+	struct EventTriggerPredicateInstruction
+	{
+		using Opcode = EventTriggerPredicateOpcode;
+
+		Opcode opcode = Opcode::False;
+
+		// Used by `Opcode::Compare`.
+		EventTriggerComparisonMethod comparison_method = {};
+
+		// The type of the data member read by `Opcode::Compare`.
+		EventTriggerPrimitiveType member_type = EventTriggerPrimitiveType::None;
+
+		// The number of instructions making up this instruction, including its operands.
+		std::uint16_t size = 1;
+
+		// The index of the source condition in its descriptor's shared storage.
+		// Used by `Opcode::Reflect`, as well as `Opcode::Compare` when a value could not be read.
+		SharedStorageIndex condition_index = {};
+
+		// The event-type expected by `Opcode::Compare`.
+		MetaTypeID event_type_id = {};
+
+		// Resolved once during compilation, rather than per-evaluation.
+		entt::meta_data data_member = {};
+
+		// Used to check for a component of type `event_type_id` when the event does not satisfy the comparison.
+		// (See `EventTriggerSingleCondition::condition_met_as_component`)
+		MetaFunction get_component_fn = {};
+
+		EventTriggerPrimitive comparison_value = {};
+	};
+
+	// A flattened, typed representation of an `EventTriggerCondition`.
+	//
+	// Instructions are stored in prefix order, where compound instructions
+	// are immediately followed by the instructions of their operands.
+	class EventTriggerPredicate
+	{
+		public:
+			using Instruction = EventTriggerPredicateInstruction;
+			using Container   = std::vector<Instruction>;
+
+			// Lowers `condition`, located at `condition_index` of `descriptor`'s shared storage.
+			//
+			// If no part of `condition` can be represented with typed comparisons,
+			// an empty predicate is returned, and the condition should be evaluated as usual.
+			static EventTriggerPredicate compile(const EntityDescriptor& descriptor, const EventTriggerCondition& condition, SharedStorageIndex condition_index);
+
+			static EventTriggerPrimitiveType get_primitive_type(const MetaType& type);
+			static EventTriggerPrimitive read_primitive(const MetaAny& value, EventTriggerPrimitiveType primitive_type);
+
+			// Compares two primitive values using `comparison_method`.
+			// If the values cannot be compared directly, this will return `std::nullopt`.
+			static std::optional<bool> compare(const EventTriggerPrimitive& current_value, const EventTriggerPrimitive& comparison_value, EventTriggerComparisonMethod comparison_method);
+
+			bool condition_met(const MetaAny& event_instance, Registry& registry, Entity entity, const MetaEvaluationContext& context) const;
+
+			inline bool empty() const
+			{
+				return instructions.empty();
+			}
+
+			inline std::size_t size() const
+			{
+				return instructions.size();
+			}
+
+			Container instructions;
+
+		private:
+			static bool lower(const EntityDescriptor& descriptor, const EventTriggerCondition& condition, SharedStorageIndex condition_index, Container& instructions_out);
+			static std::optional<Instruction> lower_comparison(const EventTriggerSingleCondition& condition, SharedStorageIndex condition_index);
+
+			bool evaluate(std::size_t instruction_index, const MetaAny& event_instance, Registry& registry, Entity entity, const MetaEvaluationContext& context) const;
+			bool evaluate_comparison(const Instruction& instruction, const MetaAny& event_instance, Registry& registry, Entity entity, const MetaEvaluationContext& context) const;
+			bool evaluate_reflective(const Instruction& instruction, const MetaAny& event_instance, Registry& registry, Entity entity, const MetaEvaluationContext& context) const;
+	};
+}
@@ -80,6 +80,10 @@ namespace engine
 	// Triggered when a thread is formally unlinked.
 	struct OnThreadUnlink : ThreadEvent {};
 
+	// Triggered when a realtime thread is preempted after exhausting the per-update execution budget.
+	// The thread resumes from `last_instruction_index` on the next update. (See `EntitySystem::set_realtime_thread_budget`)
+	struct OnThreadBudgetExceeded : ThreadEvent {};
+
 	struct OnThreadVariableUpdate : ThreadEvent
 	{
 		MetaSymbolID resolved_variable_name;
@@ -0,0 +1,82 @@
+#include "realtime_thread_scheduler.hpp"
+
+namespace engine
+{
+	void RealtimeThreadScheduler::set_budget(Duration budget)
+	{
+		this->budget = (budget > Duration::zero())
+			? budget
+			: Duration::zero()
+		;
+	}
+
+	void RealtimeThreadScheduler::begin_pass(std::size_t group_count, TimePoint now)
+	{
+		this->group_count = group_count;
+
+		// NOTE: The cursor may be out of range if the thread list has shrunk since the last pass.
+		first_group = (group_count)
+			? (cursor % group_count)
+			: 0
+		;
+
+		groups_visited = 0;
+
+		pass_start = now;
+		deadline = (now + budget);
+
+		statistics = {};
+
+		is_active = true;
+	}
+
+	std::optional<std::size_t> RealtimeThreadScheduler::next_group(TimePoint now)
+	{
+		if (!is_active || (groups_visited >= group_count))
+		{
+			return std::nullopt;
+		}
+
+		if ((groups_visited > 0) && (deadline_reached(now)))
+		{
+			return std::nullopt;
+		}
+
+		const auto group_index = ((first_group + groups_visited) % group_count);
+
+		groups_visited++;
+
+		return group_index;
+	}
+
+	bool RealtimeThreadScheduler::deadline_reached(TimePoint now) const
+	{
+		return ((is_active) && (has_budget()) && (now >= deadline));
+	}
+
+	void RealtimeThreadScheduler::end_pass(std::size_t threads_updated, TimePoint now)
+	{
+		if (group_count == 0)
+		{
+			cursor = 0;
+		}
+		else if (groups_visited < group_count)
+		{
+			// Resume with the first entity deferred by this pass.
+			// (Entities preempted at the end of this pass yield to every other entity next pass)
+			cursor = ((first_group + groups_visited) % group_count);
+		}
+		else
+		{
+			// Rotate the starting entity, so that no single entity is always progressed first.
+			cursor = ((first_group + 1) % group_count);
+		}
+
+		statistics.threads_updated = threads_updated;
+		statistics.entities_progressed = groups_visited;
+		statistics.entities_deferred = (group_count - groups_visited);
+		statistics.elapsed = std::chrono::duration_cast<Duration>(now - pass_start);
+
+		is_active = false;
+	}
+}
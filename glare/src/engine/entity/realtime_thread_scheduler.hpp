@@ -0,0 +1,118 @@
+#pragma once
+
+#include <chrono>
+#include <optional>
+#include <cstddef>
+
+namespace engine
+{
+	// Cooperative scheduler for `EntityThreadCadence::Realtime` threads, on behalf of `EntitySystem`.
+	//
+	// Each pass visits the entities of a `CadenceThreadList` in round-robin order, stopping once the
+	// configured time budget has been exhausted. Entities that were not visited are deferred to the next pass,
+	// which begins with the entity following the last one progressed. (See `EntitySystem::set_realtime_thread_budget`)
+	//
+	// NOTE: Entities are identified by their index in the thread list. Since entities are added to and
+	// removed from lists as their threads change, the starting position of a pass is only approximate.
+	class RealtimeThreadScheduler
+	{
+		public:
+			using Clock     = std::chrono::steady_clock;
+			using TimePoint = Clock::time_point;
+			using Duration  = std::chrono::microseconds;
+
+			// Summary of the most recent pass.
+			struct Statistics
+			{
+				// The number of threads updated.
+				std::size_t threads_updated = 0;
+
+				// The number of threads preempted after the budget was exhausted.
+				std::size_t threads_preempted = 0;
+
+				// The number of entities progressed.
+				std::size_t entities_progressed = 0;
+
+				// The number of entities deferred to the next pass.
+				std::size_t entities_deferred = 0;
+
+				// The time spent progressing threads.
+				Duration elapsed = {};
+			};
+
+			// Sets the amount of time each pass may take. A `budget` of zero disables this limit.
+			void set_budget(Duration budget);
+
+			inline Duration get_budget() const
+			{
+				return budget;
+			}
+
+			inline bool has_budget() const
+			{
+				return (budget > Duration::zero());
+			}
+
+			// Starts a pass over `group_count` entities.
+			void begin_pass(std::size_t group_count, TimePoint now=Clock::now());
+
+			// Retrieves the index of the next entity to progress during this pass.
+			//
+			// The first entity of a pass is always progressed, ensuring every thread eventually makes progress.
+			// Once every entity has been visited, or the budget has been exhausted, this returns `std::nullopt`.
+			std::optional<std::size_t> next_group(TimePoint now);
+
+			// NOTE: The clock is only sampled if a budget has been set.
+			inline std::optional<std::size_t> next_group()
+			{
+				return next_group((has_budget()) ? Clock::now() : TimePoint {});
+			}
+
+			// Indicates whether the budget for the current pass has been exhausted.
+			//
+			// Checked between instructions, allowing long-running threads to be preempted. (See `on_thread_preempted`)
+			bool deadline_reached(TimePoint now) const;
+
+			// NOTE: The clock is only sampled if a budget has been set.
+			inline bool deadline_reached() const
+			{
+				return ((is_active) && (has_budget()) && (Clock::now() >= deadline));
+			}
+
+			// Records that a thread was preempted, carrying its unfinished work over to the next pass.
+			inline void on_thread_preempted()
+			{
+				statistics.threads_preempted++;
+			}
+
+			// Completes the current pass, determining where the next pass should begin.
+			void end_pass(std::size_t threads_updated, TimePoint now=Clock::now());
+
+			inline const Statistics& get_statistics() const
+			{
+				return statistics;
+			}
+
+			// Retrieves the index of the entity the next pass will begin with. (Prior to wrapping)
+			inline std::size_t get_cursor() const
+			{
+				return cursor;
+			}
+
+		private:
+			Duration budget = {};
+
+			TimePoint pass_start = {};
+			TimePoint deadline = {};
+
+			std::size_t cursor = 0;
+
+			std::size_t group_count = 0;
+			std::size_t first_group = 0;
+			std::size_t groups_visited = 0;
+
+			Statistics statistics;
+
+			bool is_active : 1 = false;
+	};
+}
@@ -342,7 +342,7 @@ namespace engine
 	template <>
 	void reflect<OnStateChange>()
 	{
-		engine_meta_type<OnStateChange>()
+		engine_event_type<OnStateChange>()
 			.data<&OnStateChange::from>("from"_hs)
 			.data<&OnStateChange::to>("to"_hs)
 			.data<&OnStateChange::state_activated>("state_activated"_hs)
@@ -359,7 +359,7 @@ namespace engine
 	template <>
 	void reflect<OnStateActivate>()
 	{
-		engine_meta_type<OnStateActivate>()
+		engine_event_type<OnStateActivate>()
 			.data<&OnStateActivate::state>("state"_hs)
 			.ctor
 			<
@@ -381,19 +381,20 @@ namespace engine
 		;
 	}
 
-	GENERATE_EMPTY_DERIVED_TYPE_REFLECTION(OnThreadSpawn, ThreadEvent);
-	GENERATE_EMPTY_DERIVED_TYPE_REFLECTION(OnThreadComplete, ThreadEvent);
-	GENERATE_EMPTY_DERIVED_TYPE_REFLECTION(OnThreadTerminated, ThreadEvent);
-	GENERATE_EMPTY_DERIVED_TYPE_REFLECTION(OnThreadPaused, ThreadEvent);
-	GENERATE_EMPTY_DERIVED_TYPE_REFLECTION(OnThreadResumed, ThreadEvent);
-	GENERATE_EMPTY_DERIVED_TYPE_REFLECTION(OnThreadAttach, ThreadEvent);
-	GENERATE_EMPTY_DERIVED_TYPE_REFLECTION(OnThreadDetach, ThreadEvent);
-	GENERATE_EMPTY_DERIVED_TYPE_REFLECTION(OnThreadUnlink, ThreadEvent);
+	GENERATE_EMPTY_DERIVED_EVENT_REFLECTION(OnThreadSpawn, ThreadEvent);
+	GENERATE_EMPTY_DERIVED_EVENT_REFLECTION(OnThreadComplete, ThreadEvent);
+	GENERATE_EMPTY_DERIVED_EVENT_REFLECTION(OnThreadTerminated, ThreadEvent);
+	GENERATE_EMPTY_DERIVED_EVENT_REFLECTION(OnThreadPaused, ThreadEvent);
+	GENERATE_EMPTY_DERIVED_EVENT_REFLECTION(OnThreadResumed, ThreadEvent);
+	GENERATE_EMPTY_DERIVED_EVENT_REFLECTION(OnThreadAttach, ThreadEvent);
+	GENERATE_EMPTY_DERIVED_EVENT_REFLECTION(OnThreadDetach, ThreadEvent);
+	GENERATE_EMPTY_DERIVED_EVENT_REFLECTION(OnThreadUnlink, ThreadEvent);
+	GENERATE_EMPTY_DERIVED_EVENT_REFLECTION(OnThreadBudgetExceeded, ThreadEvent);
 
 	template <>
 	void reflect<OnThreadVariableUpdate>()
 	{
-		engine_meta_type<OnThreadVariableUpdate>()
+		engine_event_type<OnThreadVariableUpdate>()
 			.base<ThreadEvent>()
 			.data<&OnThreadVariableUpdate::resolved_variable_name>("resolved_variable_name"_hs)
 			.data<&OnThreadVariableUpdate::variable_scope>("variable_scope"_hs)
@@ -404,7 +405,7 @@ namespace engine
 	template <>
 	void reflect<OnThreadEventCaptured>()
 	{
-		engine_meta_type<OnThreadEventCaptured>()
+		engine_event_type<OnThreadEventCaptured>()
 			.base<ThreadEvent>()
 			.data<&OnThreadEventCaptured::event_type_id>("event_type_id"_hs)
 		;
@@ -821,6 +822,7 @@ namespace engine
 		reflect<OnThreadAttach>();
 		reflect<OnThreadDetach>();
 		reflect<OnThreadUnlink>();
+		reflect<OnThreadBudgetExceeded>();
 		reflect<OnThreadVariableUpdate>();
 
 		// Commands:
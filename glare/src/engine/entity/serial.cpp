@@ -11,6 +11,7 @@
 #include "entity_thread_builder.hpp"
 #include "event_trigger_condition.hpp"
 #include "meta_description.hpp"
+#include "entity_pool_config.hpp"
 
 //#include <engine/meta/meta.hpp>
 #include <engine/meta/types.hpp>
@@ -240,8 +241,7 @@ namespace engine
 		{
 			if (!state_path.empty())
 			{
-				// TODO: Optimize.
-				state_data = util::load_json(state_path);
+				state_data = load_archetype_document(state_path);
 			}
 		}
 
@@ -2676,6 +2676,83 @@ namespace engine
 		return process_state_isolated_components(descriptor, state, data, opt_parsing_context);
 	}
 
+	bool process_pool_config
+	(
+		EntityPoolConfig& pool_out,
+		const util::json& pool_content,
+		const MetaParsingContext& opt_parsing_context
+	)
+	{
+		switch (pool_content.type())
+		{
+			case util::json::value_t::boolean:
+				pool_out.enabled = pool_content.get<bool>();
+
+				break;
+
+			case util::json::value_t::number_integer:
+			case util::json::value_t::number_unsigned:
+				pool_out.size = pool_content.get<EntityPoolConfig::Size>();
+				pool_out.enabled = true;
+
+				break;
+
+			case util::json::value_t::object:
+			{
+				pool_out.enabled = util::get_value<bool>(pool_content, "enabled", true);
+
+				util::retrieve_value<EntityPoolConfig::Size>(pool_content, "size", pool_out.size);
+				util::retrieve_value<EntityPoolConfig::Size>(pool_content, "capacity", pool_out.capacity);
+
+				if (auto reset = util::find_any(pool_content, "reset", "reset_components"); reset != pool_content.end())
+				{
+					const auto opt_type_context = opt_parsing_context.get_type_context();
+
+					util::json_for_each<util::json::value_t::string>
+					(
+						*reset,
+
+						[&pool_out, opt_type_context](const util::json& component_name_content)
+						{
+							const auto component_name = component_name_content.get<std::string>();
+
+							auto component_type = (opt_type_context)
+								? opt_type_context->get_component_type(component_name)
+								: meta_type_from_name(component_name)
+							;
+
+							if (!component_type)
+							{
+								print_warn("Unable to resolve pooled component type: {}", component_name);
+
+								return;
+							}
+
+							if (!pool_out.is_reset_component(component_type.id()))
+							{
+								pool_out.reset_components.emplace_back(component_type.id());
+							}
+						}
+					);
+				}
+
+				break;
+			}
+
+			default:
+				print_warn("Invalid pool configuration specified.");
+
+				break;
+		}
+
+		if ((pool_out.capacity) && (pool_out.capacity < pool_out.size))
+		{
+			pool_out.capacity = pool_out.size;
+		}
+
+		return pool_out.enabled;
+	}
+
 	void process_archetype
 	(
 		EntityDescriptor& descriptor,
@@ -2771,9 +2848,17 @@ namespace engine
 			"bone_layer", "bone_layers", "bone_animation_layer", "bone_animation_layers",
 
 			// Handled in callback-based implementation of `process_archetype`.
-			"children"
+			"children",
+
+			// See below.
+			"pool"
 		);
 
+		if (auto pool = data.find("pool"); pool != data.end())
+		{
+			process_pool_config(descriptor.pool, *pool, opt_parsing_context);
+		}
+
 		if (auto model = util::find_any(data, "model", "models"); model != data.end())
 		{
 			engine::load<EntityDescriptor::ModelDetails>(descriptor.model_details, *model);
@@ -2834,8 +2919,7 @@ namespace engine
 			return;
 		}
 
-		// TODO: Optimize via caching, etc.
-		auto instance = util::load_json(archetype_path);
+		auto instance = load_archetype_document(archetype_path);
 
 		process_archetype
 		(
@@ -8,6 +8,7 @@
 #include "entity_target.hpp"
 #include "entity_state_action.hpp"
 #include "entity_instruction.hpp"
+#include "archetype_cache.hpp"
 
 //#include "entity_descriptor.hpp"
 
@@ -41,6 +42,7 @@ namespace engine
 	struct MetaDescription;
 	struct EntityStateRule;
 	struct EntityThreadDescription;
+	struct EntityPoolConfig;
 
 	class AnimationRepository;
 	struct AnimationSlice;
@@ -579,6 +581,17 @@ namespace engine
 		const EntityFactoryContext* opt_factory_context=nullptr
 	);
 
+	// Reads the pooling configuration of an archetype from `pool_content`. (See `EntityPoolConfig`)
+	// 
+	// `pool_content` may be a boolean, an integer (the number of instances to generate ahead of time), or an object.
+	// The return value indicates whether pooling was enabled.
+	bool process_pool_config
+	(
+		EntityPoolConfig& pool_out,
+		const util::json& pool_content,
+		const MetaParsingContext& opt_parsing_context={}
+	);
+
 	void process_archetype
 	(
 		EntityDescriptor& descriptor,
@@ -701,8 +714,7 @@ namespace engine
 			return;
 		}
 
-		// TODO: Optimize via caching, etc.
-		auto instance = util::load_json(archetype_path);
+		auto instance = load_archetype_document(archetype_path);
 
 		process_archetype
 		(
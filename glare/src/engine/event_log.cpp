@@ -0,0 +1,361 @@
+#include "event_log.hpp"
+
+#include "service.hpp"
+
+#include "meta/serial.hpp"
+#include "meta/meta_type_descriptor.hpp"
+
+#include <util/binary/binary_output_stream.hpp>
+#include <util/binary/binary_input_stream.hpp>
+#include <util/binary/standard_binary_output_stream.hpp>
+#include <util/binary/standard_binary_input_stream.hpp>
+
+#include <string>
+#include <string_view>
+#include <sstream>
+#include <optional>
+#include <stdexcept>
+
+// Debugging related:
+#include <util/log.hpp>
+
+namespace engine
+{
+	// EventLogRecorder:
+	EventLogRecorder::EventLogRecorder(util::BinaryOutputStream& data_out, const BinaryFormatConfig& binary_format) :
+		data_out(&data_out),
+		binary_format(binary_format)
+	{
+		data_out.write(MAGIC);
+		data_out.write(VERSION);
+	}
+
+	bool EventLogRecorder::record_event(const MetaAny& event_instance, bool is_queued)
+	{
+		if (finished)
+		{
+			return false;
+		}
+
+		const auto type = event_instance.type();
+
+		// NOTE: Types that can't be resolved by ID are skipped before anything is written,
+		// since a partially written record would leave the remainder of the log unreadable.
+		if ((!type) || (!resolve(type.id())))
+		{
+			skipped_event_count++;
+
+			return false;
+		}
+
+		// Payloads are serialized into `record_buffer` first, then appended to the log only if serialization succeeded.
+		record_buffer.str({});
+		record_buffer.clear();
+
+		auto record_out = util::BinaryOutputStreamWrapper<std::ostream> { record_buffer, data_out->get_network_byte_order() };
+
+		bool payload_serialized = false;
+
+		try
+		{
+			payload_serialized = save_binary(event_instance, record_out, binary_format);
+		}
+		catch (const std::runtime_error&)
+		{
+			payload_serialized = false;
+		}
+
+		if (!payload_serialized)
+		{
+			print_warn("Failed to record event of type: #{}", type.id());
+
+			skipped_event_count++;
+
+			return false;
+		}
+
+		data_out->write
+		(
+			(is_queued)
+			? EventLogRecordType::QueueEvent
+			: EventLogRecordType::TriggerEvent
+		);
+
+		// NOTE: Written with a length prefix, allowing the player to skip events it can't reconstruct.
+		data_out->write(std::string_view { record_buffer.view() });
+
+		event_count++;
+
+		return true;
+	}
+
+	void EventLogRecorder::record_update(app::Milliseconds time, float delta)
+	{
+		if (finished)
+		{
+			return;
+		}
+
+		data_out->write(EventLogRecordType::Update);
+		data_out->write(time);
+		data_out->write(delta);
+
+		update_count++;
+	}
+
+	void EventLogRecorder::record_fixed_update(app::Milliseconds time, float delta)
+	{
+		if (finished)
+		{
+			return;
+		}
+
+		data_out->write(EventLogRecordType::FixedUpdate);
+		data_out->write(time);
+		data_out->write(delta);
+	}
+
+	void EventLogRecorder::finish()
+	{
+		if (finished)
+		{
+			return;
+		}
+
+		data_out->write(EventLogRecordType::End);
+
+		finished = true;
+	}
+
+	bool EventLogRecorder::is_finished() const
+	{
+		return finished;
+	}
+
+	std::size_t EventLogRecorder::get_event_count() const
+	{
+		return event_count;
+	}
+
+	std::size_t EventLogRecorder::get_skipped_event_count() const
+	{
+		return skipped_event_count;
+	}
+
+	std::size_t EventLogRecorder::get_update_count() const
+	{
+		return update_count;
+	}
+
+	// EventLogPlayer:
+	EventLogPlayer::EventLogPlayer(Service& service, util::BinaryInputStream& data_in) :
+		service(service),
+		data_in(data_in)
+	{
+		try
+		{
+			const auto magic = data_in.read<EventLogRecorder::Magic>();
+			const auto version = data_in.read<EventLogRecorder::Version>();
+
+			valid = ((magic == EventLogRecorder::MAGIC) && (version == EventLogRecorder::VERSION));
+		}
+		catch (const std::runtime_error&)
+		{
+			valid = false;
+		}
+
+		if (!valid)
+		{
+			print_warn("Invalid event log header.");
+
+			finished = true;
+
+			return;
+		}
+
+		service.set_event_replay_mode(true);
+	}
+
+	EventLogPlayer::~EventLogPlayer()
+	{
+		if (valid)
+		{
+			service.set_event_replay_mode(false);
+		}
+	}
+
+	bool EventLogPlayer::step()
+	{
+		while (!finished)
+		{
+			switch (read_record_type())
+			{
+				case EventLogRecordType::TriggerEvent:
+					replay_event(false);
+
+					break;
+
+				case EventLogRecordType::QueueEvent:
+					replay_event(true);
+
+					break;
+
+				case EventLogRecordType::Update:
+				{
+					const auto time = data_in.read<app::Milliseconds>();
+					const auto delta = data_in.read<float>();
+
+					service.update(time, delta);
+
+					update_count++;
+
+					return true;
+				}
+
+				case EventLogRecordType::FixedUpdate:
+				{
+					const auto time = data_in.read<app::Milliseconds>();
+					const auto delta = data_in.read<float>();
+
+					service.fixed_update(time, delta);
+
+					break;
+				}
+
+				case EventLogRecordType::End:
+					finished = true;
+
+					break;
+
+				default:
+					print_warn("Unknown event log record; stopping playback.");
+
+					finished = true;
+
+					break;
+			}
+		}
+
+		return false;
+	}
+
+	std::size_t EventLogPlayer::run()
+	{
+		const auto initial_update_count = update_count;
+
+		while (step()) {}
+
+		return (update_count - initial_update_count);
+	}
+
+	bool EventLogPlayer::is_valid() const
+	{
+		return valid;
+	}
+
+	bool EventLogPlayer::is_finished() const
+	{
+		return finished;
+	}
+
+	std::size_t EventLogPlayer::get_event_count() const
+	{
+		return event_count;
+	}
+
+	std::size_t EventLogPlayer::get_failed_event_count() const
+	{
+		return failed_event_count;
+	}
+
+	std::size_t EventLogPlayer::get_update_count() const
+	{
+		return update_count;
+	}
+
+	EventLogRecordType EventLogPlayer::read_record_type()
+	{
+		// NOTE: Logs that were never finished (e.g. due to a crash) simply end at the last complete record.
+		if (data_in.end_of_file())
+		{
+			return EventLogRecordType::End;
+		}
+
+		try
+		{
+			return data_in.read<EventLogRecordType>();
+		}
+		catch (const std::runtime_error&)
+		{
+			return EventLogRecordType::End;
+		}
+	}
+
+	bool EventLogPlayer::replay_event(bool is_queued)
+	{
+		auto payload = std::string {};
+
+		try
+		{
+			data_in.read_to(payload);
+		}
+		catch (const std::runtime_error&)
+		{
+			// NOTE: Only the final record of a log that was never finished may be truncated.
+			print_warn("Truncated event log record; stopping playback.");
+
+			finished = true;
+
+			return false;
+		}
+
+		// NOTE: Failures past this point only affect the current record, since its full payload has already been read.
+		auto payload_stream = std::istringstream { std::move(payload) };
+
+		auto payload_in = util::BinaryInputStreamWrapper<std::istream> { payload_stream, data_in.get_network_byte_order() };
+
+		auto descriptor = std::optional<MetaTypeDescriptor> {};
+
+		try
+		{
+			descriptor = impl::load_descriptor_from_binary(payload_in, BinaryFormatConfig::any_format());
+		}
+		catch (const std::runtime_error&)
+		{
+			descriptor = std::nullopt;
+		}
+
+		if (!descriptor)
+		{
+			print_warn("Failed to load recorded event.");
+
+			failed_event_count++;
+
+			return false;
+		}
+
+		auto event_instance = descriptor->instance();
+
+		if (!event_instance)
+		{
+			print_warn("Failed to construct recorded event of type: #{}", descriptor->get_type_id());
+
+			failed_event_count++;
+
+			return false;
+		}
+
+		if (is_queued)
+		{
+			service.queue_event(std::move(event_instance));
+		}
+		else
+		{
+			service.event(std::move(event_instance));
+		}
+
+		event_count++;
+
+		return true;
+	}
+}
@@ -0,0 +1,159 @@
+#pragma once
+
+#include "meta/types.hpp"
+#include "meta/binary_format_config.hpp"
+
+#include <app/types.hpp>
+
+#include <sstream>
+#include <cstdint>
+#include <cstddef>
+
+namespace util
+{
+	class BinaryOutputStream;
+	class BinaryInputStream;
+}
+
+namespace engine
+{
+	class Service;
+
+	// Record identifiers used by the event log format. (See `EventLogRecorder`)
+	enum class EventLogRecordType : std::uint8_t
+	{
+		// Marks the end of the log.
+		End          = 0,
+
+		// An event that was triggered immediately.
+		TriggerEvent = 1,
+
+		// An event that was queued for the next dispatch pass.
+		QueueEvent   = 2,
+
+		// A call to `Service::update`, followed by its `time` and `delta` arguments.
+		Update       = 3,
+
+		// A call to `Service::fixed_update`, followed by its `time` and `delta` arguments.
+		FixedUpdate  = 4,
+	};
+
+	// Writes events passing through a `Service` to a compact binary log.
+	//
+	// Only root events are recorded; i.e. events raised from outside of an event handler,
+	// including input events, events submitted from other threads and timed events at
+	// the point they are released. Events raised by handlers are not recorded, since
+	// those are produced again when the log is replayed. (See `EventLogPlayer`)
+	//
+	// Log layout:
+	// [Magic][Version] { [Record type][Payload] }... [End]
+	//
+	// Event payloads use the standard binary object format, (See `save_binary`) prefixed by their size in bytes.
+	// Events are serialized before anything is written to the log, meaning that a failure to serialize an event never
+	// leaves a partial record behind. Likewise, an event that fails to load during playback does not affect later records.
+	class EventLogRecorder
+	{
+		public:
+			using Magic   = std::uint32_t;
+			using Version = std::uint16_t;
+
+			// "GLEL" (Glare Event Log)
+			static constexpr Magic MAGIC     = 0x4C454C47;
+			static constexpr Version VERSION = 2;
+
+			// Writes the log header to `data_out`.
+			EventLogRecorder(util::BinaryOutputStream& data_out, const BinaryFormatConfig& binary_format={});
+
+			EventLogRecorder(const EventLogRecorder&) = delete;
+			EventLogRecorder(EventLogRecorder&&) noexcept = default;
+
+			// Records the object held by `event_instance`.
+			//
+			// Events whose type cannot be resolved by ID are skipped,
+			// since they could not be reconstructed during playback.
+			//
+			// The return-value of this method indicates whether the event was recorded.
+			bool record_event(const MetaAny& event_instance, bool is_queued);
+
+			void record_update(app::Milliseconds time, float delta);
+			void record_fixed_update(app::Milliseconds time, float delta);
+
+			// Writes the end-of-log marker. Further records are ignored.
+			void finish();
+
+			bool is_finished() const;
+
+			std::size_t get_event_count() const;
+			std::size_t get_skipped_event_count() const;
+			std::size_t get_update_count() const;
+		protected:
+			util::BinaryOutputStream* data_out = nullptr;
+
+			BinaryFormatConfig binary_format;
+
+			// Scratch buffer used to serialize event payloads. (See `record_event`)
+			std::ostringstream record_buffer;
+
+			std::size_t event_count         = 0;
+			std::size_t skipped_event_count = 0;
+			std::size_t update_count        = 0;
+
+			bool finished : 1 = false;
+	};
+
+	// Replays a log produced by `EventLogRecorder` into a `Service` as quickly as possible.
+	//
+	// Recorded events are re-raised in their original order, and each recorded
+	// update is re-executed with its original `time` and `delta` values.
+	//
+	// While a player exists, timed events are not released by `service`,
+	// since their delivery is already part of the log. (See `Service::set_event_replay_mode`)
+	//
+	// NOTE: Events recorded during an update (e.g. timed events and events submitted from other threads)
+	// are replayed ahead of that update, meaning they are handled during its standard dispatch pass.
+	class EventLogPlayer
+	{
+		public:
+			// Reads the log header from `data_in`.
+			// If the header is invalid, the player will be finished immediately. (See `is_valid`)
+			EventLogPlayer(Service& service, util::BinaryInputStream& data_in);
+
+			EventLogPlayer(const EventLogPlayer&) = delete;
+			EventLogPlayer(EventLogPlayer&&) = delete;
+
+			~EventLogPlayer();
+
+			// Replays records up to and including the next recorded update.
+			//
+			// The return-value of this method indicates whether an update was replayed.
+			bool step();
+
+			// Replays the remainder of the log.
+			//
+			// The return-value of this method is the number of updates replayed.
+			std::size_t run();
+
+			bool is_valid() const;
+			bool is_finished() const;
+
+			std::size_t get_event_count() const;
+			std::size_t get_failed_event_count() const;
+			std::size_t get_update_count() const;
+		protected:
+			// Reads the next record type, returning `EventLogRecordType::End` if the stream is exhausted.
+			EventLogRecordType read_record_type();
+
+			bool replay_event(bool is_queued);
+
+			Service& service;
+
+			util::BinaryInputStream& data_in;
+
+			std::size_t event_count        = 0;
+			std::size_t failed_event_count = 0;
+			std::size_t update_count       = 0;
+
+			bool valid    : 1 = false;
+			bool finished : 1 = false;
+	};
+}
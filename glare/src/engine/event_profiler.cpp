@@ -0,0 +1,129 @@
+#include "event_profiler.hpp"
+
+#include <util/json.hpp>
+#include <util/io.hpp>
+
+namespace engine
+{
+	EventProfiler::EventProfiler()
+		: epoch(Clock::now())
+	{}
+
+	void EventProfiler::on_pass(std::string_view pass_name, TimePoint start)
+	{
+		const auto duration = (Clock::now() - start);
+
+		pass_times[pass_name] += duration;
+
+		record_trace(pass_name, "pass", start, duration);
+	}
+
+	const EventProfiler::EventTypeStats* EventProfiler::get_stats(MetaTypeID type_key) const
+	{
+		if (const auto it = event_stats.find(type_key); it != event_stats.end())
+		{
+			return &(it->second);
+		}
+
+		return nullptr;
+	}
+
+	const EventProfiler::EventTypeStatsMap& EventProfiler::get_event_stats() const
+	{
+		return event_stats;
+	}
+
+	EventProfiler::Duration EventProfiler::get_pass_time(std::string_view pass_name) const
+	{
+		if (const auto it = pass_times.find(pass_name); it != pass_times.end())
+		{
+			return it->second;
+		}
+
+		return {};
+	}
+
+	const std::vector<EventProfiler::TraceEntry>& EventProfiler::get_trace() const
+	{
+		return trace;
+	}
+
+	void EventProfiler::set_trace_capacity(std::size_t capacity)
+	{
+		trace_capacity = capacity;
+
+		if (trace.size() > trace_capacity)
+		{
+			trace.resize(trace_capacity);
+		}
+	}
+
+	void EventProfiler::reset()
+	{
+		event_stats.clear();
+		pass_times.clear();
+		trace.clear();
+
+		epoch = Clock::now();
+	}
+
+	std::string EventProfiler::to_chrome_trace() const
+	{
+		using Microseconds = std::chrono::duration<double, std::micro>;
+
+		auto trace_events = util::json::array();
+
+		for (const auto& entry : trace)
+		{
+			trace_events.push_back
+			(
+				{
+					{ "name", entry.name },
+					{ "cat", entry.category },
+					{ "ph", "X" },
+					{ "ts", Microseconds(entry.start - epoch).count() },
+					{ "dur", Microseconds(entry.duration).count() },
+					{ "pid", 0 },
+					{ "tid", 0 }
+				}
+			);
+		}
+
+		auto event_summary = util::json::object();
+
+		for (const auto& [type_key, stats] : event_stats)
+		{
+			event_summary[std::string { stats.type_name }] =
+			{
+				{ "enqueue_count", stats.enqueue_count },
+				{ "trigger_count", stats.trigger_count },
+				{ "handler_count", stats.handler_count },
+				{ "handler_time_us", Microseconds(stats.handler_time).count() }
+			};
+		}
+
+		auto document = util::json
+		{
+			{ "traceEvents", std::move(trace_events) },
+			{ "displayTimeUnit", "ms" },
+			{ "otherData", { { "event_types", std::move(event_summary) } } }
+		};
+
+		return document.dump();
+	}
+
+	void EventProfiler::export_chrome_trace(const std::filesystem::path& path) const
+	{
+		util::save_string(to_chrome_trace(), path);
+	}
+
+	void EventProfiler::record_trace(std::string_view name, std::string_view category, TimePoint start, Duration duration)
+	{
+		if (trace.size() >= trace_capacity)
+		{
+			return;
+		}
+
+		trace.emplace_back(TraceEntry { name, category, start, duration });
+	}
+}
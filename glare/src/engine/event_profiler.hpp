@@ -0,0 +1,160 @@
+#pragma once
+
+#include "meta/types.hpp"
+#include "meta/short_name.hpp"
+
+#include <entt/core/type_info.hpp>
+
+#include <chrono>
+#include <unordered_map>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <filesystem>
+#include <cstddef>
+
+// Enables per-event-type dispatch profiling in `Service`.
+// (Normally controlled by the `GLARE_ENGINE_EVENT_PROFILING` CMake option)
+#ifndef GLARE_ENGINE_EVENT_PROFILING
+	#define GLARE_ENGINE_EVENT_PROFILING 0
+#endif
+
+namespace engine
+{
+	// Collects per-event-type dispatch statistics for `Service`.
+	//
+	// When `enabled` is false, `Service` neither stores nor calls into this type,
+	// meaning that the profiling hooks compile away entirely.
+	class EventProfiler
+	{
+		public:
+			using Clock     = std::chrono::steady_clock;
+			using TimePoint = Clock::time_point;
+			using Duration  = Clock::duration;
+
+			// Indicates whether event profiling has been compiled in.
+			static constexpr bool enabled = static_cast<bool>(GLARE_ENGINE_EVENT_PROFILING);
+
+			// The default maximum number of trace entries retained. (See `set_trace_capacity`)
+			static constexpr std::size_t DEFAULT_TRACE_CAPACITY = 65536;
+
+			struct EventTypeStats
+			{
+				std::string_view type_name;
+
+				// Number of times an event of this type was queued.
+				std::size_t enqueue_count = 0;
+
+				// Number of times an event of this type was triggered immediately.
+				std::size_t trigger_count = 0;
+
+				// Number of handler invocations caused by immediate triggers.
+				std::size_t handler_count = 0;
+
+				// Accumulated time spent in handlers for immediate triggers.
+				Duration handler_time = {};
+			};
+
+			// A single timed span, as reported by `to_chrome_trace`.
+			struct TraceEntry
+			{
+				std::string_view name;
+				std::string_view category;
+
+				TimePoint start;
+				Duration duration;
+			};
+
+			using EventTypeStatsMap = std::unordered_map<MetaTypeID, EventTypeStats>;
+
+			template <typename EventType>
+			static MetaTypeID get_type_key()
+			{
+				return entt::type_hash<EventType>::value();
+			}
+
+			EventProfiler();
+
+			template <typename EventType>
+			void on_enqueue()
+			{
+				get_or_create_stats<EventType>().enqueue_count++;
+			}
+
+			template <typename EventType>
+			void on_trigger(TimePoint start, std::size_t handler_count)
+			{
+				const auto duration = (Clock::now() - start);
+
+				auto& stats = get_or_create_stats<EventType>();
+
+				stats.trigger_count++;
+				stats.handler_count += handler_count;
+				stats.handler_time += duration;
+
+				record_trace(stats.type_name, "event", start, duration);
+			}
+
+			// Records the time spent updating one of `Service`'s event handlers.
+			//
+			// Handlers for queued events execute during these passes,
+			// meaning that their time is attributed to the pass, rather than the event type.
+			void on_pass(std::string_view pass_name, TimePoint start);
+
+			// Retrieves the statistics recorded for the type identified by `type_key`. (See `get_type_key`)
+			const EventTypeStats* get_stats(MetaTypeID type_key) const;
+
+			template <typename EventType>
+			const EventTypeStats* get_stats() const
+			{
+				return get_stats(get_type_key<EventType>());
+			}
+
+			// Retrieves the statistics recorded for every event type observed.
+			const EventTypeStatsMap& get_event_stats() const;
+
+			// Retrieves the accumulated time spent in the pass named `pass_name`. (See `on_pass`)
+			Duration get_pass_time(std::string_view pass_name) const;
+
+			const std::vector<TraceEntry>& get_trace() const;
+
+			// Sets the maximum number of trace entries retained.
+			// Once this limit has been reached, new trace entries are discarded. (Statistics continue to accumulate)
+			void set_trace_capacity(std::size_t capacity);
+
+			// Clears all statistics and trace entries.
+			void reset();
+
+			// Generates a JSON document in the Chrome trace-event format. (`chrome://tracing`, Perfetto, etc.)
+			std::string to_chrome_trace() const;
+
+			// Writes the output of `to_chrome_trace` to `path`.
+			void export_chrome_trace(const std::filesystem::path& path) const;
+		protected:
+			template <typename EventType>
+			EventTypeStats& get_or_create_stats()
+			{
+				auto [it, inserted] = event_stats.try_emplace(get_type_key<EventType>());
+
+				if (inserted)
+				{
+					it->second.type_name = short_name<EventType>();
+				}
+
+				return it->second;
+			}
+
+			void record_trace(std::string_view name, std::string_view category, TimePoint start, Duration duration);
+
+			EventTypeStatsMap event_stats;
+
+			std::unordered_map<std::string_view, Duration> pass_times;
+
+			std::vector<TraceEntry> trace;
+
+			std::size_t trace_capacity = DEFAULT_TRACE_CAPACITY;
+
+			// Reference point for trace timestamps.
+			TimePoint epoch;
+	};
+}
@@ -15,9 +15,9 @@
 
 namespace engine
 {
-	GENERATE_EMPTY_DERIVED_TYPE_REFLECTION(OnButtonPressed,  ButtonEvent);
-	GENERATE_EMPTY_DERIVED_TYPE_REFLECTION(OnButtonReleased, ButtonEvent);
-	GENERATE_EMPTY_DERIVED_TYPE_REFLECTION(OnButtonDown,     ButtonEvent); // OnButtonHeld
+	GENERATE_EMPTY_DERIVED_EVENT_REFLECTION(OnButtonPressed,  ButtonEvent);
+	GENERATE_EMPTY_DERIVED_EVENT_REFLECTION(OnButtonReleased, ButtonEvent);
+	GENERATE_EMPTY_DERIVED_EVENT_REFLECTION(OnButtonDown,     ButtonEvent); // OnButtonHeld
 
 	template <>
 	void reflect<InputComponent>()
@@ -73,7 +73,7 @@ namespace engine
 	template <>
 	void reflect<OnInput>()
 	{
-		engine_meta_type<OnInput>()
+		engine_event_type<OnInput>()
 			.data<&OnInput::previous_state>("previous_state"_hs)
 		;
 	}
@@ -81,7 +81,7 @@ namespace engine
 	template <>
 	void reflect<OnInputState>()
 	{
-		engine_meta_type<OnInputState>()
+		engine_event_type<OnInputState>()
 			.base<OnInput>()
 		;
 	}
@@ -98,7 +98,7 @@ namespace engine
 	template <>
 	void reflect<OnAnalogInput>()
 	{
-		engine_meta_type<OnAnalogInput>()
+		engine_event_type<OnAnalogInput>()
 			.data<&OnAnalogInput::analog>("analog"_hs)
 			.data<&OnAnalogInput::value>("value"_hs)
 			.data<&OnAnalogInput::angle>("angle"_hs)
@@ -108,7 +108,7 @@ namespace engine
 	template <>
 	void reflect<OnAnalogInputState>()
 	{
-		engine_meta_type<OnAnalogInputState>()
+		engine_event_type<OnAnalogInputState>()
 			.base<OnAnalogInput>()
 		;
 	}
@@ -116,7 +116,7 @@ namespace engine
 	template <>
 	void reflect<OnKeyboardState>()
 	{
-		engine_meta_type<OnKeyboardState>()
+		engine_event_type<OnKeyboardState>()
 			.data<&OnKeyboardState::service>("service"_hs)
 			.data<&OnKeyboardState::keyboard_state>("keyboard_state"_hs)
 		;
@@ -125,7 +125,7 @@ namespace engine
 	template <>
 	void reflect<OnMouseState>()
 	{
-		engine_meta_type<OnMouseState>()
+		engine_event_type<OnMouseState>()
 			.data<&OnMouseState::service>("service"_hs)
 			.data<&OnMouseState::mouse_state>("mouse_state"_hs)
 		;
@@ -240,6 +240,84 @@ namespace engine
 		return result;
 	}
 
+	std::size_t insert_component
+	(
+		Registry& registry,
+		const Entity* entities, std::size_t count,
+		const MetaTypeDescriptor& component,
+		const MetaEvaluationContext* opt_evaluation_context
+	)
+	{
+		using namespace engine::literals;
+
+		if ((!entities) || (!count))
+		{
+			return 0;
+		}
+
+		const auto type = component.get_type();
+
+		auto insert_fn = type.func("insert_meta_component"_hs);
+
+		if (!insert_fn)
+		{
+			std::size_t entities_affected = 0;
+
+			for (std::size_t entity_index = 0; entity_index < count; entity_index++)
+			{
+				if (emplace_component(registry, entities[entity_index], component, opt_evaluation_context))
+				{
+					entities_affected++;
+				}
+			}
+
+			return entities_affected;
+		}
+
+		// NOTE: The first entity is used as the source for instantiation.
+		// (Unused when `component` has no indirection)
+		const auto source_entity = entities[0];
+
+		auto instance = MetaAny {};
+
+		if (opt_evaluation_context)
+		{
+			instance = component.instance(true, registry, source_entity, *opt_evaluation_context);
+		}
+		else
+		{
+			instance = component.instance(true, registry, source_entity);
+		}
+
+		if (!instance)
+		{
+			print_warn("Failed to instantiate component: #{} for batch of {} entities", component.get_type_id(), count);
+
+			return 0;
+		}
+
+		auto result = insert_fn.invoke
+		(
+			{},
+
+			entt::forward_as_meta(registry),
+			entities,
+			count,
+			entt::forward_as_meta(instance)
+		);
+
+		const auto* entities_affected = result.try_cast<std::size_t>();
+
+		if ((!entities_affected) || (!(*entities_affected)))
+		{
+			print_warn("Failed to attach component: #{} to batch of {} entities", component.get_type_id(), count);
+
+			return 0;
+		}
+
+		return *entities_affected;
+	}
+
 	bool update_component_fields
 	(
 		Registry& registry, Entity entity,
@@ -2,6 +2,8 @@
 
 #include "types.hpp"
 
+#include <cstddef>
+
 namespace engine
 {
 	struct MetaTypeDescriptor;
@@ -45,6 +47,21 @@ namespace engine
 		const MetaEvaluationContext* opt_evaluation_context=nullptr
 	);
 
+	// Constructs a single component instance based on the description specified,
+	// then attaches a copy of it to each of the `count` entities starting at `entities`.
+	// 
+	// NOTE: Since the component is only instantiated once, `component` should not have indirection.
+	// If the component type cannot be copied in bulk, this falls back to calling `emplace_component` for each entity.
+	// 
+	// The return value indicates the number of entities the component was attached to.
+	std::size_t insert_component
+	(
+		Registry& registry,
+		const Entity* entities, std::size_t count,
+		const MetaTypeDescriptor& component,
+		const MetaEvaluationContext* opt_evaluation_context=nullptr
+	);
+
 	// Attempts to update a component attached to `entity` using the description specified.
 	// 
 	// This returns false if the component does not currently exist for `entity`.
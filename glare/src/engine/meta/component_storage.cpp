@@ -3,11 +3,331 @@
 #include "hash.hpp"
 //#include "function.hpp"
 
+#include <unordered_map>
+#include <new>
+#include <cstring>
+#include <cassert>
+
 // Debugging related:
 #include <util/log.hpp>
 
 namespace engine
 {
+	static std::unordered_map<MetaTypeID, ComponentStorageOps>& get_component_storage_ops_table()
+	{
+		static auto component_storage_ops_table = std::unordered_map<MetaTypeID, ComponentStorageOps> {};
+
+		return component_storage_ops_table;
+	}
+
+	// ComponentStorageOps:
+	void ComponentStorageOps::register_type(MetaTypeID type_id, const ComponentStorageOps& ops)
+	{
+		get_component_storage_ops_table()[type_id] = ops;
+	}
+
+	const ComponentStorageOps* ComponentStorageOps::get(MetaTypeID type_id)
+	{
+		const auto& component_storage_ops_table = get_component_storage_ops_table();
+
+		if (const auto it = component_storage_ops_table.find(type_id); it != component_storage_ops_table.end())
+		{
+			return &(it->second);
+		}
+
+		return nullptr;
+	}
+
+	// StoredComponent:
+	StoredComponent::StoredComponent(MetaAny&& instance) :
+		meta_instance(std::move(instance))
+	{}
+
+	StoredComponent::StoredComponent(const ComponentStorageOps& ops) :
+		ops(&ops)
+	{}
+
+	StoredComponent::StoredComponent(const StoredComponent& other)
+	{
+		copy_from(other);
+	}
+
+	StoredComponent::StoredComponent(StoredComponent&& other) noexcept
+	{
+		move_from(std::move(other));
+	}
+
+	StoredComponent& StoredComponent::operator=(const StoredComponent& other)
+	{
+		if (this != &other)
+		{
+			reset();
+			copy_from(other);
+		}
+
+		return *this;
+	}
+
+	StoredComponent& StoredComponent::operator=(StoredComponent&& other) noexcept
+	{
+		if (this != &other)
+		{
+			reset();
+			move_from(std::move(other));
+		}
+
+		return *this;
+	}
+
+	StoredComponent::~StoredComponent()
+	{
+		reset();
+	}
+
+	bool StoredComponent::store(Registry& registry, Entity entity, bool store_as_copy)
+	{
+		assert(ops);
+
+		if (!ops)
+		{
+			return false;
+		}
+
+		const auto store_fn = (store_as_copy)
+			? ops->copy
+			: ops->store
+		;
+
+		if (!store_fn)
+		{
+			return false;
+		}
+
+		destroy_instance();
+		allocate();
+
+		holds_instance = store_fn(registry, entity, data());
+
+		return holds_instance;
+	}
+
+	bool StoredComponent::retrieve(Registry& registry, Entity entity)
+	{
+		using namespace engine::literals;
+
+		if (ops)
+		{
+			if (!holds_instance)
+			{
+				return false;
+			}
+
+			const auto result = ops->retrieve(registry, entity, data());
+
+			destroy_instance();
+
+			return result;
+		}
+
+		if (!meta_instance)
+		{
+			return false;
+		}
+
+		auto component_type = meta_instance.type();
+
+		if (!component_type)
+		{
+			print_warn("Unable to resolve meta-type during storage-retrieval operation.");
+
+			return false;
+		}
+
+		auto restore_fn = component_type.func("emplace_meta_component"_hs);
+
+		if (!restore_fn)
+		{
+			print_warn("Unable to resolve component restoration function during storage-retrieval operation.");
+
+			return false;
+		}
+
+		auto result = restore_fn.invoke
+		(
+			{},
+			entt::forward_as_meta(registry),
+			entt::forward_as_meta(entity),
+			entt::forward_as_meta(std::move(meta_instance))
+		);
+
+		meta_instance = {};
+
+		return static_cast<bool>(result);
+	}
+
+	MetaTypeID StoredComponent::type_id() const
+	{
+		if (ops)
+		{
+			return ops->type_id;
+		}
+
+		if (meta_instance)
+		{
+			return meta_instance.type().id();
+		}
+
+		return {};
+	}
+
+	bool StoredComponent::has_value() const
+	{
+		if (ops)
+		{
+			return holds_instance;
+		}
+
+		return static_cast<bool>(meta_instance);
+	}
+
+	bool StoredComponent::uses_inline_storage() const
+	{
+		return ((ops) && (ops->size <= inline_capacity) && (ops->alignment <= alignof(std::max_align_t)));
+	}
+
+	void* StoredComponent::data()
+	{
+		return (uses_inline_storage())
+			? static_cast<void*>(inline_instance)
+			: heap_instance
+		;
+	}
+
+	const void* StoredComponent::data() const
+	{
+		return (uses_inline_storage())
+			? static_cast<const void*>(inline_instance)
+			: heap_instance
+		;
+	}
+
+	void StoredComponent::allocate()
+	{
+		if ((!ops) || (uses_inline_storage()) || (heap_instance))
+		{
+			return;
+		}
+
+		heap_instance = ::operator new(ops->size, std::align_val_t { ops->alignment });
+	}
+
+	void StoredComponent::destroy_instance()
+	{
+		if (!holds_instance)
+		{
+			return;
+		}
+
+		if ((ops) && (ops->destroy))
+		{
+			ops->destroy(data());
+		}
+
+		holds_instance = false;
+	}
+
+	void StoredComponent::reset()
+	{
+		destroy_instance();
+
+		if (heap_instance)
+		{
+			::operator delete(heap_instance, std::align_val_t { ops->alignment });
+
+			heap_instance = nullptr;
+		}
+
+		ops = nullptr;
+		meta_instance = {};
+	}
+
+	void StoredComponent::copy_from(const StoredComponent& other)
+	{
+		ops = other.ops;
+
+		if (!ops)
+		{
+			meta_instance = other.meta_instance;
+
+			return;
+		}
+
+		if (!other.holds_instance)
+		{
+			return;
+		}
+
+		if (ops->trivially_copyable)
+		{
+			allocate();
+
+			std::memcpy(data(), other.data(), ops->size);
+
+			holds_instance = true;
+		}
+		else if (ops->copy_construct)
+		{
+			allocate();
+
+			ops->copy_construct(data(), other.data());
+
+			holds_instance = true;
+		}
+
+		// NOTE: Non-copyable instances are not copied, similar to `MetaAny`.
+	}
+
+	void StoredComponent::move_from(StoredComponent&& other)
+	{
+		ops = other.ops;
+
+		if (!ops)
+		{
+			meta_instance = std::move(other.meta_instance);
+
+			return;
+		}
+
+		if (!uses_inline_storage())
+		{
+			// Take ownership of the existing allocation.
+			heap_instance = other.heap_instance;
+			holds_instance = other.holds_instance;
+
+			other.heap_instance = nullptr;
+			other.holds_instance = false;
+		}
+		else if (other.holds_instance)
+		{
+			if (ops->trivially_copyable)
+			{
+				std::memcpy(inline_instance, other.inline_instance, ops->size);
+			}
+			else
+			{
+				// NOTE: Destroys the instance held by `other`.
+				ops->relocate(inline_instance, other.inline_instance);
+			}
+
+			holds_instance = true;
+
+			other.holds_instance = false;
+		}
+
+		other.ops = nullptr;
+	}
+
+	// ComponentStorage:
 	std::size_t ComponentStorage::store(Registry& registry, Entity entity, const MetaStorageDescription& component_details, bool store_as_copy, bool skip_existing)
 	{
 		using namespace engine::literals;
@@ -27,7 +347,7 @@ namespace engine
 
 				for (const auto& existing : components)
 				{
-					if (existing.type().id() == component_entry) // (existing.type() == component_type)
+					if (existing.type_id() == component_entry) // (existing.type() == component_type)
 					{
 						already_exists = true;
 
@@ -41,6 +361,25 @@ namespace engine
 				}
 			}
 
+			// Fast path: Move (or copy) the component directly, without reflection.
+			if (const auto* ops = ComponentStorageOps::get(component_entry))
+			{
+				auto& stored_component = components.emplace_back(*ops);
+
+				if (stored_component.store(registry, entity, store_as_copy))
+				{
+					count++;
+				}
+				else
+				{
+					components.pop_back();
+
+					print_warn("Unable to store instance of component #{} during storage operation. (maybe try `persist` instead of `add`?)", component_entry);
+				}
+
+				continue;
+			}
+
 			auto component_type = resolve(component_entry);
 
 			if (!component_type)
@@ -88,8 +427,6 @@ namespace engine
 
 	std::size_t ComponentStorage::retrieve(Registry& registry, Entity entity)
 	{
-		using namespace engine::literals;
-
 		if (empty())
 		{
 			return 0;
@@ -106,33 +443,7 @@ namespace engine
 				continue;
 			}
 
-			auto component_type = instance.type();
-
-			if (!component_type)
-			{
-				print_warn("Unable to resolve meta-type during storage-retrieval operation.");
-
-				continue;
-			}
-
-			auto restore_fn = component_type.func("emplace_meta_component"_hs);
-
-			if (!restore_fn)
-			{
-				print_warn("Unable to resolve component restoration function during storage-retrieval operation.");
-
-				continue;
-			}
-
-			auto result = restore_fn.invoke
-			(
-				{},
-				entt::forward_as_meta(registry),
-				entt::forward_as_meta(entity),
-				entt::forward_as_meta(std::move(instance))
-			);
-
-			if (!result)
+			if (!instance.retrieve(registry, entity))
 			{
 				print_warn("Unexpected failure during component restoration.");
 
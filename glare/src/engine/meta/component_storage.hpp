@@ -3,14 +3,137 @@
 #include "types.hpp"
 //#include "meta/types.hpp"
 
+#include <cstddef>
+
 namespace engine
 {
+	// Type-specific operations used to move component instances between a registry and `ComponentStorage`.
+	//
+	// Entries are registered once per type during reflection, allowing components to be
+	// stored and retrieved without looking up and invoking reflected functions.
+	// (See `impl::register_component_storage_ops`)
+	struct ComponentStorageOps
+	{
+		// Moves (or copies) the component from `entity` into the uninitialized memory at `instance_out`.
+		using StoreFn    = bool(*)(Registry& registry, Entity entity, void* instance_out);
+
+		// Moves the component at `instance` into `registry`, attaching it to `entity`.
+		// NOTE: The object at `instance` remains alive, and must still be destroyed.
+		using RetrieveFn = bool(*)(Registry& registry, Entity entity, void* instance);
+
+		using CopyFn     = void(*)(void* destination, const void* source);
+		using RelocateFn = void(*)(void* destination, void* source);
+		using DestroyFn  = void(*)(void* instance);
+
+		// Registers (or replaces) the entry for the reflected type identified by `type_id`.
+		//
+		// This is not thread-safe, and should only be called during reflection.
+		static void register_type(MetaTypeID type_id, const ComponentStorageOps& ops);
+
+		// Retrieves the entry for the reflected type identified by `type_id`, if one has been registered.
+		static const ComponentStorageOps* get(MetaTypeID type_id);
+
+		MetaTypeID type_id = {};
+
+		std::size_t size = 0;
+		std::size_t alignment = 0;
+
+		// Moves the component out of the registry, removing it from the entity.
+		StoreFn store = nullptr;
+
+		// Copies the component, leaving the original instance attached. (`nullptr` if not copyable)
+		StoreFn copy = nullptr;
+
+		RetrieveFn retrieve = nullptr;
+
+		// The following are `nullptr` for trivially copyable types, which are copied using `std::memcpy`:
+		CopyFn copy_construct = nullptr;
+		RelocateFn relocate = nullptr;
+		DestroyFn destroy = nullptr;
+
+		bool trivially_copyable : 1 = false;
+	};
+
+	// A component instance held by `ComponentStorage`.
+	//
+	// Types with registered `ComponentStorageOps` are moved directly into an internal buffer,
+	// (allocated inline for most components) while other types fall back to a reflected `MetaAny`.
+	class StoredComponent
+	{
+		public:
+			// The largest component stored without a separate allocation.
+			static constexpr std::size_t inline_capacity = 32;
+
+			StoredComponent() = default;
+
+			StoredComponent(MetaAny&& instance);
+			StoredComponent(const ComponentStorageOps& ops);
+
+			StoredComponent(const StoredComponent& other);
+			StoredComponent(StoredComponent&& other) noexcept;
+
+			StoredComponent& operator=(const StoredComponent& other);
+			StoredComponent& operator=(StoredComponent&& other) noexcept;
+
+			~StoredComponent();
+
+			// Stores the component of type `ops.type_id` from `entity`, removing it unless `store_as_copy` is true.
+			//
+			// NOTE: Only applicable to objects constructed from `ComponentStorageOps`.
+			bool store(Registry& registry, Entity entity, bool store_as_copy=false);
+
+			// Moves the stored component back into `registry`, attaching it to `entity`.
+			// This object no longer holds a value afterwards.
+			bool retrieve(Registry& registry, Entity entity);
+
+			MetaTypeID type_id() const;
+
+			bool has_value() const;
+
+			inline explicit operator bool() const { return has_value(); }
+
+			// Indicates whether this object bypasses reflection. (i.e. was constructed from `ComponentStorageOps`)
+			inline bool is_direct() const
+			{
+				return static_cast<bool>(ops);
+			}
+
+		private:
+			bool uses_inline_storage() const;
+
+			void* data();
+			const void* data() const;
+
+			// Allocates storage for an instance, if needed.
+			void allocate();
+
+			// Destroys the held instance, if any. Storage remains allocated.
+			void destroy_instance();
+
+			// Releases all resources held by this object.
+			void reset();
+
+			void copy_from(const StoredComponent& other);
+			void move_from(StoredComponent&& other);
+
+			const ComponentStorageOps* ops = nullptr;
+
+			void* heap_instance = nullptr;
+
+			bool holds_instance = false;
+
+			alignas(std::max_align_t) std::byte inline_instance[inline_capacity];
+
+			// Fallback for types without registered `ComponentStorageOps`.
+			MetaAny meta_instance;
+	};
+
 	// Abstraction around type-erased storage of multiple entity components.
 	struct ComponentStorage
 	{
 		// Collection of component instances to be
 		// re-attached to the underlying entity.
-		util::small_vector<MetaAny, 3> components;
+		util::small_vector<StoredComponent, 3> components;
 
 		std::size_t store(Registry& registry, Entity entity, const MetaStorageDescription& component_details, bool store_as_copy=false, bool skip_existing=false);
 		std::size_t retrieve(Registry& registry, Entity entity);
@@ -21,4 +144,4 @@ namespace engine
 
 		void clear();
 	};
-}
\ No newline at end of file
+}
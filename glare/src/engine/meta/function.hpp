@@ -268,70 +268,26 @@ namespace engine
 	}
 
 	/*
-		Attempts to execute each overload of `function` using `self` and `function_arguments`.
-		The `function_arguments` parameter is assumed to be a vector-like type. (e.g. `util::small_vector`)
-		
-		If `handle_indirection` is enabled, each argument in `function_arguments` will be 'resolved' prior to invocation (if possible).
-		
-		If `attempt_to_forward_context` is enabled, a fallback pass may be attempted,
-		where the `args` specified will be forwarded as leading function arguments.
+		Continues invocation of `function` after an initial attempt using `function_arguments_out` has failed.
+		(See `invoke_any_overload_with_indirection_context`)
 
-		This fallback pass attempts invocation of each overload of `function`, first forwarding all of `args`,
-		then truncating from the end of `args` until an invocation is successful, or until every element is exhausted.
+		The `function_arguments_out` parameter must hold the arguments used for the initial attempt,
+		after indirection has been resolved. The contents of `function_arguments_out` may be modified by this function.
 	*/
 	template <typename ArgumentContainer, typename ...Args>
-	MetaAny invoke_any_overload_with_indirection_context
+	MetaAny invoke_any_overload_with_context_fallback
 	(
-		const MetaFunction& function, MetaAny self, const ArgumentContainer& function_arguments,
-		bool handle_indirection, bool attempt_to_forward_context,
+		const MetaFunction& function, MetaAny self, ArgumentContainer& function_arguments_out,
+		bool attempt_to_forward_context,
 		Args&&... args
 	)
 	{
-		using IndirectionArguments = util::small_vector<MetaAny, 8>; // MetaFunctionCall::Arguments;
-
 		if (!function)
 		{
 			return {};
 		}
 
-		IndirectionArguments function_arguments_out;
-
-		if (!function_arguments.empty())
-		{
-			if (handle_indirection)
-			{
-				function_arguments_out.reserve((function_arguments.size() + static_cast<bool>(self)));
-
-				// NOTE: May change this back to using const references at some point. (See notes below)
-				for (auto& argument : function_arguments) // const auto&
-				{
-					function_arguments_out.emplace_back(get_indirect_value_or_ref(argument, std::forward<Args>(args)...));
-				}
-
-				if (auto result = invoke_any_overload_with_automatic_meta_forwarding(function, self.as_ref(), function_arguments_out.data(), function_arguments_out.size()))
-				{
-					return result;
-				}
-			}
-			else
-			{
-				// NOTE: Const-cast needed due to limitations of EnTT's API.
-				if (auto result = invoke_any_overload_with_automatic_meta_forwarding(function, self.as_ref(), const_cast<MetaAny* const>(function_arguments.data()), function_arguments.size()))
-				{
-					return result;
-				}
-
-				// NOTE: Unlike the `handle_indirection` case, this reserve call must happen after
-				// the initial invocation attempt, due to a possible (unlikely) dynamic memory allocation.
-				function_arguments_out.reserve((function_arguments.size() + static_cast<bool>(self)));
-
-				// NOTE: Non-const reference used to avoid transitive const issues with `as_ref`.
-				for (auto& argument : function_arguments)
-				{
-					function_arguments_out.emplace_back(argument.as_ref());
-				}
-			}
-		}
+		const bool has_arguments = (!function_arguments_out.empty());
 
 		auto execute_with_context = [&](std::size_t argument_insertion_offset=0) -> MetaAny
 		{
@@ -380,7 +336,7 @@ namespace engine
 				return result;
 			}
 
-			if (function_arguments.empty())
+			if (!has_arguments)
 			{
 				auto& embedded_self = function_arguments_out[0];
 
@@ -392,7 +348,7 @@ namespace engine
 		}
 		else 
 		{
-			if (function_arguments.empty())
+			if (!has_arguments)
 			{
 				if (auto result = invoke_any_overload(function, self.as_ref()))
 				{
@@ -404,6 +360,82 @@ namespace engine
 		return {};
 	}
 
+	/*
+		Attempts to execute each overload of `function` using `self` and `function_arguments`.
+		The `function_arguments` parameter is assumed to be a vector-like type. (e.g. `util::small_vector`)
+		
+		If `handle_indirection` is enabled, each argument in `function_arguments` will be 'resolved' prior to invocation (if possible).
+		
+		If `attempt_to_forward_context` is enabled, a fallback pass may be attempted,
+		where the `args` specified will be forwarded as leading function arguments.
+
+		This fallback pass attempts invocation of each overload of `function`, first forwarding all of `args`,
+		then truncating from the end of `args` until an invocation is successful, or until every element is exhausted.
+	*/
+	template <typename ArgumentContainer, typename ...Args>
+	MetaAny invoke_any_overload_with_indirection_context
+	(
+		const MetaFunction& function, MetaAny self, const ArgumentContainer& function_arguments,
+		bool handle_indirection, bool attempt_to_forward_context,
+		Args&&... args
+	)
+	{
+		using IndirectionArguments = util::small_vector<MetaAny, 8>; // MetaFunctionCall::Arguments;
+
+		if (!function)
+		{
+			return {};
+		}
+
+		IndirectionArguments function_arguments_out;
+
+		if (!function_arguments.empty())
+		{
+			if (handle_indirection)
+			{
+				function_arguments_out.reserve((function_arguments.size() + static_cast<bool>(self)));
+
+				// NOTE: May change this back to using const references at some point. (See notes below)
+				for (auto& argument : function_arguments) // const auto&
+				{
+					function_arguments_out.emplace_back(get_indirect_value_or_ref(argument, std::forward<Args>(args)...));
+				}
+
+				if (auto result = invoke_any_overload_with_automatic_meta_forwarding(function, self.as_ref(), function_arguments_out.data(), function_arguments_out.size()))
+				{
+					return result;
+				}
+			}
+			else
+			{
+				// NOTE: Const-cast needed due to limitations of EnTT's API.
+				if (auto result = invoke_any_overload_with_automatic_meta_forwarding(function, self.as_ref(), const_cast<MetaAny* const>(function_arguments.data()), function_arguments.size()))
+				{
+					return result;
+				}
+
+				// NOTE: Unlike the `handle_indirection` case, this reserve call must happen after
+				// the initial invocation attempt, due to a possible (unlikely) dynamic memory allocation.
+				function_arguments_out.reserve((function_arguments.size() + static_cast<bool>(self)));
+
+				// NOTE: Non-const reference used to avoid transitive const issues with `as_ref`.
+				for (auto& argument : function_arguments)
+				{
+					function_arguments_out.emplace_back(argument.as_ref());
+				}
+			}
+		}
+
+		return invoke_any_overload_with_context_fallback
+		(
+			function,
+			std::move(self),
+			function_arguments_out,
+			attempt_to_forward_context,
+			std::forward<Args>(args)...
+		);
+	}
+
 	template <typename ...Args>
 	MetaAny invoke_any_overload_with_indirection_context
 	(
@@ -8,14 +8,19 @@ namespace engine
 		{
 			// NOTE: Function-local static variable used to ensure safe initialization.
 			// 
-			// TODO: Add some kind of locking mechanism to avoid race conditions on access.
-			// 
 			// i.e. This being defined inside of a function ensures that construction is handled exactly once for all threads,
-			// but accessing or assigning entries to the lookup table is not thread safe.
+			// but accessing or assigning entries to the lookup table requires `get_known_string_hashes_mutex`.
 			static auto known_string_hashes = StringHashLookupTable {};
 
 			return known_string_hashes;
 		}
+
+		std::shared_mutex& get_known_string_hashes_mutex()
+		{
+			static auto known_string_hashes_mutex = std::shared_mutex {};
+
+			return known_string_hashes_mutex;
+		}
 	}
 
 	std::string_view get_known_string_from_hash(StringHash hash_value)
@@ -27,6 +32,8 @@ namespace engine
 
 		auto& known_string_hashes = impl::get_known_string_hashes();
 
+		auto lock = std::shared_lock { impl::get_known_string_hashes_mutex() };
+
 		auto it = known_string_hashes.find(hash_value);
 
 		if (it == known_string_hashes.end())
@@ -10,6 +10,8 @@
 #include <unordered_map>
 #include <variant>
 #include <utility>
+#include <mutex>
+#include <shared_mutex>
 //#include <cstring>
 
 namespace engine
@@ -19,6 +21,9 @@ namespace engine
         using StringHashLookupTable = std::unordered_map<StringHash, std::variant<std::string, std::string_view>>;
 
         StringHashLookupTable& get_known_string_hashes();
+
+        // Guards access to the table returned by `get_known_string_hashes`.
+        std::shared_mutex& get_known_string_hashes_mutex();
     }
 
 	// Computes a hash for the string specified.
@@ -35,6 +40,8 @@ namespace engine
                 {
                     auto& known_string_hashes = impl::get_known_string_hashes();
 
+                    auto lock = std::unique_lock { impl::get_known_string_hashes_mutex() };
+
                     if (true) // !known_string_hashes.contains(result)
                     {
                         known_string_hashes[result] = std::string_view { str };
@@ -63,6 +70,8 @@ namespace engine
                 {
                     auto& known_string_hashes = impl::get_known_string_hashes();
 
+                    auto lock = std::unique_lock { impl::get_known_string_hashes_mutex() };
+
                     if (!known_string_hashes.contains(result)) // std::is_same_v<std::decay_t<StringType>, std::string> || ...
                     {
                         known_string_hashes[result] = std::string(std::forward<StringType>(str));
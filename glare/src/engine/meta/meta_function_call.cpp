@@ -45,6 +45,135 @@ namespace engine
 		return expand_arguments_ex<MetaFunctionCall::ForwardingArguments>(input, std::forward<ArgumentValues>(argument_values)...);
 	}
 
+	// Returns true if any overload of `function` takes one or more arguments.
+	static bool function_has_overload_with_arguments(const MetaFunction& function)
+	{
+		for (auto overload = function; (overload); overload = overload.next())
+		{
+			if (overload.arity() > 0)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	// Invokes the overload described by `plan`, forwarding each argument the same way it was when the plan was recorded.
+	static MetaAny invoke_plan(const MetaFunctionCallPlan& plan, MetaAny& self, MetaAny* const arguments, std::size_t argument_count)
+	{
+		auto instance = self.as_ref();
+
+		if (!plan.meta_forwarding_mask)
+		{
+			return plan.function.invoke(instance, arguments, argument_count);
+		}
+
+		using TemporaryArgumentStore = util::small_vector<MetaAny, 8>;
+
+		auto forwarding_store = TemporaryArgumentStore {};
+
+		forwarding_store.reserve(argument_count);
+
+		for (std::size_t argument_index = 0; argument_index < argument_count; argument_index++)
+		{
+			if ((plan.meta_forwarding_mask & (static_cast<std::uint32_t>(1) << argument_index)))
+			{
+				forwarding_store.emplace_back(entt::forward_as_meta(arguments[argument_index].as_ref()));
+			}
+			else
+			{
+				forwarding_store.emplace_back(arguments[argument_index].as_ref());
+			}
+		}
+
+		return plan.function.invoke(instance, forwarding_store.data(), forwarding_store.size());
+	}
+
+	// Equivalent to `invoke_any_overload_with_automatic_meta_forwarding`,
+	// but records the overload (and forwarding behavior) that succeeded in `plan_out`.
+	static MetaAny invoke_and_record_plan(const MetaFunction& function_overloads, MetaAny& self, MetaAny* const arguments, std::size_t argument_count, MetaFunctionCallPlan& plan_out)
+	{
+		auto instance = self.as_ref();
+
+		// Try exact / very similar argument matches first:
+		for (auto function = function_overloads; (function); function = function.next())
+		{
+			if (argument_count != function.arity())
+			{
+				continue;
+			}
+
+			bool skip_overload = false;
+
+			for (std::size_t argument_index = 0; argument_index < argument_count; argument_index++)
+			{
+				if (!argument_has_invocation_priority(function.arg(argument_index), arguments[argument_index].type()))
+				{
+					skip_overload = true;
+
+					break;
+				}
+			}
+
+			if (skip_overload)
+			{
+				continue;
+			}
+
+			if (auto result = function.invoke(instance, arguments, argument_count))
+			{
+				plan_out.function = function;
+
+				return result;
+			}
+		}
+
+		// Fallback to trying every overload, regardless of possible conversions:
+		for (auto function = function_overloads; (function); function = function.next())
+		{
+			if (auto result = function.invoke(instance, arguments, argument_count))
+			{
+				plan_out.function = function;
+
+				return result;
+			}
+		}
+
+		// NOTE: Overloads with more arguments than can be represented by the forwarding mask are left to the uncached path.
+		if (argument_count <= (sizeof(plan_out.meta_forwarding_mask) * 8))
+		{
+			for (auto function = function_overloads; (function); function = function.next())
+			{
+				if ((argument_count != function.arity()) || (!function_overload_has_meta_any_argument(function)))
+				{
+					continue;
+				}
+
+				plan_out.function = function;
+				plan_out.meta_forwarding_mask = 0;
+
+				for (std::size_t argument_index = 0; argument_index < argument_count; argument_index++)
+				{
+					if (function.arg(argument_index).id() == entt::type_hash<MetaAny>::value())
+					{
+						plan_out.meta_forwarding_mask |= (static_cast<std::uint32_t>(1) << argument_index);
+					}
+				}
+
+				if (auto result = invoke_plan(plan_out, self, arguments, argument_count))
+				{
+					return result;
+				}
+			}
+		}
+
+		plan_out.function = {};
+		plan_out.meta_forwarding_mask = 0;
+
+		return {};
+	}
+
 	template <typename ...Args>
 	MetaAny MetaFunctionCall::get_self_impl(bool resolve_as_container, bool resolve_underlying, Args&&... args) const
 	{
@@ -100,7 +229,6 @@ namespace engine
 			: false
 		;
 
-		auto target_fn = MetaFunction {};
 		auto self_type = MetaType {};
 
 		if (self)
@@ -142,36 +270,14 @@ namespace engine
 			return {};
 		}
 
-		target_fn = get_function(self_type);
-
-		if ((!target_fn) && (self))
-		{
-			if (auto as_container = try_get_container_wrapper(self))
-			{
-				const auto container_type = as_container.type();
-
-				target_fn = get_function(container_type);
-
-				if (target_fn)
-				{
-					self = std::move(as_container);
-				}
-			}
-		}
-
 		if (resolve_indirection)
 		{
 			if (self)
 			{
-				return invoke_any_overload_with_indirection_context
+				return invoke_with_cache
 				(
-					target_fn,
-				
-					(self)
-						? self.as_ref() // std::move(self),
-						: MetaAny {}
-					,
-
+					self_type,
+					self.as_ref(),
 					arguments,
 					resolve_argument_indirection,
 					false, // true,
@@ -182,12 +288,10 @@ namespace engine
 			}
 			else
 			{
-				return invoke_any_overload_with_indirection_context
+				return invoke_with_cache
 				(
-					target_fn,
-				
+					self_type,
 					std::move(self), // MetaAny {},
-
 					arguments,
 					resolve_argument_indirection,
 					false, // true
@@ -197,12 +301,10 @@ namespace engine
 		}
 		else
 		{
-			return invoke_any_overload_with_indirection_context
+			return invoke_with_cache
 			(
-				target_fn,
-
+				self_type,
 				std::move(self), // self.as_ref(),
-
 				arguments,
 				resolve_argument_indirection,
 				false,
@@ -216,7 +318,6 @@ namespace engine
 	{
 		using namespace engine::literals;
 
-		auto target_fn = MetaFunction {};
 		auto self_type = MetaType {};
 
 		if (self)
@@ -318,23 +419,6 @@ namespace engine
 			return {};
 		}
 
-		target_fn = get_function(self_type);
-
-		if ((!target_fn) && (self))
-		{
-			if (auto as_container = try_get_container_wrapper(self))
-			{
-				const auto container_type = as_container.type();
-
-				target_fn = get_function(container_type);
-
-				if (target_fn)
-				{
-					self = std::move(as_container);
-				}
-			}
-		}
-
 		const bool resolve_argument_indirection = (resolve_indirection)
 			? has_indirection()
 			: false
@@ -342,9 +426,9 @@ namespace engine
 
 		if (opt_evaluation_context)
 		{
-			return invoke_any_overload_with_indirection_context
+			return invoke_with_cache
 			(
-				target_fn,
+				self_type,
 				std::move(self),
 				arguments,
 				resolve_argument_indirection,
@@ -355,9 +439,9 @@ namespace engine
 		}
 		else
 		{
-			return invoke_any_overload_with_indirection_context
+			return invoke_with_cache
 			(
-				target_fn,
+				self_type,
 				std::move(self),
 				arguments,
 				resolve_argument_indirection,
@@ -367,6 +451,126 @@ namespace engine
 		}
 	}
 
+	template <typename ArgumentContainer, typename ...Args>
+	MetaAny MetaFunctionCall::invoke_with_cache(const MetaType& self_type, MetaAny self, const ArgumentContainer& arguments, bool resolve_argument_indirection, bool attempt_to_forward_context, Args&&... args) const
+	{
+		using IndirectionArguments = util::small_vector<MetaAny, 8>;
+
+		const auto self_type_id = self_type.id();
+		const auto argument_count = arguments.size();
+
+		IndirectionArguments function_arguments_out;
+
+		// NOTE: Const-cast needed due to limitations of EnTT's API.
+		auto argument_data = const_cast<MetaAny*>(arguments.data());
+
+		if (resolve_argument_indirection)
+		{
+			function_arguments_out.reserve((argument_count + static_cast<bool>(self)));
+
+			for (auto& argument : arguments)
+			{
+				function_arguments_out.emplace_back(get_indirect_value_or_ref(argument, args...));
+			}
+
+			argument_data = function_arguments_out.data();
+		}
+
+		if (const auto plan = cache.find(self_type_id, argument_data, argument_count))
+		{
+			if (auto result = invoke_plan(*plan, self, argument_data, argument_count))
+			{
+				cache.record_hit();
+
+				return result;
+			}
+		}
+
+		cache.record_miss();
+
+		auto target_fn = get_function(self_type);
+
+		bool is_cacheable = true;
+
+		if ((!target_fn) && (self))
+		{
+			if (auto as_container = try_get_container_wrapper(self))
+			{
+				const auto container_type = as_container.type();
+
+				target_fn = get_function(container_type);
+
+				if (target_fn)
+				{
+					self = std::move(as_container);
+
+					// NOTE: Container wrappers are resolved per-instance, and are therefore never cached.
+					is_cacheable = false;
+				}
+			}
+		}
+
+		if (!target_fn)
+		{
+			return {};
+		}
+
+		// NOTE: Calls without arguments attempt to forward context (and `self`, for static overloads) before anything else.
+		// To preserve this ordering, argument-less calls are only cached when no overload could accept these arguments.
+		if ((argument_count == 0) && function_has_overload_with_arguments(target_fn))
+		{
+			is_cacheable = false;
+		}
+
+		if (is_cacheable)
+		{
+			auto plan = MetaFunctionCallPlan { .self_type_id = self_type_id };
+
+			if (auto result = invoke_and_record_plan(target_fn, self, argument_data, argument_count, plan))
+			{
+				plan.argument_types.reserve(argument_count);
+
+				for (std::size_t argument_index = 0; argument_index < argument_count; argument_index++)
+				{
+					plan.argument_types.emplace_back(argument_data[argument_index].type().id());
+				}
+
+				cache.insert(std::move(plan));
+
+				return result;
+			}
+		}
+		else if (argument_count > 0)
+		{
+			if (auto result = invoke_any_overload_with_automatic_meta_forwarding(target_fn, self.as_ref(), argument_data, argument_count))
+			{
+				return result;
+			}
+		}
+
+		if ((argument_count > 0) && (!resolve_argument_indirection))
+		{
+			function_arguments_out.reserve((argument_count + static_cast<bool>(self)));
+
+			// NOTE: Non-const reference used to avoid transitive const issues with `as_ref`.
+			for (auto& argument : arguments)
+			{
+				function_arguments_out.emplace_back(argument.as_ref());
+			}
+		}
+
+		// NOTE: Any indirection has already been resolved at this point,
+		// so we continue from where `invoke_any_overload_with_indirection_context` would.
+		return invoke_any_overload_with_context_fallback
+		(
+			target_fn,
+			std::move(self),
+			function_arguments_out,
+			attempt_to_forward_context,
+			std::forward<Args>(args)...
+		);
+	}
+
 	template <typename ...Args>
 	MetaAny MetaFunctionCall::get_fallback_impl(const MetaAny& self, bool resolve_indirection, Args&&... args) const
 	{
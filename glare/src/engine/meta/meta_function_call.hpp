@@ -1,6 +1,7 @@
 #pragma once
 
 #include "types.hpp"
+#include "meta_function_call_cache.hpp"
 
 #include <util/small_vector.hpp>
 
@@ -24,6 +25,12 @@ namespace engine
 			// When enabled, data-member accesses may be performed using function-call syntax.
 			bool allow_fallback_to_member : 1 = true;
 
+			// Plans for previously resolved invocations, keyed on the type of `self`.
+			// 
+			// NOTE: This is not part of this object's value; copies of
+			// a `MetaFunctionCall` object always begin with an empty cache.
+			mutable MetaFunctionCallCache cache = {};
+
 			MetaAny get_self(bool resolve_as_container=false, bool resolve_underlying=true) const;
 
 			MetaAny get(MetaAny self={}, bool resolve_indirection=true) const;
@@ -41,6 +48,18 @@ namespace engine
 			bool has_type() const;
 			bool has_function() const;
 
+			// Returns the number of invocations resolved using `cache`.
+			inline MetaFunctionCallCache::Counter get_cache_hits() const
+			{
+				return cache.hits();
+			}
+
+			// Returns the number of invocations that could not be resolved using `cache`.
+			inline MetaFunctionCallCache::Counter get_cache_misses() const
+			{
+				return cache.misses();
+			}
+
 			// Wrapper for `get`; added for reflection purposes.
 			MetaAny get_indirect_value() const;
 
@@ -112,6 +131,11 @@ namespace engine
 			template <typename ArgumentContainer>
 			MetaAny execute_impl(ArgumentContainer&& arguments, Registry& registry, Entity entity=null, bool resolve_indirection=true, MetaAny self={}, const MetaEvaluationContext* opt_evaluation_context=nullptr) const;
 
+			// Invokes the function identified by `function_id` on `self`, using a cached plan if one is available.
+			// If no plan is available, the function is resolved from `self_type`, and the resulting plan is cached where possible.
+			template <typename ArgumentContainer, typename ...Args>
+			MetaAny invoke_with_cache(const MetaType& self_type, MetaAny self, const ArgumentContainer& arguments, bool resolve_argument_indirection, bool attempt_to_forward_context, Args&&... args) const;
+
 			// TODO: Implement an overload of `execute_impl` that takes in only a `MetaEvaluationContext` reference.
 	};
 }
\ No newline at end of file
@@ -0,0 +1,102 @@
+#include "meta_function_call_cache.hpp"
+
+#include <utility>
+
+namespace engine
+{
+	// MetaFunctionCallPlan:
+	bool MetaFunctionCallPlan::matches(MetaTypeID self_type_id, const MetaAny* arguments, std::size_t argument_count) const
+	{
+		if (this->self_type_id != self_type_id)
+		{
+			return false;
+		}
+
+		if (argument_types.size() != argument_count)
+		{
+			return false;
+		}
+
+		for (std::size_t argument_index = 0; argument_index < argument_count; argument_index++)
+		{
+			if (argument_types[argument_index] != arguments[argument_index].type().id())
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	// MetaFunctionCallCache:
+	MetaFunctionCallCache::MetaFunctionCallCache(const MetaFunctionCallCache&)
+		: MetaFunctionCallCache()
+	{}
+
+	MetaFunctionCallCache::MetaFunctionCallCache(MetaFunctionCallCache&&) noexcept
+		: MetaFunctionCallCache()
+	{}
+
+	MetaFunctionCallCache& MetaFunctionCallCache::operator=(const MetaFunctionCallCache&)
+	{
+		// NOTE: Existing plans are discarded, since they may not apply to the newly assigned call.
+		entry_count.store(0, std::memory_order_release);
+
+		hit_count.store(0, std::memory_order_relaxed);
+		miss_count.store(0, std::memory_order_relaxed);
+
+		return *this;
+	}
+
+	MetaFunctionCallCache& MetaFunctionCallCache::operator=(MetaFunctionCallCache&& cache) noexcept
+	{
+		return (*this = static_cast<const MetaFunctionCallCache&>(cache));
+	}
+
+	const MetaFunctionCallCache::Plan* MetaFunctionCallCache::find(MetaTypeID self_type_id, const MetaAny* arguments, std::size_t argument_count) const
+	{
+		const auto entries_available = size();
+
+		for (std::size_t entry_index = 0; entry_index < entries_available; entry_index++)
+		{
+			const auto& entry = entries[entry_index];
+
+			if (entry.matches(self_type_id, arguments, argument_count))
+			{
+				return &entry;
+			}
+		}
+
+		return nullptr;
+	}
+
+	bool MetaFunctionCallCache::insert(Plan plan)
+	{
+		auto lock = std::scoped_lock { insertion_mutex };
+
+		const auto entries_available = size();
+
+		if (entries_available >= max_entries)
+		{
+			return false;
+		}
+
+		// Another thread may have recorded an equivalent plan first.
+		for (std::size_t entry_index = 0; entry_index < entries_available; entry_index++)
+		{
+			const auto& entry = entries[entry_index];
+
+			if ((entry.self_type_id == plan.self_type_id) && (entry.argument_types == plan.argument_types))
+			{
+				return false;
+			}
+		}
+
+		entries[entries_available] = std::move(plan);
+
+		// NOTE: Publishing the new entry count after writing ensures that readers never observe a partially written plan.
+		entry_count.store(static_cast<std::uint8_t>(entries_available + 1), std::memory_order_release);
+
+		return true;
+	}
+}
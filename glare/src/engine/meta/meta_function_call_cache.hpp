@@ -0,0 +1,114 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <util/small_vector.hpp>
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <cstdint>
+#include <cstddef>
+
+namespace engine
+{
+	// Describes how a `MetaFunctionCall` was successfully invoked for a specific 'self' type.
+	struct MetaFunctionCallPlan
+	{
+		using ArgumentTypes = util::small_vector<MetaTypeID, 4>;
+
+		// The type of the instance used for invocation, or the type the function was resolved from. (Static functions)
+		MetaTypeID self_type_id = {};
+
+		// The specific overload that was invoked.
+		MetaFunction function = {};
+
+		// The types of each argument, after indirection was resolved.
+		ArgumentTypes argument_types;
+
+		// Bitmask of arguments forwarded using `entt::forward_as_meta`. (i.e. parameters of type `MetaAny`)
+		std::uint32_t meta_forwarding_mask = 0;
+
+		// Returns true if this plan applies to a call using `self_type_id` and `arguments`.
+		bool matches(MetaTypeID self_type_id, const MetaAny* arguments, std::size_t argument_count) const;
+	};
+
+	// A per-call-site cache of `MetaFunctionCallPlan` objects, keyed on 'self' type.
+	//
+	// Lookups are lock-free; plans are only ever appended, and are not modified once published.
+	// Once `max_entries` plans have been recorded, the call-site is considered megamorphic, and further plans are discarded.
+	class MetaFunctionCallCache
+	{
+		public:
+			using Plan = MetaFunctionCallPlan;
+			using Counter = std::uint64_t;
+
+			static constexpr std::size_t max_entries = 4;
+
+			MetaFunctionCallCache() = default;
+
+			// NOTE: Copies start out empty, since plans are cheap to re-derive
+			// and the counters of one call-site don't apply to another.
+			MetaFunctionCallCache(const MetaFunctionCallCache&);
+			MetaFunctionCallCache(MetaFunctionCallCache&&) noexcept;
+
+			MetaFunctionCallCache& operator=(const MetaFunctionCallCache&);
+			MetaFunctionCallCache& operator=(MetaFunctionCallCache&&) noexcept;
+
+			// Retrieves the plan matching `self_type_id` and the types of `arguments`, if one exists.
+			const Plan* find(MetaTypeID self_type_id, const MetaAny* arguments, std::size_t argument_count) const;
+
+			// Records `plan`, returning false if the cache is full or a matching plan already exists.
+			bool insert(Plan plan);
+
+			inline void record_hit() const
+			{
+				hit_count.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			inline void record_miss() const
+			{
+				miss_count.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			// The number of calls resolved using a cached plan.
+			inline Counter hits() const
+			{
+				return hit_count.load(std::memory_order_relaxed);
+			}
+
+			// The number of calls that required full resolution.
+			inline Counter misses() const
+			{
+				return miss_count.load(std::memory_order_relaxed);
+			}
+
+			// Returns the number of plans currently cached.
+			inline std::size_t size() const
+			{
+				return static_cast<std::size_t>(entry_count.load(std::memory_order_acquire));
+			}
+
+			inline bool empty() const
+			{
+				return (size() == 0);
+			}
+
+			// Returns true if no further plans can be cached.
+			inline bool is_megamorphic() const
+			{
+				return (size() >= max_entries);
+			}
+
+		private:
+			std::array<Plan, max_entries> entries;
+
+			std::atomic<std::uint8_t> entry_count = 0;
+
+			mutable std::atomic<Counter> hit_count = 0;
+			mutable std::atomic<Counter> miss_count = 0;
+
+			// Serializes calls to `insert`.
+			std::mutex insertion_mutex;
+	};
+}
@@ -44,17 +44,45 @@ namespace engine
 		return parse_value_operator(symbol, symbol_is_leading, resolve_non_standard_symbols);
 	}
 
-	MetaAny MetaValueOperation::get() const
+	bool MetaValueOperation::compile(const SharedStorageInterface* opt_storage)
 	{
+		program = MetaValueOperationProgram::compile(*this, opt_storage);
+
+		return is_compiled();
+	}
+
+	template <typename ...Args>
+	MetaAny MetaValueOperation::evaluate(Args&&... args) const
+	{
+		if (!program.empty())
+		{
+			auto program_result = program.execute
+			(
+				[&args...](const MetaAny& operand)
+				{
+					return try_get_underlying_value(operand, args...);
+				}
+			);
+
+			if (program_result)
+			{
+				return program_result;
+			}
+		}
+
 		// NOTE: Const-cast used here to avoid sharing const-qualification on references to non-const `MetaAny` objects.
 		// (i.e. If a value isn't stored as const in `segments`, we shouldn't retroactively apply const)
-		return std::get<0>(evaluate_impl(const_cast<MetaValueOperation&>(*this), true, size(), 0, std::nullopt, true));
+		return std::get<0>(evaluate_impl(const_cast<MetaValueOperation&>(*this), true, size(), 0, std::nullopt, true, std::forward<Args>(args)...));
+	}
+
+	MetaAny MetaValueOperation::get() const
+	{
+		return evaluate();
 	}
 
 	MetaAny MetaValueOperation::get(const MetaEvaluationContext& context) const
 	{
-		// NOTE: See basic getter implementation for details on const-cast usage.
-		return std::get<0>(evaluate_impl(const_cast<MetaValueOperation&>(*this), true, size(), 0, std::nullopt, true, context));
+		return evaluate(context);
 	}
 
 	MetaAny MetaValueOperation::get(const MetaAny& instance) const
@@ -63,47 +91,41 @@ namespace engine
 		// `evaluate_impl` internally performs const-reference casts to attempt to preserve const-ness, where applicable.
 		auto as_ref = const_cast<MetaAny&>(instance).as_ref();
 
-		// NOTE: See parameterless overload for details on const-cast.
-		return std::get<0>(evaluate_impl(const_cast<MetaValueOperation&>(*this), true, size(), 0, std::nullopt, true, as_ref));
+		return evaluate(as_ref);
 	}
 
 	MetaAny MetaValueOperation::get(const MetaAny& instance, const MetaEvaluationContext& context) const
 	{
-		// NOTE: See basic chain-getter implementation for details on const-cast usage.
+		// NOTE: See `get(const MetaAny&)` for details on const-cast usage.
 		auto as_ref = const_cast<MetaAny&>(instance).as_ref();
 
-		// NOTE: See parameterless overload for details on const-cast.
-		return std::get<0>(evaluate_impl(const_cast<MetaValueOperation&>(*this), true, size(), 0, std::nullopt, true, as_ref, context));
+		return evaluate(as_ref, context);
 	}
 
 	MetaAny MetaValueOperation::get(const MetaAny& instance, Registry& registry, Entity entity) const
 	{
-		// NOTE: See basic chain-getter implementation for details on const-cast usage.
+		// NOTE: See `get(const MetaAny&)` for details on const-cast usage.
 		auto as_ref = const_cast<MetaAny&>(instance).as_ref();
 
-		// NOTE: See parameterless overload for details on const-cast.
-		return std::get<0>(evaluate_impl(const_cast<MetaValueOperation&>(*this), true, size(), 0, std::nullopt, true, as_ref, registry, entity));
+		return evaluate(as_ref, registry, entity);
 	}
 
 	MetaAny MetaValueOperation::get(const MetaAny& instance, Registry& registry, Entity entity, const MetaEvaluationContext& context) const
 	{
-		// NOTE: See basic chain-getter implementation for details on const-cast usage.
+		// NOTE: See `get(const MetaAny&)` for details on const-cast usage.
 		auto as_ref = const_cast<MetaAny&>(instance).as_ref();
 
-		// NOTE: See parameterless overload for details on const-cast.
-		return std::get<0>(evaluate_impl(const_cast<MetaValueOperation&>(*this), true, size(), 0, std::nullopt, true, as_ref, registry, entity, context));
+		return evaluate(as_ref, registry, entity, context);
 	}
 
 	MetaAny MetaValueOperation::get(Registry& registry, Entity entity) const
 	{
-		// NOTE: See parameterless overload for details on const-cast.
-		return std::get<0>(evaluate_impl(const_cast<MetaValueOperation&>(*this), true, size(), 0, std::nullopt, true, registry, entity));
+		return evaluate(registry, entity);
 	}
 
 	MetaAny MetaValueOperation::get(Registry& registry, Entity entity, const MetaEvaluationContext& context) const
 	{
-		// NOTE: See parameterless overload for details on const-cast.
-		return std::get<0>(evaluate_impl(const_cast<MetaValueOperation&>(*this), true, size(), 0, std::nullopt, true, registry, entity, context));
+		return evaluate(registry, entity, context);
 	}
 
 	template <typename ...Args>
@@ -148,13 +170,13 @@ namespace engine
 
 		if (attempt_direct_evaluation)
 		{
-			if (auto direct_evaluation_result = std::get<0>(evaluate_impl(const_cast<MetaValueOperation&>(*this), true, segment_count, 0, std::nullopt, true, value, args...))) // get(value, args...)
+			if (auto direct_evaluation_result = evaluate(value, args...)) // get(value, args...)
 			{
 				return direct_evaluation_result;
 			}
 		}
 
-		auto regular_evaluation_result = std::get<0>(evaluate_impl(const_cast<MetaValueOperation&>(*this), true, segment_count, 0, std::nullopt, true, args...)); // get(args...);
+		auto regular_evaluation_result = evaluate(args...); // get(args...);
 
 		if (auto assignment_result = try_get_underlying_value(regular_evaluation_result, value, args...))
 		{
@@ -193,7 +215,7 @@ namespace engine
 			{
 				if (auto source_resolved = try_get_underlying_value(source, args...))
 				{
-					if (auto evaluation_result = std::get<0>(evaluate_impl(const_cast<MetaValueOperation&>(*this), true, size(), 0, std::nullopt, true, source_resolved, destination, args...))) // get(source, args...)
+					if (auto evaluation_result = evaluate(source_resolved, destination, args...)) // get(source, args...)
 					{
 						return evaluation_result;
 					}
@@ -212,7 +234,7 @@ namespace engine
 			}
 			else
 			{
-				if (auto evaluation_result = std::get<0>(evaluate_impl(const_cast<MetaValueOperation&>(*this), true, size(), 0, std::nullopt, true, source, destination, args...))) // get(source, args...)
+				if (auto evaluation_result = evaluate(source, destination, args...)) // get(source, args...)
 				{
 					return evaluation_result;
 				}
@@ -2,6 +2,7 @@
 
 #include "types.hpp"
 #include "meta_value_operator.hpp"
+#include "meta_value_operation_program.hpp"
 
 #include <util/small_vector.hpp>
 
@@ -115,6 +116,23 @@ namespace engine
 			// `MetaValueOperation`, `MetaFunctionCall`, or `IndirectMetaAny` (loaded from `storage`).
 			bool contains_function_call(const SharedStorageInterface& storage, bool recursive=true) const;
 
+			// Compiles `segments` into a typed register program, used by `get` and `set` when possible.
+			// (See `MetaValueOperationProgram`)
+			// 
+			// If provided, `opt_storage` is used to inline nested operations referenced through `IndirectMetaAny`.
+			// 
+			// NOTE: The compiled program is not updated automatically; this
+			// must be called again if `segments` is modified afterward.
+			// 
+			// The return-value of this function indicates if a program could be generated.
+			bool compile(const SharedStorageInterface* opt_storage=nullptr);
+
+			// Returns true if this operation has a compiled program. (See `compile`)
+			inline bool is_compiled() const
+			{
+				return !program.empty();
+			}
+
 			// Returns true if there are no `segments` attached to this operation.
 			inline bool empty() const
 			{
@@ -129,7 +147,14 @@ namespace engine
 			
 			SegmentContainer segments;
 
+			// Typed representation of `segments`; empty if not compiled. (See `compile`)
+			MetaValueOperationProgram program;
+
 		private:
+			// Evaluates this operation using `program`, falling back to `evaluate_impl` if needed.
+			template <typename ...Args>
+			MetaAny evaluate(Args&&... args) const;
+
 			// Assigns the object produced (from evaluating this operation) to the `value` specified.
 			template <typename ...Args>
 			MetaAny set_impl(MetaAny& value, Args&&... args);
@@ -0,0 +1,806 @@
+#include "meta_value_operation_program.hpp"
+
+#include "meta_value_operation.hpp"
+#include "meta_type_conversion.hpp"
+#include "indirect_meta_any.hpp"
+#include "shared_storage_interface.hpp"
+#include "runtime_traits.hpp"
+#include "hash.hpp"
+
+#include <engine/reflection/common_extensions.hpp>
+
+#include <math/comparison.hpp>
+
+#include <limits>
+#include <cmath>
+
+namespace engine
+{
+	// Unary operations with typed implementations.
+	static bool is_typed_unary_operation(MetaValueOperator operation)
+	{
+		switch (operation)
+		{
+			case MetaValueOperator::UnaryPlus:
+			case MetaValueOperator::UnaryMinus:
+			case MetaValueOperator::Boolean:
+			case MetaValueOperator::LogicalNot:
+			case MetaValueOperator::BitwiseNot:
+				return true;
+		}
+
+		return false;
+	}
+
+	// Binary operations with typed implementations.
+	//
+	// NOTE: Logical operators are intentionally excluded, since
+	// their behavior is currently defined by the reflective evaluator.
+	static bool is_typed_binary_operation(MetaValueOperator operation)
+	{
+		switch (operation)
+		{
+			case MetaValueOperator::Multiply:
+			case MetaValueOperator::Divide:
+			case MetaValueOperator::Modulus:
+			case MetaValueOperator::Add:
+			case MetaValueOperator::Subtract:
+
+			case MetaValueOperator::ShiftLeft:
+			case MetaValueOperator::ShiftRight:
+
+			case MetaValueOperator::LessThan:
+			case MetaValueOperator::LessThanOrEqual:
+			case MetaValueOperator::GreaterThan:
+			case MetaValueOperator::GreaterThanOrEqual:
+
+			case MetaValueOperator::Equal:
+			case MetaValueOperator::NotEqual:
+
+			case MetaValueOperator::BitwiseAnd:
+			case MetaValueOperator::BitwiseXOR:
+			case MetaValueOperator::BitwiseOr:
+				return true;
+		}
+
+		return false;
+	}
+
+	template <typename T>
+	static MetaValueRegister apply_unary_scalar(MetaValueOperator operation, T value)
+	{
+		switch (operation)
+		{
+			case MetaValueOperator::UnaryPlus:
+				return impl::operator_unary_plus_impl(value);
+
+			case MetaValueOperator::UnaryMinus:
+				return impl::operator_unary_minus_impl(value);
+
+			case MetaValueOperator::Boolean:
+				return impl::operator_bool_impl(value);
+
+			case MetaValueOperator::LogicalNot:
+				return impl::operator_logical_not_impl(value);
+
+			case MetaValueOperator::BitwiseNot:
+				if constexpr (std::is_same_v<T, bool>)
+				{
+					return !value;
+				}
+				else if constexpr (std::is_integral_v<T>)
+				{
+					return static_cast<T>(~value);
+				}
+
+				break;
+		}
+
+		return {};
+	}
+
+	// NOTE: Mirrors `apply_operation_exact`, where both operands have already been converted to `T`.
+	template <typename T>
+	static MetaValueRegister apply_binary_scalar(MetaValueOperator operation, T left, T right)
+	{
+		switch (operation)
+		{
+			case MetaValueOperator::Equal:
+				if constexpr (std::is_floating_point_v<T>)
+				{
+					// NOTE: `math::fcmp` produces a value of type `T`, rather than `bool`.
+					return math::fcmp(left, right);
+				}
+				else
+				{
+					return (left == right);
+				}
+
+			case MetaValueOperator::NotEqual:
+				if constexpr (std::is_floating_point_v<T>)
+				{
+					return !math::fcmp(left, right);
+				}
+				else
+				{
+					return (left != right);
+				}
+		}
+
+		if constexpr (std::is_same_v<T, bool>)
+		{
+			switch (operation)
+			{
+				case MetaValueOperator::BitwiseAnd:
+					return (left && right);
+				case MetaValueOperator::BitwiseOr:
+					return (left || right);
+				case MetaValueOperator::BitwiseXOR:
+					return (left != right);
+			}
+		}
+		else
+		{
+			switch (operation)
+			{
+				case MetaValueOperator::LessThan:
+					return (left < right);
+				case MetaValueOperator::GreaterThan:
+					return (left > right);
+				case MetaValueOperator::LessThanOrEqual:
+					return (left <= right);
+				case MetaValueOperator::GreaterThanOrEqual:
+					return (left >= right);
+
+				case MetaValueOperator::Multiply:
+					return static_cast<T>(left * right);
+				case MetaValueOperator::Add:
+					return static_cast<T>(left + right);
+				case MetaValueOperator::Subtract:
+					return static_cast<T>(left - right);
+			}
+
+			if constexpr (std::is_integral_v<T>)
+			{
+				switch (operation)
+				{
+					case MetaValueOperator::Divide:
+					case MetaValueOperator::Modulus:
+						// NOTE: Division by zero (and overflowing division) is left to the reflective evaluator.
+						if ((right == 0) || ((left == std::numeric_limits<T>::min()) && (right == -1)))
+						{
+							break;
+						}
+
+						if (operation == MetaValueOperator::Divide)
+						{
+							return static_cast<T>(left / right);
+						}
+
+						return static_cast<T>(left % right);
+
+					case MetaValueOperator::ShiftLeft:
+						return static_cast<T>(left << right);
+					case MetaValueOperator::ShiftRight:
+						return static_cast<T>(left >> right);
+
+					case MetaValueOperator::BitwiseAnd:
+						return static_cast<T>(left & right);
+					case MetaValueOperator::BitwiseOr:
+						return static_cast<T>(left | right);
+					case MetaValueOperator::BitwiseXOR:
+						return static_cast<T>(left ^ right);
+				}
+			}
+			else
+			{
+				switch (operation)
+				{
+					case MetaValueOperator::Divide:
+						return (left / right);
+					case MetaValueOperator::Modulus:
+						return std::fmod(left, right);
+				}
+			}
+		}
+
+		return {};
+	}
+
+	// NOTE: Mirrors the operators reflected for `math::Vector`. (See `reflect_math_type`)
+	static MetaValueRegister apply_binary_vector(MetaValueOperator operation, const math::Vector& left, const MetaValueRegister& right)
+	{
+		if (const auto* right_as_vector = std::get_if<math::Vector>(&right))
+		{
+			switch (operation)
+			{
+				case MetaValueOperator::Add:
+					return (left + *right_as_vector);
+				case MetaValueOperator::Subtract:
+					return (left - *right_as_vector);
+				case MetaValueOperator::Multiply:
+					return (left * *right_as_vector);
+				case MetaValueOperator::Divide:
+					return (left / *right_as_vector);
+			}
+		}
+		else if (const auto* right_as_float = std::get_if<float>(&right))
+		{
+			switch (operation)
+			{
+				case MetaValueOperator::Multiply:
+					return (left * *right_as_float);
+			}
+		}
+
+		return {};
+	}
+
+	MetaValueOperationProgram MetaValueOperationProgram::compile(const MetaValueOperation& operation, const SharedStorageInterface* opt_storage)
+	{
+		auto program = MetaValueOperationProgram {};
+
+		if (auto result = lower(program, operation, opt_storage))
+		{
+			program.result = *result;
+
+			return program;
+		}
+
+		return {};
+	}
+
+	MetaValueRegisterType MetaValueOperationProgram::get_register_type(const MetaValueRegister& value)
+	{
+		return static_cast<MetaValueRegisterType>(value.index());
+	}
+
+	MetaValueRegisterType MetaValueOperationProgram::get_register_type(const MetaType& type)
+	{
+		if (!type)
+		{
+			return MetaValueRegisterType::None;
+		}
+
+		if (type == resolve<bool>())
+		{
+			return MetaValueRegisterType::Bool;
+		}
+
+		if (type == resolve<std::int32_t>())
+		{
+			return MetaValueRegisterType::Int;
+		}
+
+		if (type == resolve<float>())
+		{
+			return MetaValueRegisterType::Float;
+		}
+
+		if (type == resolve<math::Vector>())
+		{
+			return MetaValueRegisterType::Vector;
+		}
+
+		return MetaValueRegisterType::None;
+	}
+
+	MetaValueRegister MetaValueOperationProgram::to_register(const MetaAny& value)
+	{
+		if (!value)
+		{
+			return {};
+		}
+
+		if (const auto as_float = value.try_cast<float>())
+		{
+			return *as_float;
+		}
+
+		if (const auto as_int = value.try_cast<std::int32_t>())
+		{
+			return *as_int;
+		}
+
+		if (const auto as_bool = value.try_cast<bool>())
+		{
+			return *as_bool;
+		}
+
+		if (const auto as_vector = value.try_cast<math::Vector>())
+		{
+			return *as_vector;
+		}
+
+		return {};
+	}
+
+	MetaAny MetaValueOperationProgram::from_register(const MetaValueRegister& value)
+	{
+		return std::visit
+		(
+			[](const auto& underlying) -> MetaAny
+			{
+				using value_t = std::decay_t<decltype(underlying)>;
+
+				if constexpr (std::is_same_v<value_t, std::monostate>)
+				{
+					return {};
+				}
+				else
+				{
+					return MetaAny { underlying };
+				}
+			},
+
+			value
+		);
+	}
+
+	MetaValueRegister MetaValueOperationProgram::apply_unary(MetaValueOperator operation, const MetaValueRegister& value)
+	{
+		switch (get_register_type(value))
+		{
+			case MetaValueRegisterType::Bool:
+				return apply_unary_scalar(operation, std::get<bool>(value));
+			case MetaValueRegisterType::Int:
+				return apply_unary_scalar(operation, std::get<std::int32_t>(value));
+			case MetaValueRegisterType::Float:
+				return apply_unary_scalar(operation, std::get<float>(value));
+
+			case MetaValueRegisterType::Vector:
+				if (operation == MetaValueOperator::UnaryMinus)
+				{
+					return -std::get<math::Vector>(value);
+				}
+
+				break;
+		}
+
+		return {};
+	}
+
+	MetaValueRegister MetaValueOperationProgram::apply_binary(MetaValueOperator operation, const MetaValueRegister& left, const MetaValueRegister& right)
+	{
+		const auto right_type = get_register_type(right);
+
+		// NOTE: Like the reflective evaluator, arithmetic operands are converted to the type of `left`.
+		// Operations mixing `bool` with other types are left to the reflective evaluator.
+		switch (get_register_type(left))
+		{
+			case MetaValueRegisterType::Bool:
+				if (right_type == MetaValueRegisterType::Bool)
+				{
+					return apply_binary_scalar(operation, std::get<bool>(left), std::get<bool>(right));
+				}
+
+				break;
+
+			case MetaValueRegisterType::Int:
+				if (right_type == MetaValueRegisterType::Int)
+				{
+					return apply_binary_scalar(operation, std::get<std::int32_t>(left), std::get<std::int32_t>(right));
+				}
+				else if (right_type == MetaValueRegisterType::Float)
+				{
+					return apply_binary_scalar(operation, std::get<std::int32_t>(left), static_cast<std::int32_t>(std::get<float>(right)));
+				}
+
+				break;
+
+			case MetaValueRegisterType::Float:
+				if (right_type == MetaValueRegisterType::Float)
+				{
+					return apply_binary_scalar(operation, std::get<float>(left), std::get<float>(right));
+				}
+				else if (right_type == MetaValueRegisterType::Int)
+				{
+					return apply_binary_scalar(operation, std::get<float>(left), static_cast<float>(std::get<std::int32_t>(right)));
+				}
+
+				break;
+
+			case MetaValueRegisterType::Vector:
+				return apply_binary_vector(operation, std::get<math::Vector>(left), right);
+		}
+
+		return {};
+	}
+
+	MetaValueRegister MetaValueOperationProgram::convert(const MetaValueRegister& value, MetaValueRegisterType type)
+	{
+		const auto value_type = get_register_type(value);
+
+		if (value_type == type)
+		{
+			return value;
+		}
+
+		// NOTE: Vectors can only be converted to themselves.
+		if ((value_type == MetaValueRegisterType::Vector) || (type == MetaValueRegisterType::Vector))
+		{
+			return {};
+		}
+
+		return std::visit
+		(
+			[type](const auto& underlying) -> MetaValueRegister
+			{
+				using value_t = std::decay_t<decltype(underlying)>;
+
+				if constexpr (std::is_arithmetic_v<value_t>)
+				{
+					switch (type)
+					{
+						case MetaValueRegisterType::Bool:
+							return static_cast<bool>(underlying);
+						case MetaValueRegisterType::Int:
+							return static_cast<std::int32_t>(underlying);
+						case MetaValueRegisterType::Float:
+							return static_cast<float>(underlying);
+					}
+				}
+
+				return {};
+			},
+
+			value
+		);
+	}
+
+	MetaValueRegister MetaValueOperationProgram::execute_instruction(const Instruction& instruction, const RegisterContainer& register_file)
+	{
+		switch (instruction.opcode)
+		{
+			case Opcode::Convert:
+				return convert(register_file[instruction.left], instruction.conversion_type);
+
+			case Opcode::Unary:
+				return apply_unary(instruction.operation, register_file[instruction.left]);
+
+			case Opcode::Binary:
+				return apply_binary(instruction.operation, register_file[instruction.left], register_file[instruction.right]);
+		}
+
+		return {};
+	}
+
+	std::optional<MetaValueRegisterIndex> MetaValueOperationProgram::lower(MetaValueOperationProgram& program, const MetaValueOperation& operation, const SharedStorageInterface* opt_storage)
+	{
+		using namespace engine::literals;
+
+		const auto& segments = operation.segments;
+
+		// NOTE: Single values may be returned by reference, and are left to the reflective evaluator.
+		if (segments.size() < 2)
+		{
+			return std::nullopt;
+		}
+
+		auto accumulator = std::optional<MetaValueRegisterIndex> {};
+		auto pending_operation = MetaValueOperator::Get;
+
+		std::size_t segment_index = 0;
+
+		const auto& first_segment = segments[0];
+
+		if (!first_segment.value)
+		{
+			// Leading unary operation. (e.g. `-value`)
+			if (!is_typed_unary_operation(first_segment.operation))
+			{
+				return std::nullopt;
+			}
+
+			const auto& operand_segment = segments[1];
+
+			if (const auto operand = lower_operand(program, operand_segment.value, opt_storage))
+			{
+				accumulator = emit_unary(program, first_segment.operation, *operand);
+			}
+
+			pending_operation = operand_segment.operation;
+			segment_index = 2;
+		}
+		else if (first_segment.get_type_id() == "MetaTypeConversion"_hs)
+		{
+			// Deferred cast of the next value. (Encoded while parsing when the next value has indirection)
+			if (first_segment.operation != MetaValueOperator::Get)
+			{
+				return std::nullopt;
+			}
+
+			const auto* conversion = first_segment.value.try_cast<MetaTypeConversion>();
+
+			if (!conversion)
+			{
+				return std::nullopt;
+			}
+
+			const auto conversion_type = get_register_type(conversion->get_type());
+
+			if (conversion_type == MetaValueRegisterType::None)
+			{
+				return std::nullopt;
+			}
+
+			const auto& operand_segment = segments[1];
+
+			// NOTE: Direct values are cast during parsing, and are not handled the same way by the reflective evaluator.
+			if (!value_has_indirection(operand_segment.value))
+			{
+				return std::nullopt;
+			}
+
+			if (const auto operand = lower_operand(program, operand_segment.value, opt_storage))
+			{
+				accumulator = emit_convert(program, *operand, conversion_type);
+			}
+
+			pending_operation = operand_segment.operation;
+			segment_index = 2;
+		}
+		else
+		{
+			accumulator = lower_operand(program, first_segment.value, opt_storage);
+
+			pending_operation = first_segment.operation;
+			segment_index = 1;
+		}
+
+		for (; segment_index < segments.size(); segment_index++)
+		{
+			if (!accumulator)
+			{
+				return std::nullopt;
+			}
+
+			const auto& segment = segments[segment_index];
+
+			// NOTE: Empty values, member access and assignment are left to the reflective evaluator.
+			if ((!segment.value) || (!is_typed_binary_operation(pending_operation)))
+			{
+				return std::nullopt;
+			}
+
+			const auto operand = lower_operand(program, segment.value, opt_storage);
+
+			if (!operand)
+			{
+				return std::nullopt;
+			}
+
+			accumulator = emit_binary(program, pending_operation, *accumulator, *operand);
+
+			pending_operation = segment.operation;
+		}
+
+		return accumulator;
+	}
+
+	std::optional<MetaValueRegisterIndex> MetaValueOperationProgram::lower_operand(MetaValueOperationProgram& program, const MetaAny& value, const SharedStorageInterface* opt_storage)
+	{
+		using namespace engine::literals;
+
+		if (!value)
+		{
+			return std::nullopt;
+		}
+
+		// Attempts to inline `nested_operation`, loading it as a whole if that isn't possible.
+		auto lower_nested = [&program, &value, opt_storage](const MetaValueOperation& nested_operation) -> std::optional<MetaValueRegisterIndex>
+		{
+			const auto instruction_count = program.instructions.size();
+			const auto register_count = program.registers.size();
+
+			if (auto nested_result = lower(program, nested_operation, opt_storage))
+			{
+				return nested_result;
+			}
+
+			// Discard anything emitted by the failed attempt.
+			program.instructions.resize(instruction_count);
+			program.registers.resize(register_count);
+
+			// NOTE: Loads may be repeated by the reflective evaluator if the program is aborted,
+			// so operations that could have side effects (i.e. function calls) are not loaded.
+			if ((!opt_storage) || (nested_operation.contains_function_call(*opt_storage, true)))
+			{
+				return std::nullopt;
+			}
+
+			return emit_load(program, value);
+		};
+
+		switch (value.type().id())
+		{
+			case "MetaValueOperation"_hs:
+				if (const auto* as_operation = value.try_cast<MetaValueOperation>())
+				{
+					return lower_nested(*as_operation);
+				}
+
+				return std::nullopt;
+
+			case "IndirectMetaAny"_hs:
+			{
+				// NOTE: Without `opt_storage`, we're unable to determine if this refers to a function call.
+				if (!opt_storage)
+				{
+					return std::nullopt;
+				}
+
+				const auto* as_indirect = value.try_cast<IndirectMetaAny>();
+
+				if (!as_indirect)
+				{
+					return std::nullopt;
+				}
+
+				const auto remote_value = as_indirect->get(*opt_storage);
+
+				if (!remote_value)
+				{
+					return std::nullopt;
+				}
+
+				if (const auto* as_operation = remote_value.try_cast<MetaValueOperation>())
+				{
+					return lower_nested(*as_operation);
+				}
+
+				switch (remote_value.type().id())
+				{
+					case "MetaFunctionCall"_hs:
+					case "MetaTypeConversion"_hs:
+						return std::nullopt;
+				}
+
+				return emit_load(program, value);
+			}
+
+			// See notes in `lower_nested` regarding side effects.
+			case "MetaFunctionCall"_hs:
+				return std::nullopt;
+
+			// NOTE: Conversions are only supported in their encoded form. (See `lower`)
+			case "MetaTypeConversion"_hs:
+				return std::nullopt;
+		}
+
+		if (auto constant = to_register(value); !std::holds_alternative<std::monostate>(constant))
+		{
+			return emit_constant(program, std::move(constant));
+		}
+
+		if (value_has_indirection(value))
+		{
+			return emit_load(program, value);
+		}
+
+		return std::nullopt;
+	}
+
+	std::optional<MetaValueRegisterIndex> MetaValueOperationProgram::emit_constant(MetaValueOperationProgram& program, MetaValueRegister value)
+	{
+		// NOTE: Empty values are produced by constant folding when an operation is not supported.
+		if (std::holds_alternative<std::monostate>(value))
+		{
+			return std::nullopt;
+		}
+
+		if (program.registers.size() > std::numeric_limits<MetaValueRegisterIndex>::max())
+		{
+			return std::nullopt;
+		}
+
+		const auto index = static_cast<MetaValueRegisterIndex>(program.registers.size());
+
+		program.registers.emplace_back(std::move(value));
+
+		return index;
+	}
+
+	std::optional<MetaValueRegisterIndex> MetaValueOperationProgram::emit_load(MetaValueOperationProgram& program, const MetaAny& operand)
+	{
+		return emit
+		(
+			program,
+
+			Instruction
+			{
+				.opcode = Opcode::Load,
+				.operand = operand
+			}
+		);
+	}
+
+	std::optional<MetaValueRegisterIndex> MetaValueOperationProgram::emit_convert(MetaValueOperationProgram& program, MetaValueRegisterIndex value, MetaValueRegisterType type)
+	{
+		if (is_constant_register(program, value))
+		{
+			return emit_constant(program, convert(program.registers[value], type));
+		}
+
+		return emit
+		(
+			program,
+
+			Instruction
+			{
+				.opcode = Opcode::Convert,
+				.conversion_type = type,
+				.left = value
+			}
+		);
+	}
+
+	std::optional<MetaValueRegisterIndex> MetaValueOperationProgram::emit_unary(MetaValueOperationProgram& program, MetaValueOperator operation, MetaValueRegisterIndex value)
+	{
+		if (is_constant_register(program, value))
+		{
+			return emit_constant(program, apply_unary(operation, program.registers[value]));
+		}
+
+		return emit
+		(
+			program,
+
+			Instruction
+			{
+				.opcode = Opcode::Unary,
+				.operation = operation,
+				.left = value
+			}
+		);
+	}
+
+	std::optional<MetaValueRegisterIndex> MetaValueOperationProgram::emit_binary(MetaValueOperationProgram& program, MetaValueOperator operation, MetaValueRegisterIndex left, MetaValueRegisterIndex right)
+	{
+		if (is_constant_register(program, left) && is_constant_register(program, right))
+		{
+			return emit_constant(program, apply_binary(operation, program.registers[left], program.registers[right]));
+		}
+
+		return emit
+		(
+			program,
+
+			Instruction
+			{
+				.opcode = Opcode::Binary,
+				.operation = operation,
+				.left = left,
+				.right = right
+			}
+		);
+	}
+
+	std::optional<MetaValueRegisterIndex> MetaValueOperationProgram::emit(MetaValueOperationProgram& program, Instruction instruction)
+	{
+		if (program.registers.size() > std::numeric_limits<MetaValueRegisterIndex>::max())
+		{
+			return std::nullopt;
+		}
+
+		const auto index = static_cast<MetaValueRegisterIndex>(program.registers.size());
+
+		instruction.destination = index;
+
+		// NOTE: Non-constant registers start out empty.
+		program.registers.emplace_back();
+		program.instructions.emplace_back(std::move(instruction));
+
+		return index;
+	}
+
+	bool MetaValueOperationProgram::is_constant_register(const MetaValueOperationProgram& program, MetaValueRegisterIndex index)
+	{
+		if (index >= program.registers.size())
+		{
+			return false;
+		}
+
+		return !std::holds_alternative<std::monostate>(program.registers[index]);
+	}
+}
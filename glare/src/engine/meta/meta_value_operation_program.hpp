@@ -0,0 +1,199 @@
+#pragma once
+
+#include "types.hpp"
+#include "meta_value_operator.hpp"
+
+#include <math/types.hpp>
+
+#include <util/small_vector.hpp>
+
+#include <variant>
+#include <vector>
+#include <optional>
+#include <cstdint>
+#include <cstddef>
+
+namespace engine
+{
+	class SharedStorageInterface;
+	struct MetaValueOperation;
+
+	// Opcodes used by `MetaValueOperationProgram`.
+	enum class MetaValueProgramOpcode : std::uint8_t
+	{
+		// Resolves `operand` (e.g. a variable or data member) and stores its value in `destination`.
+		// If the resolved value cannot be stored in a register, execution is aborted.
+		Load,
+
+		// Converts the value of `left` to `conversion_type`. (See `MetaTypeConversion`)
+		Convert,
+
+		// Applies `operation` to the value of `left`.
+		Unary,
+
+		// Applies `operation` to the values of `left` and `right`.
+		Binary,
+	};
+
+	// The type of value held by a `MetaValueRegister`.
+	// NOTE: Enumerators correspond to the alternatives of `MetaValueRegister`, in order.
+	enum class MetaValueRegisterType : std::uint8_t
+	{
+		None,
+
+		Bool,
+		Int,
+		Float,
+		Vector,
+	};
+
+	// A value held by one of the registers of a `MetaValueOperationProgram`.
+	using MetaValueRegister = std::variant<std::monostate, bool, std::int32_t, float, math::Vector>;
+
+	using MetaValueRegisterIndex = std::uint8_t;
+
+	struct MetaValueProgramInstruction
+	{
+		using Opcode = MetaValueProgramOpcode;
+
+		Opcode opcode = Opcode::Load;
+
+		// Used by `Opcode::Unary` and `Opcode::Binary`.
+		MetaValueOperator operation = MetaValueOperator::Get;
+
+		// Used by `Opcode::Convert`.
+		MetaValueRegisterType conversion_type = MetaValueRegisterType::None;
+
+		MetaValueRegisterIndex destination = 0;
+
+		MetaValueRegisterIndex left  = 0;
+		MetaValueRegisterIndex right = 0;
+
+		// The value resolved by `Opcode::Load`.
+		MetaAny operand = {};
+	};
+
+	// A register-based representation of a `MetaValueOperation`.
+	//
+	// Constant operands are stored directly in `registers`, and operations on
+	// constants are folded during compilation. Everything else is executed
+	// using typed implementations for `bool`, `std::int32_t`, `float` and `math::Vector`.
+	//
+	// Operations with any other types (or operations not implemented here)
+	// are not compiled, and should be evaluated reflectively instead.
+	class MetaValueOperationProgram
+	{
+		public:
+			using Opcode             = MetaValueProgramOpcode;
+			using Instruction        = MetaValueProgramInstruction;
+			using Container          = std::vector<Instruction>;
+			using RegisterContainer  = util::small_vector<MetaValueRegister, 16>;
+
+			// Lowers `operation` into a program.
+			//
+			// If provided, `opt_storage` is used to resolve nested operations referenced through `IndirectMetaAny`.
+			// If `operation` cannot be represented using typed registers, an empty program is returned.
+			static MetaValueOperationProgram compile(const MetaValueOperation& operation, const SharedStorageInterface* opt_storage=nullptr);
+
+			static MetaValueRegisterType get_register_type(const MetaValueRegister& value);
+			static MetaValueRegisterType get_register_type(const MetaType& type);
+
+			// Reads `value` into a register, if its type is supported.
+			// Values of unsupported types result in an empty register.
+			static MetaValueRegister to_register(const MetaAny& value);
+
+			static MetaAny from_register(const MetaValueRegister& value);
+
+			// Applies a unary `operation` to `value`.
+			// If this operation is not supported for the type of `value`, an empty register is returned.
+			static MetaValueRegister apply_unary(MetaValueOperator operation, const MetaValueRegister& value);
+
+			// Applies a binary `operation` to `left` and `right`.
+			// If this operation is not supported for these types, an empty register is returned.
+			static MetaValueRegister apply_binary(MetaValueOperator operation, const MetaValueRegister& left, const MetaValueRegister& right);
+
+			// Converts `value` to `type`, following the same rules as `MetaTypeConversion`.
+			// If the conversion is not supported, an empty register is returned.
+			static MetaValueRegister convert(const MetaValueRegister& value, MetaValueRegisterType type);
+
+			// Executes this program, using `load` to resolve the operands of `Opcode::Load`.
+			//
+			// If a value could not be represented or an operation could not be performed,
+			// this will return an empty `MetaAny`, and the source operation should be evaluated as usual.
+			template <typename LoadFn>
+			MetaAny execute(LoadFn&& load) const
+			{
+				if (empty())
+				{
+					return {};
+				}
+
+				auto register_file = registers;
+
+				for (const auto& instruction : instructions)
+				{
+					auto& destination = register_file[instruction.destination];
+
+					if (instruction.opcode == Opcode::Load)
+					{
+						destination = to_register(load(instruction.operand));
+					}
+					else
+					{
+						destination = execute_instruction(instruction, register_file);
+					}
+
+					if (std::holds_alternative<std::monostate>(destination))
+					{
+						return {};
+					}
+				}
+
+				return from_register(register_file[result]);
+			}
+
+			// Returns true if this program does not need to resolve any values.
+			inline bool is_constant() const
+			{
+				return ((!empty()) && instructions.empty());
+			}
+
+			// Returns true if no program has been compiled.
+			inline bool empty() const
+			{
+				return registers.empty();
+			}
+
+			// Returns the number of instructions in this program.
+			inline std::size_t size() const
+			{
+				return instructions.size();
+			}
+
+			Container instructions;
+
+			// The initial state of the register file.
+			// Constants are stored in-place, while all other registers are empty.
+			RegisterContainer registers;
+
+			// The register holding the result of this program.
+			MetaValueRegisterIndex result = 0;
+
+		private:
+			static MetaValueRegister execute_instruction(const Instruction& instruction, const RegisterContainer& register_file);
+
+			static std::optional<MetaValueRegisterIndex> lower(MetaValueOperationProgram& program, const MetaValueOperation& operation, const SharedStorageInterface* opt_storage);
+			static std::optional<MetaValueRegisterIndex> lower_operand(MetaValueOperationProgram& program, const MetaAny& value, const SharedStorageInterface* opt_storage);
+
+			static std::optional<MetaValueRegisterIndex> emit_constant(MetaValueOperationProgram& program, MetaValueRegister value);
+			static std::optional<MetaValueRegisterIndex> emit_load(MetaValueOperationProgram& program, const MetaAny& operand);
+			static std::optional<MetaValueRegisterIndex> emit_convert(MetaValueOperationProgram& program, MetaValueRegisterIndex value, MetaValueRegisterType type);
+			static std::optional<MetaValueRegisterIndex> emit_unary(MetaValueOperationProgram& program, MetaValueOperator operation, MetaValueRegisterIndex value);
+			static std::optional<MetaValueRegisterIndex> emit_binary(MetaValueOperationProgram& program, MetaValueOperator operation, MetaValueRegisterIndex left, MetaValueRegisterIndex right);
+
+			// Emits `instruction`, allocating a register for its result.
+			static std::optional<MetaValueRegisterIndex> emit(MetaValueOperationProgram& program, Instruction instruction);
+
+			static bool is_constant_register(const MetaValueOperationProgram& program, MetaValueRegisterIndex index);
+	};
+}
@@ -81,6 +81,24 @@ namespace engine
 		return const_cast<MetaVariableEvaluationContext*>(this)->get_ptr(scope, name);
 	}
 
+	MetaAny* MetaVariableEvaluationContext::get_ptr(MetaVariableScope scope, MetaSymbolID name, MetaVariableSlot slot)
+	{
+		auto* scope_storage = get_storage(scope);
+
+		if (!scope_storage)
+		{
+			return {};
+		}
+
+		return scope_storage->get(name, slot);
+	}
+
+	// NOTE: This overload does not preserve the constness of the requested variable.
+	MetaAny* MetaVariableEvaluationContext::get_ptr(MetaVariableScope scope, MetaSymbolID name, MetaVariableSlot slot) const
+	{
+		return const_cast<MetaVariableEvaluationContext*>(this)->get_ptr(scope, name, slot);
+	}
+
 	MetaAny MetaVariableEvaluationContext::get(MetaVariableScope scope, MetaSymbolID name)
 	{
 		if (auto entry = get_ptr(scope, name))
@@ -96,6 +114,21 @@ namespace engine
 		return const_cast<MetaVariableEvaluationContext*>(this)->get(scope, name);
 	}
 
+	MetaAny MetaVariableEvaluationContext::get(MetaVariableScope scope, MetaSymbolID name, MetaVariableSlot slot)
+	{
+		if (auto entry = get_ptr(scope, name, slot))
+		{
+			return entry->as_ref();
+		}
+
+		return {};
+	}
+
+	MetaAny MetaVariableEvaluationContext::get(MetaVariableScope scope, MetaSymbolID name, MetaVariableSlot slot) const
+	{
+		return const_cast<MetaVariableEvaluationContext*>(this)->get(scope, name, slot);
+	}
+
 	bool MetaVariableEvaluationContext::set(MetaVariableScope scope, MetaSymbolID name, MetaAny&& value, bool override_existing, bool allow_variable_allocation)
 	{
 		return set_impl
@@ -58,11 +58,22 @@ namespace engine
 			// NOTE: This overload does not preserve the constness of the requested variable.
 			MetaAny* get_ptr(MetaVariableScope scope, MetaSymbolID name) const;
 
+			// Retrieves the variable named `name` using its assigned `slot`. (See `MetaVariableTarget::slot`)
+			MetaAny* get_ptr(MetaVariableScope scope, MetaSymbolID name, MetaVariableSlot slot);
+
+			// NOTE: This overload does not preserve the constness of the requested variable.
+			MetaAny* get_ptr(MetaVariableScope scope, MetaSymbolID name, MetaVariableSlot slot) const;
+
 			MetaAny get(MetaVariableScope scope, MetaSymbolID name);
 
 			// NOTE: This overload does not preserve the constness of the requested variable.
 			MetaAny get(MetaVariableScope scope, MetaSymbolID name) const;
 
+			MetaAny get(MetaVariableScope scope, MetaSymbolID name, MetaVariableSlot slot);
+
+			// NOTE: This overload does not preserve the constness of the requested variable.
+			MetaAny get(MetaVariableScope scope, MetaSymbolID name, MetaVariableSlot slot) const;
+
 			bool set
 			(
 				MetaVariableScope scope, MetaSymbolID name, MetaAny&& value,
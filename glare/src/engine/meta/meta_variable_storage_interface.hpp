@@ -20,6 +20,11 @@ namespace engine
 			virtual const MetaAny* get(MetaSymbolID name) const = 0;
 			virtual MetaAny* get(MetaSymbolID name) = 0;
 
+			// Retrieves the variable found at `slot`, if it is named `name`.
+			// If `slot` refers to a different variable, this falls back to a lookup by `name`.
+			virtual const MetaAny* get(MetaSymbolID name, MetaVariableSlot slot) const = 0;
+			virtual MetaAny* get(MetaSymbolID name, MetaVariableSlot slot) = 0;
+
 			virtual MetaAny* set(MetaVariable&& variable) = 0;
 			virtual MetaAny* set(MetaSymbolID name, MetaAny&& value) = 0;
 
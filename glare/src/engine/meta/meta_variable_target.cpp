@@ -2,6 +2,7 @@
 
 #include "meta_evaluation_context.hpp"
 #include "meta_variable_evaluation_context.hpp"
+#include "indirection.hpp"
 
 #include <utility>
 
@@ -9,7 +10,7 @@ namespace engine
 {
 	MetaAny MetaVariableTarget::get(const MetaVariableEvaluationContext& context) const
 	{
-		return context.get(scope, name);
+		return context.get(scope, name, slot);
 	}
 
 	MetaAny MetaVariableTarget::get(const MetaEvaluationContext& context) const
@@ -55,6 +56,21 @@ namespace engine
 	template <typename ...Args>
 	MetaVariableTarget& MetaVariableTarget::set_impl(MetaAny& value, MetaVariableEvaluationContext& variable_context, Args&&... args)
 	{
+		// Assign to the slot of an existing variable directly, if possible.
+		if (auto existing = variable_context.get_ptr(scope, name, slot))
+		{
+			if (auto underlying = try_get_underlying_value(value, args...))
+			{
+				*existing = std::move(underlying);
+			}
+			else
+			{
+				*existing = MetaAny { value };
+			}
+
+			return *this;
+		}
+
 		bool result = false;
 
 		/*
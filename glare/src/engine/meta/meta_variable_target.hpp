@@ -17,6 +17,12 @@ namespace engine
 			// The scope of the targeted variable.
 			MetaVariableScope scope = MetaVariableScope::Local;
 
+			// The position of the targeted variable within its scope's variable storage, if known.
+			// 
+			// Slots are assigned when an entity's threads are built (see `EntityDescriptor::compile_variables`),
+			// and are validated against `name` on access; lookups fall back to `name` if the slot doesn't match.
+			MetaVariableSlot slot = META_VARIABLE_SLOT_INVALID;
+
 			MetaAny get(const MetaVariableEvaluationContext& context) const;
 			MetaAny get(const MetaEvaluationContext& context) const;
 			MetaAny get(Registry& registry, Entity entity, const MetaEvaluationContext& context) const;
@@ -28,8 +34,16 @@ namespace engine
 			//MetaVariableTarget& operator=(const MetaVariableTarget&) = default;
 			//MetaVariableTarget& operator=(MetaVariableTarget&&) noexcept = default;
 
-			bool operator==(const MetaVariableTarget&) const noexcept = default;
-			bool operator!=(const MetaVariableTarget&) const noexcept = default;
+			// NOTE: `slot` is not compared here, since it's derived from `name` and `scope`.
+			inline bool operator==(const MetaVariableTarget& value) const noexcept
+			{
+				return ((name == value.name) && (scope == value.scope));
+			}
+
+			inline bool operator!=(const MetaVariableTarget& value) const noexcept
+			{
+				return !operator==(value);
+			}
 
 		private:
 			template <typename ...Args>
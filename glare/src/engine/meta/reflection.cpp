@@ -263,6 +263,8 @@ namespace engine
 			.data<&MetaFunctionCall::function_id>("function_id"_hs)
 			.data<&MetaFunctionCall::arguments>("arguments"_hs)
 			.data<&MetaFunctionCall::self>("self"_hs)
+			.data<nullptr, &MetaFunctionCall::get_cache_hits>("cache_hits"_hs)
+			.data<nullptr, &MetaFunctionCall::get_cache_misses>("cache_misses"_hs)
 		;
 	}
 
@@ -317,9 +319,9 @@ namespace engine
 		//type = define_to_json_bindings<IndirectMetaAny>(type);
 	}
 
-	GENERATE_EMPTY_DERIVED_TYPE_REFLECTION(OnComponentCreate,  ComponentEvent);
-	GENERATE_EMPTY_DERIVED_TYPE_REFLECTION(OnComponentUpdate,  ComponentEvent);
-	GENERATE_EMPTY_DERIVED_TYPE_REFLECTION(OnComponentDestroy, ComponentEvent);
+	GENERATE_EMPTY_DERIVED_EVENT_REFLECTION(OnComponentCreate,  ComponentEvent);
+	GENERATE_EMPTY_DERIVED_EVENT_REFLECTION(OnComponentUpdate,  ComponentEvent);
+	GENERATE_EMPTY_DERIVED_EVENT_REFLECTION(OnComponentDestroy, ComponentEvent);
 
 	template <>
 	void reflect<ComponentEvent>()
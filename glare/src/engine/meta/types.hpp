@@ -8,6 +8,7 @@
 //#include <entt/meta/meta.hpp>
 
 #include <string_view>
+#include <cstdint>
 
 namespace engine
 {
@@ -33,6 +34,14 @@ namespace engine
 	using MetaRemovalDescription = MetaIDStorage; // <MetaType>
 	using MetaStorageDescription = MetaIDStorage; // <MetaType>
 
+	// The position of a variable within a block of variables. (See `MetaVariableStorageInterface`)
+	using MetaVariableSlot = std::uint16_t;
+
+	inline constexpr MetaVariableSlot META_VARIABLE_SLOT_INVALID = static_cast<MetaVariableSlot>(-1ull);
+
+	// An ordered list of variable names, where the position of each name is its `MetaVariableSlot`.
+	using MetaVariableLayout = util::small_vector<MetaSymbolID, 8>;
+
 	// TODO: Find a better location for this.
 	using entt::resolve;
 
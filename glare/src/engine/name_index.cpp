@@ -0,0 +1,184 @@
+#include "name_index.hpp"
+
+#include "components/name_component.hpp"
+#include "components/relationship_component.hpp"
+
+#include <algorithm>
+
+namespace engine
+{
+	const NameIndex* NameIndex::get(const Registry& registry)
+	{
+		if (const auto name_index = registry.ctx().find<NameIndex*>())
+		{
+			return *name_index;
+		}
+
+		return nullptr;
+	}
+
+	NameIndex::NameIndex(Registry& registry)
+		: registry(registry)
+	{
+		for (auto [entity, name_comp] : registry.view<NameComponent>().each())
+		{
+			add(entity, name_comp.hash());
+		}
+
+		registry.on_construct<NameComponent>().connect<&NameIndex::on_name_construct>(*this);
+		registry.on_update<NameComponent>().connect<&NameIndex::on_name_update>(*this);
+		registry.on_destroy<NameComponent>().connect<&NameIndex::on_name_destroy>(*this);
+
+		registry.ctx().insert_or_assign<NameIndex*>(this);
+	}
+
+	NameIndex::~NameIndex()
+	{
+		registry.on_construct<NameComponent>().disconnect(this);
+		registry.on_update<NameComponent>().disconnect(this);
+		registry.on_destroy<NameComponent>().disconnect(this);
+
+		if (const auto name_index = registry.ctx().find<NameIndex*>(); ((name_index) && (*name_index == this)))
+		{
+			registry.ctx().erase<NameIndex*>();
+		}
+	}
+
+	const NameIndex::EntityList* NameIndex::get_entities(StringHash name_hash) const
+	{
+		if (const auto it = entities_by_name.find(name_hash); it != entities_by_name.end())
+		{
+			return &(it->second);
+		}
+
+		return nullptr;
+	}
+
+	Entity NameIndex::get_first(StringHash name_hash) const
+	{
+		if (const auto entities = get_entities(name_hash))
+		{
+			if (!entities->empty())
+			{
+				return entities->front();
+			}
+		}
+
+		return null;
+	}
+
+	std::optional<Entity> NameIndex::find_child(const Registry& registry, Entity parent, StringHash name_hash, bool recursive) const
+	{
+		const auto entities = get_entities(name_hash);
+
+		if (!entities)
+		{
+			return null;
+		}
+
+		Entity child = null;
+
+		for (const auto entity : *entities)
+		{
+			if (!is_child_of(registry, entity, parent, recursive))
+			{
+				continue;
+			}
+
+			if (child != null)
+			{
+				// Ambiguous; defer to hierarchy traversal order.
+				return std::nullopt;
+			}
+
+			child = entity;
+		}
+
+		return child;
+	}
+
+	bool NameIndex::is_child_of(const Registry& registry, Entity entity, Entity parent, bool recursive)
+	{
+		if ((entity == null) || (parent == null) || (entity == parent))
+		{
+			return false;
+		}
+
+		const auto* relationship = registry.try_get<RelationshipComponent>(entity);
+
+		while (relationship)
+		{
+			const auto current_parent = relationship->get_parent();
+
+			if (current_parent == parent)
+			{
+				return true;
+			}
+
+			if ((!recursive) || (current_parent == null))
+			{
+				break;
+			}
+
+			relationship = registry.try_get<RelationshipComponent>(current_parent);
+		}
+
+		return false;
+	}
+
+	void NameIndex::on_name_construct(Registry& registry, Entity entity)
+	{
+		add(entity, registry.get<NameComponent>(entity).hash());
+	}
+
+	void NameIndex::on_name_update(Registry& registry, Entity entity)
+	{
+		const auto name_hash = registry.get<NameComponent>(entity).hash();
+
+		if (const auto it = name_by_entity.find(entity); it != name_by_entity.end())
+		{
+			if (it->second == name_hash)
+			{
+				return;
+			}
+		}
+
+		remove(entity);
+		add(entity, name_hash);
+	}
+
+	void NameIndex::on_name_destroy(Registry& registry, Entity entity)
+	{
+		remove(entity);
+	}
+
+	void NameIndex::add(Entity entity, StringHash name_hash)
+	{
+		entities_by_name[name_hash].emplace_back(entity);
+		name_by_entity[entity] = name_hash;
+	}
+
+	void NameIndex::remove(Entity entity)
+	{
+		const auto it = name_by_entity.find(entity);
+
+		if (it == name_by_entity.end())
+		{
+			return;
+		}
+
+		if (auto entities_it = entities_by_name.find(it->second); entities_it != entities_by_name.end())
+		{
+			auto& entities = entities_it->second;
+
+			entities.erase(std::remove(entities.begin(), entities.end(), entity), entities.end());
+
+			if (entities.empty())
+			{
+				entities_by_name.erase(entities_it);
+			}
+		}
+
+		name_by_entity.erase(it);
+	}
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <util/small_vector.hpp>
+
+#include <unordered_map>
+#include <optional>
+
+namespace engine
+{
+	// Hashed index of entities by the name stored in their `NameComponent`.
+	// 
+	// The index is maintained through `NameComponent` construct, update and destroy signals.
+	// This means that name changes must be applied through the registry (e.g. `emplace_or_replace`,
+	// `patch`, `replace`) in order to be reflected here. (See `Service::set_name`)
+	// 
+	// While alive, a pointer to this object is also stored in the registry's context,
+	// allowing registry-only code-paths (e.g. `EntityTarget`) to use it. (See `NameIndex::get`)
+	class NameIndex
+	{
+		public:
+			// Entities sharing a name are stored in the order they were indexed.
+			using EntityList = util::small_vector<Entity, 1>;
+
+			// Retrieves the `NameIndex` attached to `registry`'s context, if any.
+			static const NameIndex* get(const Registry& registry);
+
+			NameIndex(Registry& registry);
+
+			NameIndex(const NameIndex&) = delete;
+			NameIndex(NameIndex&&) noexcept = delete;
+
+			NameIndex& operator=(const NameIndex&) = delete;
+			NameIndex& operator=(NameIndex&&) noexcept = delete;
+
+			~NameIndex();
+
+			// Retrieves every entity indexed under `name_hash`, or `nullptr` if there are none.
+			const EntityList* get_entities(StringHash name_hash) const;
+
+			// Retrieves the first entity indexed under `name_hash`, or `null` if there are none.
+			Entity get_first(StringHash name_hash) const;
+
+			// Attempts to find a child (or descendant, if `recursive` is true) of `parent` named `name_hash`.
+			// 
+			// If no entity with this name is a child of `parent`, this will return `null`.
+			// 
+			// If more than one matching entity descends from `parent`, the result would depend on
+			// hierarchy traversal order. In this case, this will return `std::nullopt`, and the caller
+			// should fall back to enumerating the hierarchy directly.
+			std::optional<Entity> find_child(const Registry& registry, Entity parent, StringHash name_hash, bool recursive=true) const;
+
+			// Indicates whether `entity` is a child (or descendant, if `recursive` is true) of `parent`.
+			static bool is_child_of(const Registry& registry, Entity entity, Entity parent, bool recursive=true);
+		protected:
+			void on_name_construct(Registry& registry, Entity entity);
+			void on_name_update(Registry& registry, Entity entity);
+			void on_name_destroy(Registry& registry, Entity entity);
+
+			void add(Entity entity, StringHash name_hash);
+			void remove(Entity entity);
+
+			Registry& registry;
+
+			std::unordered_map<StringHash, EntityList> entities_by_name;
+			std::unordered_map<Entity, StringHash> name_by_entity;
+	};
+}
@@ -15,7 +15,8 @@ namespace engine
 
             MetaTypeReflectionConfig
             {
-                .capture_standard_data_members = false
+                .capture_standard_data_members = false,
+                .generate_event_dispatch       = true
             }
         > (sync_context)
             .base<Command>()
@@ -9,9 +9,14 @@
 #include <engine/meta/cast.hpp>
 #include <engine/meta/short_name.hpp>
 #include <engine/meta/meta_type_descriptor.hpp>
+#include <engine/meta/component_storage.hpp>
 
 #include <utility>
 #include <type_traits>
+#include <algorithm>
+#include <new>
+#include <cstring>
+#include <cstddef>
 
 namespace engine::impl
 {
@@ -220,6 +225,193 @@ namespace engine::impl
         }
     }
 
+    // Moves component `T` from `entity` into the uninitialized memory at `instance_out`, then removes it from `entity`.
+    // (Used by `ComponentStorageOps`; see `register_component_storage_ops`)
+    template <typename T>
+    bool store_component_direct(Registry& registry, Entity entity, void* instance_out)
+    {
+        auto* instance = get_component<T>(registry, entity);
+
+        if (!instance)
+        {
+            return false;
+        }
+
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            std::memcpy(instance_out, instance, sizeof(T));
+        }
+        else
+        {
+            ::new (instance_out) T(std::move(*instance));
+        }
+
+        registry.erase<T>(entity);
+
+        return true;
+    }
+
+    // Copies component `T` from `entity` into the uninitialized memory at `instance_out`.
+    template <typename T>
+    bool copy_component_direct(Registry& registry, Entity entity, void* instance_out)
+    {
+        const auto* instance = get_component<T>(registry, entity);
+
+        if (!instance)
+        {
+            return false;
+        }
+
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            std::memcpy(instance_out, instance, sizeof(T));
+        }
+        else
+        {
+            ::new (instance_out) T(*instance);
+        }
+
+        return true;
+    }
+
+    // Moves the `T` object at `instance` into `registry`, attaching it to `entity`.
+    template <typename T>
+    bool retrieve_component_direct(Registry& registry, Entity entity, void* instance)
+    {
+        auto& stored_instance = *std::launder(reinterpret_cast<T*>(instance));
+
+        registry.emplace_or_replace<T>(entity, std::move(stored_instance));
+
+        return true;
+    }
+
+    template <typename T>
+    void copy_construct_component_direct(void* destination, const void* source)
+    {
+        ::new (destination) T(*std::launder(reinterpret_cast<const T*>(source)));
+    }
+
+    template <typename T>
+    void relocate_component_direct(void* destination, void* source)
+    {
+        auto& source_instance = *std::launder(reinterpret_cast<T*>(source));
+
+        ::new (destination) T(std::move(source_instance));
+
+        source_instance.~T();
+    }
+
+    template <typename T>
+    void destroy_component_direct(void* instance)
+    {
+        std::launder(reinterpret_cast<T*>(instance))->~T();
+    }
+
+    // Registers the `ComponentStorageOps` entry for `T`, allowing `ComponentStorage`
+    // to move instances of `T` without reflection. (Called automatically as part of standard meta-type generation)
+    template <typename T>
+    void register_component_storage_ops(MetaTypeID type_id)
+    {
+        auto ops = ComponentStorageOps
+        {
+            .type_id            = type_id,
+
+            .size               = sizeof(T),
+            .alignment          = alignof(T),
+
+            .store              = &store_component_direct<T>,
+            .copy               = nullptr,
+            .retrieve           = &retrieve_component_direct<T>,
+
+            .trivially_copyable = std::is_trivially_copyable_v<T>
+        };
+
+        if constexpr (std::is_copy_constructible_v<T>)
+        {
+            ops.copy = &copy_component_direct<T>;
+        }
+
+        if constexpr (!std::is_trivially_copyable_v<T>)
+        {
+            if constexpr (std::is_copy_constructible_v<T>)
+            {
+                ops.copy_construct = &copy_construct_component_direct<T>;
+            }
+
+            ops.relocate = &relocate_component_direct<T>;
+            ops.destroy = &destroy_component_direct<T>;
+        }
+
+        ComponentStorageOps::register_type(type_id, ops);
+    }
+
+    // Attaches a copy of `value` as component `T` to each of the `count` entities starting at `entities`.
+    // 
+    // If none of these entities have an existing instance of `T`, the
+    // components are inserted into the underlying storage in a single operation.
+    // 
+    // The return value indicates the number of entities the component was attached to.
+    template <typename T>
+    std::size_t insert_meta_component(Registry& registry, const Entity* entities, std::size_t count, MetaAny& value)
+    {
+        if constexpr (std::is_copy_constructible_v<T>)
+        {
+            if ((!entities) || (!count))
+            {
+                return 0;
+            }
+
+            auto raw_value = from_meta<T>(value);
+
+            if (!raw_value)
+            {
+                if (auto type = resolve<T>())
+                {
+                    if (try_direct_cast(value, type))
+                    {
+                        raw_value = from_meta<T>(value);
+                    }
+                }
+            }
+
+            if (!raw_value)
+            {
+                return 0;
+            }
+
+            const auto* entities_end = (entities + count);
+
+            auto& storage = registry.storage<T>();
+
+            const bool has_existing_instance = std::any_of
+            (
+                entities, entities_end,
+                [&storage](Entity entity)
+                {
+                    return storage.contains(entity);
+                }
+            );
+
+            if (has_existing_instance)
+            {
+                for (const auto* entity = entities; entity < entities_end; entity++)
+                {
+                    registry.emplace_or_replace<T>(*entity, *raw_value);
+                }
+            }
+            else
+            {
+                registry.insert<T>(entities, entities_end, *raw_value);
+            }
+
+            return count;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+
     // Applies a patch to the component `T` attached to `target`, from the context of `source`.
     // If `source` is not specified, `target` will act as the `source` as well.
     template <typename T>
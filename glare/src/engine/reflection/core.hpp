@@ -60,6 +60,12 @@ namespace engine
                 //.template func<&impl::from_void_ptr<T>>("dynamic_cast"_hs)
             ;
 
+            if constexpr ((config.generate_event_dispatch) && (std::is_move_constructible_v<T>))
+            {
+                // Resolve the opaque event dispatch entry for `T` once, rather than on every dispatch.
+                register_opaque_event_dispatch<T>();
+            }
+
             if constexpr (has_method_has_type_v<T, bool>)
             {
                 type = type.template func<&T::has_type>("has_type"_hs);
@@ -82,6 +88,7 @@ namespace engine
                     .template func<&impl::emplace_meta_component<T>, entt::as_ref_t>("emplace_meta_component"_hs)
                     .template func<&impl::store_meta_component<T>>("store_meta_component"_hs)
                     .template func<&impl::copy_meta_component<T>>("copy_meta_component"_hs)
+                    .template func<&impl::insert_meta_component<T>>("insert_meta_component"_hs)
                     .template func<&impl::remove_component<T>>("remove_component"_hs)
                     .template func<&impl::direct_patch_meta_component<T>, entt::as_ref_t>("direct_patch_meta_component"_hs)
                     .template func<&impl::indirect_patch_meta_component<T>>("indirect_patch_meta_component"_hs)
@@ -93,6 +100,12 @@ namespace engine
                     .template func<&MetaEventListener::disconnect<T>>("disconnect_meta_event"_hs)
                 ;
 
+                if constexpr (std::is_move_constructible_v<T> && std::is_move_assignable_v<T>)
+                {
+                    // NOTE: `T`'s type ID has already been assigned at this point. (See `custom_meta_type`)
+                    register_component_storage_ops<T>(resolve<T>().id());
+                }
+
                 if constexpr (std::is_default_constructible_v<T>)
                 {
                     type = type
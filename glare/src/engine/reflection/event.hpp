@@ -0,0 +1,24 @@
+#pragma once
+
+#include "core.hpp"
+
+namespace engine
+{
+    // Declares a meta-type for an event type.
+    // 
+    // Unlike `engine_meta_type`, this registers a `Service::OpaqueEventDispatch` entry for `T`,
+    // allowing opaque (`MetaAny`) instances of `T` to be triggered or queued without a reflective lookup.
+    template <typename T>
+    auto engine_event_type(bool sync_context = true)
+    {
+        return engine_meta_type
+        <
+            T,
+
+            MetaTypeReflectionConfig
+            {
+                .generate_event_dispatch = true
+            }
+        > (sync_context);
+    }
+}
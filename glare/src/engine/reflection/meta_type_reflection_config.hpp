@@ -12,5 +12,9 @@ namespace engine
         bool generate_json_bindings                : 1 = true;
         bool generate_binary_bindings              : 1 = true;
         bool generate_history_component_reflection : 1 = true;
+
+        // Registers a `Service::OpaqueEventDispatch` entry for the type.
+        // (Only enabled for event and command types; see `engine_event_type` and `engine_command_type`)
+        bool generate_event_dispatch               : 1 = false;
     };
 }
\ No newline at end of file
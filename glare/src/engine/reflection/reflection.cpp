@@ -629,6 +629,8 @@ namespace engine
     {
         engine_meta_type<EntityConfig>()
             .data<&EntityConfig::archetype_path>("archetype_path"_hs)
+            .data<&EntityConfig::archetype_cache_path>("archetype_cache_path"_hs)
+            .data<&EntityConfig::use_archetype_cache>("use_archetype_cache"_hs)
         ;
     }
 
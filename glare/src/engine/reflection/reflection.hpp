@@ -22,6 +22,7 @@
 #include "empty.hpp"
 #include "static.hpp"
 #include "command.hpp"
+#include "event.hpp"
 #include "service.hpp"
 #include "system.hpp"
 
@@ -99,4 +100,15 @@
         engine::engine_meta_type<type_name>()                             \
             .base<base_type_name>()                                       \
         ;                                                                 \
+    }
+
+// Generates an empty `reflect` function for the specified `engine` event type,
+// where `type_name` is derived from `base_type_name`. (See `engine_event_type`)
+#define GENERATE_EMPTY_DERIVED_EVENT_REFLECTION(type_name, base_type_name) \
+    template <>                                                            \
+    void reflect<type_name>()                                              \
+    {                                                                      \
+        engine::engine_event_type<type_name>()                             \
+            .base<base_type_name>()                                        \
+        ;                                                                  \
     }
\ No newline at end of file
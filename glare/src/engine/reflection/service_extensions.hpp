@@ -21,4 +21,49 @@ namespace engine::impl
             //throw std::exception("Invalid value specified; unable to trigger event.");
         }
     }
+
+    // Fast-path equivalent of `trigger_event_from_meta_any`, used by `Service::OpaqueEventDispatch`.
+    template <typename EventType>
+    bool trigger_opaque_event_direct(Service& service, MetaAny&& event_instance)
+    {
+        if (auto raw_value = from_meta<EventType>(event_instance))
+        {
+            service.event<EventType>(std::move(*raw_value));
+
+            return true;
+        }
+
+        return false;
+    }
+
+    // Enqueues the `EventType` object held by `event_instance` alongside other events of the same type.
+    template <typename EventType>
+    bool queue_opaque_event_direct(Service& service, MetaAny&& event_instance)
+    {
+        if (auto raw_value = from_meta<EventType>(event_instance))
+        {
+            service.queue_event<EventType>(std::move(*raw_value));
+
+            return true;
+        }
+
+        return false;
+    }
+
+    // Registers the opaque dispatch entry for `EventType` with `Service`.
+    // (Called automatically as part of standard meta-type generation)
+    template <typename EventType>
+    void register_opaque_event_dispatch()
+    {
+        Service::register_opaque_event_dispatch
+        (
+            entt::type_hash<EventType>::value(),
+
+            Service::OpaqueEventDispatch
+            {
+                &trigger_opaque_event_direct<EventType>,
+                &queue_opaque_event_direct<EventType>
+            }
+        );
+    }
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include <engine/entity/entity_construction_context.hpp>
 #include <engine/entity/components/instance_component.hpp>
 #include <engine/entity/components/entity_thread_component.hpp>
+#include <engine/entity/components/state_component.hpp>
 
 #include <engine/meta/component.hpp>
 #include <engine/meta/meta_evaluation_context.hpp>
@@ -25,6 +26,53 @@ namespace engine
 		return factory_data_raw_ptr->create_impl(std::move(factory_data), context, handle_children);
 	}
 
+	std::size_t EntityFactoryData::create_batch(std::shared_ptr<const EntityFactoryData> factory_data, std::size_t count, const EntityConstructionContext& context, Entity* entities_out, bool handle_children)
+	{
+		if (!factory_data)
+		{
+			return 0;
+		}
+
+		const auto entities_created = factory_data->factory.create_batch(count, context, entities_out);
+
+		if (!entities_created)
+		{
+			return 0;
+		}
+
+		const auto* entities_end = (entities_out + entities_created);
+
+		context.registry.insert<InstanceComponent>(entities_out, entities_end, InstanceComponent { factory_data });
+
+		const bool should_generate_children = (handle_children && !factory_data->children.empty());
+
+		for (auto* entity = entities_out; entity < entities_end; entity++)
+		{
+			if (should_generate_children)
+			{
+				auto child_context = EntityConstructionContext
+				{
+					.registry           = context.registry,
+					.resource_manager   = context.resource_manager,
+
+					.parent             = *entity,
+
+					.opt_entity_out     = null,
+
+					.opt_service        = context.opt_service,
+					.opt_system_manager = context.opt_system_manager
+				};
+
+				// NOTE: Recursion.
+				factory_data->generate_children(child_context);
+			}
+
+			*entity = factory_data->on_entity_create(*entity, context);
+		}
+
+		return entities_created;
+	}
+
 	Entity EntityFactoryData::create_impl(std::shared_ptr<const EntityFactoryData>&& factory_data, const EntityConstructionContext& context, bool handle_children) const
 	{
 		auto entity = factory.create(context);
@@ -66,7 +114,6 @@ namespace engine
 	Entity EntityFactoryData::on_entity_create(Entity entity, const EntityConstructionContext& context) const
 	{
 		const auto& descriptor = factory.get_descriptor();
-		const auto& default_state_index = factory.get_default_state_index();
 
 		auto evaluation_context = MetaEvaluationContext
 		{
@@ -86,9 +133,52 @@ namespace engine
 			}
 		}
 
+		start_default_behavior(entity, context, std::nullopt);
+
+		return entity;
+	}
+
+	Entity EntityFactoryData::on_entity_reuse(Entity entity, const EntityConstructionContext& context, std::optional<EntityStateIndex> previous_state) const
+	{
+		const auto& descriptor = factory.get_descriptor();
+
+		auto evaluation_context = MetaEvaluationContext
+		{
+			.variable_context = {},
+			.service          = context.opt_service,
+			.system_manager   = context.opt_system_manager
+		};
+
+		// Reset instance-mutable components to their initial values:
+		for (const auto reset_type_id : descriptor.pool.reset_components)
+		{
+			if (const auto* component = descriptor.components.get_definition(descriptor, reset_type_id))
+			{
+				emplace_component(context.registry, entity, *component, &evaluation_context);
+			}
+		}
+
+		if (!previous_state)
+		{
+			if (const auto* state_component = context.registry.try_get<StateComponent>(entity))
+			{
+				previous_state = state_component->state_index;
+			}
+		}
+
+		start_default_behavior(entity, context, previous_state);
+
+		return entity;
+	}
+
+	void EntityFactoryData::start_default_behavior(Entity entity, const EntityConstructionContext& context, std::optional<EntityStateIndex> previous_state) const
+	{
+		const auto& descriptor = factory.get_descriptor();
+		const auto& default_state_index = factory.get_default_state_index();
+
 		if (default_state_index)
 		{
-			auto result = descriptor.set_state_by_index(context.registry, entity, std::nullopt, *default_state_index);
+			auto result = descriptor.set_state_by_index(context.registry, entity, previous_state, *default_state_index);
 
 			if (!result)
 			{
@@ -108,8 +198,6 @@ namespace engine
 			// Trigger listeners looking for `EntityThreadComponent` patches.
 			context.registry.patch<EntityThreadComponent>(entity);
 		}
-
-		return entity;
 	}
 
 	// NOTE: Recursion via inner calls to `create` and `generate_children`.
@@ -8,6 +8,8 @@
 #include <util/small_vector.hpp>
 
 #include <memory>
+#include <optional>
+#include <cstddef>
 
 namespace engine
 {
@@ -31,6 +33,15 @@ namespace engine
 
 			static Entity create(std::shared_ptr<const EntityFactoryData> factory_data, const EntityConstructionContext& context, bool handle_children=true);
 
+			// Generates `count` entities from `factory_data`, storing each of them in `entities_out`.
+			// 
+			// Components that do not depend on the construction context are attached in bulk; (See also: `EntityFactory::create_batch`)
+			// indirection-dependent components, states, threads and children are still handled per-entity.
+			// 
+			// NOTE: Construction signals for bulk components fire type by type across the whole batch, (See `EntityFactory::create_batch`)
+			// followed by `InstanceComponent`, then the per-entity steps above.
+			static std::size_t create_batch(std::shared_ptr<const EntityFactoryData> factory_data, std::size_t count, const EntityConstructionContext& context, Entity* entities_out, bool handle_children=true);
+
 			// Generates the child entities associated with this factory, then adds them as children to `entity`.
 			// Entities are generated from referenced factories (via instance-path) -- i.e. `EntityFactoryData` instances.
 			// 
@@ -39,10 +50,22 @@ namespace engine
 
 			// Generates the child entities associated with this factory, then adds them as children to `context.parent`.
 			bool generate_children(const EntityConstructionContext& child_context) const;
+
+			// Prepares a previously generated (pooled) `entity` for reuse.
+			// 
+			// This resets the components listed in `EntityPoolConfig::reset_components`,
+			// reapplies the default state and restarts this factory's immediate threads.
+			// 
+			// The default state is entered from `previous_state`, (i.e. the state held prior to deactivation)
+			// ensuring that components belonging to the previous state are removed or stored as usual.
+			Entity on_entity_reuse(Entity entity, const EntityConstructionContext& context, std::optional<EntityStateIndex> previous_state=std::nullopt) const;
 		protected:
 			// Generates an entity using `context`.
 			Entity create_impl(std::shared_ptr<const EntityFactoryData>&& factory_data, const EntityConstructionContext& context, bool handle_children=true) const;
 			
 			Entity on_entity_create(Entity entity, const EntityConstructionContext& context) const;
+
+			// Assigns the default state and starts the immediate threads of this factory.
+			void start_default_behavior(Entity entity, const EntityConstructionContext& context, std::optional<EntityStateIndex> previous_state) const;
 	};
 }
\ No newline at end of file
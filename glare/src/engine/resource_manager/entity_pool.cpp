@@ -0,0 +1,304 @@
+#include "entity_pool.hpp"
+#include "entity_factory_data.hpp"
+
+#include <engine/service.hpp>
+
+#include <engine/entity/entity_construction_context.hpp>
+#include <engine/entity/components/instance_component.hpp>
+#include <engine/entity/components/entity_thread_component.hpp>
+#include <engine/entity/components/active_threads_component.hpp>
+#include <engine/entity/components/state_component.hpp>
+
+#include <engine/components/relationship_component.hpp>
+#include <engine/components/model_component.hpp>
+#include <engine/components/name_component.hpp>
+
+#include <engine/world/physics/components/collision_component.hpp>
+
+#include <util/small_vector.hpp>
+
+#include <algorithm>
+#include <optional>
+#include <cassert>
+
+namespace engine
+{
+	using PooledEntityHierarchy = util::small_vector<Entity, 16>;
+
+	// Retrieves `entity`, followed by each of its descendants.
+	static PooledEntityHierarchy get_entity_hierarchy(Registry& registry, Entity entity)
+	{
+		auto hierarchy = PooledEntityHierarchy { entity };
+
+		if (const auto* relationship = registry.try_get<RelationshipComponent>(entity))
+		{
+			relationship->enumerate_children
+			(
+				registry,
+
+				[&hierarchy](Entity child, const RelationshipComponent& child_relationship, Entity next_child)
+				{
+					hierarchy.push_back(child);
+
+					return true;
+				},
+
+				true
+			);
+		}
+
+		return hierarchy;
+	}
+
+	// Destroys `entity` through `opt_service`, if available.
+	static void destroy_pooled_entity(Registry& registry, Entity entity, Service* opt_service)
+	{
+		if (opt_service)
+		{
+			opt_service->destroy_entity(entity);
+		}
+		else
+		{
+			registry.destroy(entity);
+		}
+	}
+
+	EntityPool::EntityPool(std::shared_ptr<const EntityFactoryData> factory_data) :
+		factory_data(std::move(factory_data))
+	{
+		assert(this->factory_data);
+	}
+
+	const EntityPool::Config& EntityPool::get_config() const
+	{
+		return factory_data->factory.get_descriptor().pool;
+	}
+
+	Entity EntityPool::acquire(const EntityConstructionContext& context)
+	{
+		auto& registry = context.registry;
+
+		while (!inactive_entities.empty())
+		{
+			const auto entity = inactive_entities.back();
+
+			inactive_entities.pop_back();
+
+			// Instances may have been destroyed externally while inactive. (e.g. by their former parent)
+			if (!registry.valid(entity) || !registry.all_of<PooledEntityComponent>(entity))
+			{
+				continue;
+			}
+
+			if (context.parent != null)
+			{
+				if (context.opt_service)
+				{
+					context.opt_service->set_parent(entity, context.parent);
+				}
+				else
+				{
+					RelationshipComponent::set_parent(registry, entity, context.parent);
+				}
+			}
+
+			reactivate(entity, context);
+
+			return entity;
+		}
+
+		auto construction_context = context;
+
+		construction_context.opt_entity_out = null;
+
+		return EntityFactoryData::create(factory_data, construction_context);
+	}
+
+	bool EntityPool::release(Registry& registry, Entity entity, Service* opt_service)
+	{
+		if (!registry.valid(entity))
+		{
+			return false;
+		}
+
+		// Already inactive.
+		if (registry.all_of<PooledEntityComponent>(entity))
+		{
+			return true;
+		}
+
+		const auto& config = get_config();
+
+		if ((config.capacity > 0) && (inactive_entities.size() >= config.capacity))
+		{
+			destroy_pooled_entity(registry, entity, opt_service);
+
+			return false;
+		}
+
+		deactivate(registry, entity, opt_service);
+
+		inactive_entities.push_back(entity);
+
+		return true;
+	}
+
+	std::size_t EntityPool::reserve(const EntityConstructionContext& context, std::size_t count)
+	{
+		auto& registry = context.registry;
+
+		const auto& config = get_config();
+
+		if (config.capacity > 0)
+		{
+			count = std::min(count, static_cast<std::size_t>(config.capacity));
+		}
+
+		if (inactive_entities.size() >= count)
+		{
+			return 0;
+		}
+
+		const auto entities_requested = (count - inactive_entities.size());
+
+		auto construction_context = context;
+
+		construction_context.parent = null;
+		construction_context.opt_entity_out = null;
+
+		const auto initial_size = inactive_entities.size();
+
+		inactive_entities.resize(initial_size + entities_requested);
+
+		auto* entities_out = (inactive_entities.data() + initial_size);
+
+		const auto entities_created = EntityFactoryData::create_batch(factory_data, entities_requested, construction_context, entities_out);
+
+		inactive_entities.resize(initial_size + entities_created);
+
+		for (std::size_t i = initial_size; i < inactive_entities.size(); i++)
+		{
+			deactivate(registry, inactive_entities[i], context.opt_service);
+		}
+
+		return entities_created;
+	}
+
+	void EntityPool::clear(Registry& registry, Service* opt_service)
+	{
+		for (const auto entity : inactive_entities)
+		{
+			if (registry.valid(entity))
+			{
+				destroy_pooled_entity(registry, entity, opt_service);
+			}
+		}
+
+		inactive_entities.clear();
+	}
+
+	void EntityPool::deactivate(Registry& registry, Entity entity, Service* opt_service)
+	{
+		if (opt_service)
+		{
+			// NOTE: Inactive instances are moved to the root of the scene,
+			// ensuring they aren't destroyed alongside their former parent.
+			opt_service->remove_parent(entity);
+		}
+
+		for (const auto instance : get_entity_hierarchy(registry, entity))
+		{
+			auto pooled_component = PooledEntityComponent {};
+
+			if (auto* model = registry.try_get<ModelComponent>(instance))
+			{
+				pooled_component.model_visible = model->get_visible();
+
+				model->set_visible(false);
+			}
+
+			if (auto* collision = registry.try_get<CollisionComponent>(instance))
+			{
+				collision->suspend();
+			}
+
+			// NOTE: Threads are restarted from the archetype's immediate threads upon reuse.
+			registry.remove<EntityThreadComponent>(instance);
+			registry.remove<ActiveThreadsComponent>(instance);
+
+			// NOTE: The default state is re-applied upon reuse, transitioning from the state stored here.
+			if (const auto* state_component = registry.try_get<StateComponent>(instance))
+			{
+				pooled_component.state_index = state_component->state_index;
+
+				registry.erase<StateComponent>(instance);
+			}
+
+			// NOTE: Copied, rather than moved, since destruction listeners may read the outgoing name.
+			if (const auto* name_component = registry.try_get<NameComponent>(instance))
+			{
+				pooled_component.name = *name_component;
+
+				registry.erase<NameComponent>(instance);
+			}
+
+			// Also unregisters `instance` from event listeners. (See `EntitySystem::on_entity_pooled`)
+			registry.emplace_or_replace<PooledEntityComponent>(instance, std::move(pooled_component));
+		}
+	}
+
+	void EntityPool::reactivate(Entity entity, const EntityConstructionContext& context)
+	{
+		auto& registry = context.registry;
+
+		for (const auto instance : get_entity_hierarchy(registry, entity))
+		{
+			auto previous_state = std::optional<EntityStateIndex> {};
+
+			if (auto* pooled_component = registry.try_get<PooledEntityComponent>(instance))
+			{
+				if (auto* model = registry.try_get<ModelComponent>(instance))
+				{
+					model->set_visible(pooled_component->model_visible);
+				}
+
+				if (pooled_component->name)
+				{
+					registry.emplace_or_replace<NameComponent>(instance, std::move(*pooled_component->name));
+				}
+
+				previous_state = pooled_component->state_index;
+
+				registry.erase<PooledEntityComponent>(instance);
+			}
+
+			if (auto* collision = registry.try_get<CollisionComponent>(instance))
+			{
+				collision->resume();
+			}
+
+			if (const auto* instance_component = registry.try_get<InstanceComponent>(instance))
+			{
+				if (const auto& instance_factory = instance_component->instance)
+				{
+					instance_factory->on_entity_reuse(instance, context, previous_state);
+				}
+			}
+		}
+	}
+
+	EntityPools& get_entity_pools(Registry& registry)
+	{
+		if (auto* pools = try_get_entity_pools(registry))
+		{
+			return *pools;
+		}
+
+		return registry.ctx().emplace<EntityPools>();
+	}
+
+	EntityPools* try_get_entity_pools(Registry& registry)
+	{
+		return registry.ctx().find<EntityPools>();
+	}
+}
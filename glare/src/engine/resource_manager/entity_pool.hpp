@@ -0,0 +1,101 @@
+#pragma once
+
+#include <engine/types.hpp>
+
+#include <engine/entity/entity_pool_config.hpp>
+#include <engine/entity/components/pooled_entity_component.hpp>
+
+#include <memory>
+#include <vector>
+#include <unordered_map>
+#include <cstddef>
+
+namespace engine
+{
+	class Service;
+
+	struct EntityFactoryData;
+	struct EntityConstructionContext;
+
+	// Recycles instances of a single archetype, rather than destroying and recreating them.
+	// 
+	// Released instances are deactivated in-place: their threads are stopped, their models are hidden,
+	// and their collision objects are suspended (see `CollisionComponent::suspend`), rather than destroyed.
+	// Their state and name are also removed while inactive, (see `PooledEntityComponent`) meaning that
+	// they no longer respond to events, and can't be found by name.
+	// 
+	// When an instance is reused, only the components listed in `EntityPoolConfig::reset_components`
+	// are reset, along with the default state and immediate threads of the archetype.
+	class EntityPool
+	{
+		public:
+			using Config = EntityPoolConfig;
+
+			EntityPool(std::shared_ptr<const EntityFactoryData> factory_data);
+
+			EntityPool(const EntityPool&) = delete;
+			EntityPool(EntityPool&&) noexcept = default;
+
+			EntityPool& operator=(const EntityPool&) = delete;
+			EntityPool& operator=(EntityPool&&) noexcept = default;
+
+			// Reactivates an inactive instance using `context`.
+			// If no inactive instances are available, a new instance is generated instead.
+			// 
+			// NOTE: The `opt_entity_out` field of `context` is ignored by this routine.
+			Entity acquire(const EntityConstructionContext& context);
+
+			// Deactivates `entity`, returning it to this pool.
+			// 
+			// If this pool has reached its capacity, `entity` is destroyed instead. (See `Service::destroy_entity`)
+			// The return value indicates whether `entity` was retained.
+			bool release(Registry& registry, Entity entity, Service* opt_service=nullptr);
+
+			// Generates inactive instances until `count` instances are available.
+			// 
+			// The return value is the number of instances generated.
+			std::size_t reserve(const EntityConstructionContext& context, std::size_t count);
+
+			// Destroys every inactive instance held by this pool.
+			void clear(Registry& registry, Service* opt_service=nullptr);
+
+			// The number of inactive instances available for reuse.
+			inline std::size_t size() const
+			{
+				return inactive_entities.size();
+			}
+
+			inline bool empty() const
+			{
+				return inactive_entities.empty();
+			}
+
+			const Config& get_config() const;
+
+			inline const std::shared_ptr<const EntityFactoryData>& get_factory_data() const
+			{
+				return factory_data;
+			}
+
+		private:
+			// Deactivates `entity` and its children.
+			void deactivate(Registry& registry, Entity entity, Service* opt_service);
+
+			// Reactivates `entity` and its children, resetting the state of each instance.
+			void reactivate(Entity entity, const EntityConstructionContext& context);
+
+			std::shared_ptr<const EntityFactoryData> factory_data;
+
+			std::vector<Entity> inactive_entities;
+	};
+
+	// The pools associated with a registry, keyed by factory.
+	// (Stored in the registry's context; see `get_entity_pools`)
+	using EntityPools = std::unordered_map<const EntityFactoryData*, EntityPool>;
+
+	// Retrieves the pools associated with `registry`, creating them if needed.
+	EntityPools& get_entity_pools(Registry& registry);
+
+	// Retrieves the pools associated with `registry`, if any exist.
+	EntityPools* try_get_entity_pools(Registry& registry);
+}
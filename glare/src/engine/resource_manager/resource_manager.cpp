@@ -2,6 +2,7 @@
 
 #include "animation_data.hpp"
 #include "entity_factory_data.hpp"
+#include "entity_pool.hpp"
 
 #include "loaders/loaders.hpp"
 
@@ -9,12 +10,16 @@
 
 #include <engine/entity/entity_factory_context.hpp>
 #include <engine/entity/entity_construction_context.hpp>
+#include <engine/entity/components/instance_component.hpp>
 
 #include <engine/world/physics/collision_shape_description.hpp>
 #include <engine/world/world.hpp>
 
 #include <util/string.hpp>
 #include <util/algorithm.hpp>
+#include <util/concurrency.hpp>
+#include <util/small_vector.hpp>
+#include <util/log.hpp>
 
 #include <math/bullet.hpp>
 
@@ -26,6 +31,9 @@
 #include <memory>
 #include <tuple>
 #include <limits>
+#include <thread>
+#include <unordered_set>
+#include <exception>
 
 /*
 #define AI_CONFIG_PP_PTV_NORMALIZE   "PP_PTV_NORMALIZE"
@@ -46,6 +54,8 @@ namespace engine
 	{
 		set_default_shader(default_shader);
 		set_default_animated_shader(default_animated_shader);
+
+		set_factory_worker_count(static_cast<std::size_t>(std::thread::hardware_concurrency()));
 	}
 
 	ResourceManager::~ResourceManager() {}
@@ -208,9 +218,10 @@ namespace engine
 		return {};
 	}
 
-	// NOTE: Implementation may not be thread-safe due to use of `erase`.
 	std::shared_ptr<const EntityFactoryData> ResourceManager::get_existing_factory(const std::string& path) const // std::string_view
 	{
+		auto lock = std::scoped_lock { entity_factory_mutex };
+
 		auto it = entity_factories.find(path);
 
 		if (it != entity_factories.end())
@@ -251,11 +262,67 @@ namespace engine
 	{
 		const auto path_str = context.paths.instance_path.string();
 
-		if (auto existing_factory = get_existing_factory(path_str))
+		auto factory_promise = std::promise<std::shared_ptr<const EntityFactoryData>> {};
+
+		{
+			auto lock = std::unique_lock { entity_factory_mutex };
+
+			if (auto it = entity_factories.find(path_str); it != entity_factories.end())
+			{
+				if (auto existing_factory = it->second.lock())
+				{
+					return existing_factory;
+				}
+
+				entity_factories.erase(it);
+			}
+
+			if (auto it = pending_entity_factories.find(path_str); it != pending_entity_factories.end())
+			{
+				// Another thread is already building this factory; wait for its result.
+				auto pending_factory = it->second;
+
+				lock.unlock();
+
+				return pending_factory.get();
+			}
+
+			pending_entity_factories.try_emplace(path_str, factory_promise.get_future().share());
+		}
+
+		auto factory_data = std::shared_ptr<EntityFactoryData> {};
+
+		try
 		{
-			return existing_factory;
+			factory_data = build_factory(context);
 		}
+		catch (...)
+		{
+			{
+				auto lock = std::scoped_lock { entity_factory_mutex };
+
+				pending_entity_factories.erase(path_str);
+			}
+
+			factory_promise.set_exception(std::current_exception());
+
+			throw;
+		}
+
+		{
+			auto lock = std::scoped_lock { entity_factory_mutex };
+
+			entity_factories.insert_or_assign(path_str, factory_data);
+			pending_entity_factories.erase(path_str);
+		}
+
+		factory_promise.set_value(factory_data);
+
+		return factory_data;
+	}
 
+	std::shared_ptr<EntityFactoryData> ResourceManager::build_factory(const EntityFactoryContext& context) const
+	{
 		// List of factory paths representing children of this entity.
 		// (Used during entity instantiation)
 		EntityFactoryChildren children;
@@ -269,7 +336,8 @@ namespace engine
 			// NOTE: Recursion.
 			[this, &children](const EntityDescriptor& parent_descriptor, const EntityFactoryContext& child_context)
 			{
-				// Call back into this function recursively for each child.
+				// Call back into `get_factory` recursively for each child.
+				// (Children shared with factories being built on other threads are only built once)
 				auto child_factory_data = this->get_factory(child_context);
 
 				assert(child_factory_data);
@@ -291,26 +359,208 @@ namespace engine
 
 		// NOTE: In the case of child factories, the parent factory is initialized last.
 		// This applies recursively to each level of the hierarchy.
-		auto factory_data = std::make_shared<EntityFactoryData>(std::move(factory), std::move(children));
+		return std::make_shared<EntityFactoryData>(std::move(factory), std::move(children));
+	}
+
+	EntityFactorySet ResourceManager::preload_factories(const std::vector<EntityFactoryContext>& contexts) const
+	{
+		auto factories_out = EntityFactorySet {};
+
+		// Ensure shared parsing state is initialized before any workers are started.
+		get_parsing_context();
+
+		// Only one request is made per unique instance path.
+		auto unique_contexts = util::small_vector<const EntityFactoryContext*, 32> {};
+		auto requested_paths = std::unordered_set<std::string> {};
+
+		for (const auto& context : contexts)
+		{
+			if (requested_paths.emplace(context.paths.instance_path.string()).second)
+			{
+				unique_contexts.emplace_back(&context);
+			}
+		}
+
+		factories_out.reserve(unique_contexts.size());
+
+		if ((factory_worker_count <= 1) || (unique_contexts.size() <= 1))
+		{
+			for (const auto* context : unique_contexts)
+			{
+				if (auto factory = get_factory(*context))
+				{
+					factories_out.emplace_back(std::move(factory));
+				}
+			}
+
+			return factories_out;
+		}
 
-		if (auto [it, result] = entity_factories.try_emplace(path_str, factory_data); result)
+		if (!factory_thread_pool)
 		{
-			return factory_data;
+			auto runtime_options = util::concurrency::runtime_options {};
+
+			runtime_options.max_cpu_threads = factory_worker_count;
+
+			factory_thread_pool = std::make_unique<util::concurrency::runtime>(runtime_options);
 		}
 
-		return {}; // factory_data;
+		auto executor = factory_thread_pool->thread_pool_executor();
+
+		auto task_results = util::small_vector<util::Result<std::shared_ptr<const EntityFactoryData>>, 32> {};
+
+		for (const auto* context : unique_contexts)
+		{
+			task_results.emplace_back
+			(
+				executor->submit
+				(
+					[this, context]()
+					{
+						return get_factory(*context);
+					}
+				)
+			);
+		}
+
+		for (auto& task_result : task_results)
+		{
+			try
+			{
+				if (auto factory = task_result.get())
+				{
+					factories_out.emplace_back(std::move(factory));
+				}
+			}
+			catch (const std::exception& e)
+			{
+				// NOTE: Failures are reported here, but are otherwise deferred until the factory is requested directly.
+				print_warn("Failed to preload entity factory: {}", e.what());
+			}
+		}
+
+		return factories_out;
+	}
+
+	void ResourceManager::set_factory_worker_count(std::size_t worker_count)
+	{
+		if (worker_count == factory_worker_count)
+		{
+			return;
+		}
+
+		factory_worker_count = worker_count;
+
+		// NOTE: The thread pool is recreated on the next call to `preload_factories`.
+		factory_thread_pool = {};
 	}
 
 	Entity ResourceManager::generate_entity(const EntityFactoryContext& factory_context, const EntityConstructionContext& entity_context, bool handle_children) const
 	{
 		if (auto factory = get_factory(factory_context))
 		{
+			// NOTE: Pooling is bypassed when an explicit output entity is requested.
+			if ((handle_children) && (entity_context.opt_entity_out == null) && (factory->factory.get_descriptor().pool))
+			{
+				const auto* factory_key = factory.get();
+
+				auto& pools = get_entity_pools(entity_context.registry);
+
+				auto pool_it = pools.try_emplace(factory_key, std::move(factory)).first;
+
+				return pool_it->second.acquire(entity_context);
+			}
+
 			return EntityFactoryData::create(std::move(factory), entity_context, handle_children);
 		}
 
 		return null;
 	}
 
+	std::size_t ResourceManager::generate_entities(const EntityFactoryContext& factory_context, const EntityConstructionContext& entity_context, std::size_t count, Entity* entities_out, bool handle_children) const
+	{
+		if (auto factory = get_factory(factory_context))
+		{
+			return EntityFactoryData::create_batch(std::move(factory), count, entity_context, entities_out, handle_children);
+		}
+
+		return 0;
+	}
+
+	bool ResourceManager::release_entity(Registry& registry, Entity entity, Service* opt_service) const
+	{
+		if (!registry.valid(entity))
+		{
+			return false;
+		}
+
+		if (const auto* instance_component = registry.try_get<InstanceComponent>(entity))
+		{
+			const auto& factory = instance_component->instance;
+
+			if ((factory) && (factory->factory.get_descriptor().pool))
+			{
+				auto& pools = get_entity_pools(registry);
+
+				auto pool_it = pools.try_emplace(factory.get(), factory).first;
+
+				return pool_it->second.release(registry, entity, opt_service);
+			}
+		}
+
+		if (opt_service)
+		{
+			opt_service->destroy_entity(entity);
+		}
+		else
+		{
+			registry.destroy(entity);
+		}
+
+		return false;
+	}
+
+	std::size_t ResourceManager::prewarm_entity_pools(const EntityFactorySet& factories, const EntityConstructionContext& entity_context) const
+	{
+		std::size_t entities_generated = 0;
+
+		auto visited = std::unordered_set<const EntityFactoryData*> {};
+
+		auto prewarm = [this, &entity_context, &entities_generated, &visited](const auto& factory, auto& prewarm) -> void
+		{
+			if (!factory || !visited.emplace(factory.get()).second)
+			{
+				return;
+			}
+
+			// NOTE: Recursion.
+			for (const auto& child_factory : factory->children)
+			{
+				prewarm(child_factory, prewarm);
+			}
+
+			const auto& config = factory->factory.get_descriptor().pool;
+
+			if ((!config) || (config.size == 0))
+			{
+				return;
+			}
+
+			auto& pools = get_entity_pools(entity_context.registry);
+
+			auto pool_it = pools.try_emplace(factory.get(), factory).first;
+
+			entities_generated += pool_it->second.reserve(entity_context, config.size);
+		};
+
+		for (const auto& factory : factories)
+		{
+			prewarm(factory, prewarm);
+		}
+
+		return entities_generated;
+	}
+
 	void ResourceManager::subscribe(World& world)
 	{
 		//world.register_event<...>(*this);
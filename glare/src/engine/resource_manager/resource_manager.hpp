@@ -27,12 +27,20 @@
 
 //#include <utility>
 #include <optional>
+#include <future>
+#include <mutex>
+#include <cstddef>
 
 namespace game
 {
 	class Game;
 }
 
+namespace concurrencpp
+{
+	class runtime;
+}
+
 namespace graphics
 {
 	class Context;
@@ -44,6 +52,7 @@ namespace graphics
 namespace engine
 {
 	class World;
+	class Service;
 	class WorldRenderer;
 	class EntityDescriptor;
 
@@ -56,6 +65,9 @@ namespace engine
 
 	using EntityFactoryKey = std::string; // std::string_view; // EntityFactory::FactoryKey:
 
+	// A collection of strong references to factories, used to keep factories alive until they are instantiated.
+	using EntityFactorySet = std::vector<std::shared_ptr<const EntityFactoryData>>;
+
 	// TODO: Revisit weak vs. strong references for caching.
 	// Theoretically we could use weak references but return strong references upon initial request.
 
@@ -85,6 +97,13 @@ namespace engine
 
 		// Maps file paths to factory objects able to generate entities of a given specification.
 		mutable std::unordered_map<FactoryKey, std::weak_ptr<EntityFactoryData>> entity_factories; // , std::owner_less<> // std::map
+
+		// Factories currently being built, mapped to the result of the thread building them.
+		// Other threads requesting the same factory wait on this result, rather than building a duplicate.
+		mutable std::unordered_map<FactoryKey, std::shared_future<std::shared_ptr<const EntityFactoryData>>> pending_entity_factories;
+
+		// Guards `entity_factories` and `pending_entity_factories`.
+		mutable std::mutex entity_factory_mutex;
 	};
 
 	class ResourceManager : protected Resources
@@ -98,7 +117,7 @@ namespace engine
 			friend class game::Game;
 
 			ResourceManager(const std::shared_ptr<graphics::Context>& context, const std::shared_ptr<graphics::Shader>& default_shader={}, const std::shared_ptr<graphics::Shader>& default_animated_shader={});
-			~ResourceManager();
+			virtual ~ResourceManager();
 
 			inline const std::shared_ptr<graphics::Context>& get_context() const { return context; }
 
@@ -145,8 +164,46 @@ namespace engine
 			const EntityDescriptor* get_existing_descriptor(const std::string& path) const;
 			std::shared_ptr<const EntityFactoryData> get_factory(const EntityFactoryContext& context) const;
 
+			// Builds the factories described by `contexts` ahead of time, using worker threads if available.
+			// 
+			// Child factories are discovered and built by the worker responsible for their parent,
+			// and factories shared between multiple archetypes are only built once.
+			// 
+			// The returned set holds strong references to each requested factory,
+			// and should be kept alive until entities have been generated from them.
+			EntityFactorySet preload_factories(const std::vector<EntityFactoryContext>& contexts) const;
+
+			// Sets the number of worker threads used by `preload_factories`.
+			// If `worker_count` is zero, factories are built on the calling thread.
+			void set_factory_worker_count(std::size_t worker_count);
+
+			inline std::size_t get_factory_worker_count() const
+			{
+				return factory_worker_count;
+			}
+
 			Entity generate_entity(const EntityFactoryContext& factory_context, const EntityConstructionContext& entity_context, bool handle_children=true) const;
 
+			// Generates `count` entities using the factory described by `factory_context`, storing each of them in `entities_out`.
+			// 
+			// This is more efficient than repeated calls to `generate_entity`, since the factory
+			// is only resolved once, and constant components are instantiated once for the entire batch.
+			// 
+			// NOTE: Components are attached type by type across the batch; see `EntityFactory::create_batch` for the order of construction signals.
+			std::size_t generate_entities(const EntityFactoryContext& factory_context, const EntityConstructionContext& entity_context, std::size_t count, Entity* entities_out, bool handle_children=true) const;
+
+			// Returns `entity` to the pool associated with its archetype, if pooling is enabled for it.
+			// If `entity` is not pooled (or its pool is full), it will be destroyed instead. (See `Service::destroy_entity`)
+			// 
+			// The return value indicates whether `entity` was retained for reuse.
+			bool release_entity(Registry& registry, Entity entity, Service* opt_service=nullptr) const;
+
+			// Generates inactive instances for each pooled archetype in `factories`, (including child archetypes)
+			// up to the `size` specified by their pool configuration.
+			// 
+			// The return value is the total number of instances generated.
+			std::size_t prewarm_entity_pools(const EntityFactorySet& factories, const EntityConstructionContext& entity_context) const;
+
 			MetaParsingContext set_type_resolution_context(MetaTypeResolutionContext&& context);
 			//MetaParsingContext set_variable_context(MetaVariableContext&& context);
 
@@ -156,6 +213,11 @@ namespace engine
 			// Links events from `world` to this resource manager instance.
 			void subscribe(World& world);
 		protected:
+			// Builds a new factory for `context`, along with any child factories it references.
+			// 
+			// NOTE: Called by `get_factory` at most once per pending request; this may be called from worker threads.
+			virtual std::shared_ptr<EntityFactoryData> build_factory(const EntityFactoryContext& context) const;
+
 			//inline static std::string resolve_path(const std::string& path) { return path; }
 
 			static std::string resolve_path(const std::string& path);
@@ -166,6 +228,11 @@ namespace engine
 			mutable std::shared_ptr<graphics::Shader> default_animated_shader;
 
 			mutable std::optional<MetaTypeResolutionContext> type_resolution_context = std::nullopt;
+
+			// Worker threads used by `preload_factories`. (Created on first use)
+			mutable std::unique_ptr<concurrencpp::runtime> factory_thread_pool;
+
+			std::size_t factory_worker_count = 0;
 			//mutable std::optional<MetaVariableContext> variable_context = std::nullopt;
 	};
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "input/raw_input_events.hpp"
 
 #include "meta/indirection.hpp"
+#include "meta/hash.hpp"
 
 #include "meta/meta_type_descriptor.hpp"
 #include "meta/meta_evaluation_context.hpp"
@@ -23,9 +24,13 @@
 
 #include <app/input/mouse_state.hpp>
 #include <app/input/keyboard_state.hpp>
+#include <app/input/mouse_events.hpp>
+#include <app/input/keyboard_events.hpp>
+#include <app/input/gamepad_events.hpp>
 //#include <app/input/gamepad_state.hpp>
 
 #include <algorithm>
+#include <unordered_map>
 
 #include <util/format.hpp>
 
@@ -49,6 +54,7 @@ namespace engine
 	) :
 		registry(registry),
 		systems(systems),
+		name_index(registry),
 		active_event_handler(&standard_event_handler),
 		policy(policy)
 	{
@@ -97,6 +103,15 @@ namespace engine
 	{
 		registry.on_destroy<RelationshipComponent>().disconnect(this);
 
+		// NOTE: Operations that were never handled still own their callbacks' captured state,
+		// which must be destroyed before `frame_arena` releases the underlying memory.
+		for (const auto& operation : deferred_operations)
+		{
+			operation.destroy(operation.instance);
+		}
+
+		deferred_operations.clear();
+
 		//unregister_event(*this);
 	}
 
@@ -115,6 +130,12 @@ namespace engine
 
 		const auto type = component.get_type();
 
+		if (policy.coalesce_component_patches)
+		{
+			// Indirect patches may depend on the current state of the component; apply any staged write first.
+			apply_staged_component_write(component_patch.target, type.id());
+		}
+
 		auto patch_fn = type.func("indirect_patch_meta_component"_hs);
 
 		if (!patch_fn)
@@ -150,8 +171,6 @@ namespace engine
 
 	void Service::on_direct_component_patch(const ComponentPatchCommand& component_patch)
 	{
-		using namespace engine::literals;
-
 		auto& component = component_patch.component;
 
 		if (!component)
@@ -161,7 +180,40 @@ namespace engine
 			return;
 		}
 
-		const auto& entity = component_patch.target;
+		if (policy.coalesce_component_patches)
+		{
+			stage_component_write(component_patch.target, MetaAny { component }, false, component_patch.use_member_assignment);
+
+			return;
+		}
+
+		apply_direct_component_patch(component_patch.target, component, component_patch.use_member_assignment);
+	}
+
+	void Service::on_component_replace(ComponentReplaceCommand& component_replace)
+	{
+		auto& component = component_replace.component;
+
+		if (!component)
+		{
+			print_warn("Failed to replace component: Missing component instance.");
+
+			return;
+		}
+
+		if (policy.coalesce_component_patches)
+		{
+			stage_component_write(component_replace.target, std::move(component), true, false);
+
+			return;
+		}
+
+		apply_component_replace(component_replace.target, component);
+	}
+
+	void Service::apply_direct_component_patch(Entity entity, const MetaAny& component, bool use_member_assignment)
+	{
+		using namespace engine::literals;
 
 		const auto type = component.type();
 
@@ -183,7 +235,7 @@ namespace engine
 			entt::forward_as_meta(registry),
 			entt::forward_as_meta(entity),
 			entt::forward_as_meta(std::move(component)),
-			entt::forward_as_meta(component_patch.use_member_assignment)
+			entt::forward_as_meta(use_member_assignment)
 		);
 
 		if (!result)
@@ -192,21 +244,10 @@ namespace engine
 		}
 	}
 
-	void Service::on_component_replace(ComponentReplaceCommand& component_replace)
+	void Service::apply_component_replace(Entity entity, MetaAny& component)
 	{
 		using namespace engine::literals;
 
-		auto& component = component_replace.component;
-
-		if (!component)
-		{
-			print_warn("Failed to replace component: Missing component instance.");
-
-			return;
-		}
-
-		const auto& entity = component_replace.target;
-
 		const auto type = component.type();
 
 		auto replace_fn = type.func("emplace_meta_component"_hs);
@@ -235,6 +276,133 @@ namespace engine
 		}
 	}
 
+	static std::uint64_t get_staged_component_write_key(Entity entity, MetaTypeID component_type_id)
+	{
+		return ((static_cast<std::uint64_t>(static_cast<EntityIDType>(entity)) << 32) | static_cast<std::uint64_t>(component_type_id));
+	}
+
+	void Service::stage_component_write(Entity entity, MetaAny&& component, bool is_replacement, bool use_member_assignment)
+	{
+		const auto key = get_staged_component_write_key(entity, component.type().id());
+
+		if (const auto it = staged_component_write_indices.find(key); it != staged_component_write_indices.end())
+		{
+			auto& staged_write = staged_component_writes[it->second];
+
+			// Full assignments and replacements overwrite every field of the previous write.
+			// Member-wise assignment only overwrites reflected (non-const) data members, meaning that
+			// it can only supersede another member-wise assignment. Otherwise, we apply the existing write first.
+			const bool supersedes_staged_write =
+			(
+				(is_replacement)
+				||
+				(!use_member_assignment)
+				||
+				((!staged_write.is_replacement) && (staged_write.use_member_assignment))
+			);
+
+			if (supersedes_staged_write)
+			{
+				staged_write.component = std::move(component);
+				staged_write.is_replacement = is_replacement;
+				staged_write.use_member_assignment = use_member_assignment;
+
+				return;
+			}
+
+			apply_staged_component_write(entity, component.type().id());
+		}
+
+		staged_component_write_indices[key] = staged_component_writes.size();
+
+		staged_component_writes.emplace_back
+		(
+			StagedComponentWrite
+			{
+				entity,
+				std::move(component),
+				is_replacement,
+				use_member_assignment
+			}
+		);
+	}
+
+	void Service::apply_staged_component_write(Entity entity, MetaTypeID component_type_id)
+	{
+		const auto it = staged_component_write_indices.find(get_staged_component_write_key(entity, component_type_id));
+
+		if (it == staged_component_write_indices.end())
+		{
+			return;
+		}
+
+		// Move the write out of its slot, leaving an empty entry to be skipped later.
+		auto staged_write = std::move(staged_component_writes[it->second]);
+
+		staged_component_writes[it->second].component = {};
+
+		staged_component_write_indices.erase(it);
+
+		if (!registry.valid(staged_write.entity))
+		{
+			return;
+		}
+
+		if (staged_write.is_replacement)
+		{
+			apply_component_replace(staged_write.entity, staged_write.component);
+		}
+		else
+		{
+			apply_direct_component_patch(staged_write.entity, staged_write.component, staged_write.use_member_assignment);
+		}
+	}
+
+	void Service::apply_staged_component_writes()
+	{
+		if (staged_component_writes.empty())
+		{
+			return;
+		}
+
+		// Writes staged while applying (e.g. from component listeners) are handled on the next update.
+		auto staged_writes = std::move(staged_component_writes);
+
+		staged_component_writes.clear();
+		staged_component_write_indices.clear();
+
+		for (auto& staged_write : staged_writes)
+		{
+			// Skip entries already applied early. (See `apply_staged_component_write`)
+			if (!staged_write.component)
+			{
+				continue;
+			}
+
+			if (!registry.valid(staged_write.entity))
+			{
+				continue;
+			}
+
+			if (staged_write.is_replacement)
+			{
+				apply_component_replace(staged_write.entity, staged_write.component);
+			}
+			else
+			{
+				apply_direct_component_patch(staged_write.entity, staged_write.component, staged_write.use_member_assignment);
+			}
+		}
+
+		// Reuse the existing allocation, if possible.
+		if (staged_component_writes.empty())
+		{
+			staged_writes.clear();
+
+			staged_component_writes = std::move(staged_writes);
+		}
+	}
+
 	void Service::on_set_parent(const SetParentCommand& parent_command)
 	{
 		set_parent(parent_command.target, parent_command.parent);
@@ -353,33 +521,49 @@ namespace engine
 		return active_event_handler;
 	}
 
-	// TODO: Implement thread-safe locking/synchronization event-handler interface.
 	// TODO: Determine if some (or all) events should be handled in the fixed update function, rather than the continuous function.
 	void Service::update(app::Milliseconds time, float delta)
 	{
+		// Forward events submitted from other threads into the standard event handler.
+		use_standard_events();
+		handle_submitted_events();
+
 		// Handle standard events:
 		use_forwarding_events();
-		standard_event_handler.update();
+		update_event_handler(standard_event_handler, "standard_event_handler");
 
 		// TODO: Implement thread/async-driven timed-event detection and queueing.
 		update_timed_events();
 
 		// Handle forwarding events:
 		use_standard_events();
-		forwarding_event_handler.update();
+		update_event_handler(forwarding_event_handler, "forwarding_event_handler");
+
+		// Apply coalesced component patches. (See `ServicePolicy::coalesce_component_patches`)
+		apply_staged_component_writes();
 
 		// Trigger the standard update event for this service.
 		this->event<OnServiceUpdate>(this, time, delta);
 
-		service_event_handler.update();
+		update_event_handler(service_event_handler, "service_event_handler");
 
 		handle_deferred_operations();
+
+		if (event_recorder)
+		{
+			event_recorder->record_update(time, delta);
+		}
 	}
 
 	void Service::fixed_update(app::Milliseconds time, float delta)
 	{
 		// Trigger the fixed update event for this service.
 		this->event<OnServiceFixedUpdate>(this, time, delta);
+
+		if (event_recorder)
+		{
+			event_recorder->record_fixed_update(time, delta);
+		}
 	}
 
 	void Service::handle_deferred_operations()
@@ -389,12 +573,37 @@ namespace engine
 			return;
 		}
 
-		for (const auto& fn : deferred_operations)
+		event_dispatch_depth++;
+
+		// NOTE: Indexed iteration, since deferred operations may queue additional operations.
+		for (std::size_t operation_index = 0; operation_index < deferred_operations.size(); operation_index++)
 		{
-			fn();
+			const auto operation = deferred_operations[operation_index];
+
+			operation.execute(operation.instance);
+		}
+
+		event_dispatch_depth--;
+
+		for (const auto& operation : deferred_operations)
+		{
+			operation.destroy(operation.instance);
 		}
 
 		deferred_operations.clear();
+
+		frame_arena.reset();
+	}
+
+	void Service::handle_submitted_events()
+	{
+		submitted_events.drain
+		(
+			[this](EventSubmission&& submission)
+			{
+				submission(*this);
+			}
+		);
 	}
 
 	void Service::render(app::Graphics& gfx)
@@ -460,6 +669,45 @@ namespace engine
 		return false;
 	}
 
+	void Service::destroy_entity(Entity entity)
+	{
+		if (auto command_buffer = thread_command_buffer) [[unlikely]]
+		{
+			command_buffer->emplace
+			(
+				[entity](Service& service)
+				{
+					service.destroy_entity(entity);
+				}
+			);
+
+			return;
+		}
+
+		if (event_dispatch_depth > 0)
+		{
+			// NOTE: Destroyed directly once deferred, since deferred operations
+			// are themselves executed at a non-zero dispatch depth.
+			later
+			(
+				[this, entity]()
+				{
+					if (registry.valid(entity))
+					{
+						registry.destroy(entity);
+					}
+				}
+			);
+
+			return;
+		}
+
+		if (registry.valid(entity))
+		{
+			registry.destroy(entity);
+		}
+	}
+
 	std::string Service::label(Entity entity) const
 	{
 		if (entity == null)
@@ -506,15 +754,17 @@ namespace engine
 
 	Entity Service::get_by_name(std::string_view name) const
 	{
-		auto view = registry.view<NameComponent>();
+		const auto entities = name_index.get_entities(hash(name));
 
-		for (auto it = view.begin(); it != view.end(); it++)
+		if (!entities)
 		{
-			Entity entity = *it;
-
-			const auto& name_comp = registry.get<NameComponent>(entity);
+			return null;
+		}
 
-			if (name_comp.get_name() == name)
+		for (const auto entity : *entities)
+		{
+			// Guard against hash collisions.
+			if (get_name(entity) == name)
 			{
 				return entity;
 			}
@@ -523,6 +773,11 @@ namespace engine
 		return null;
 	}
 
+	const NameIndex& Service::get_name_index() const
+	{
+		return name_index;
+	}
+
 	Entity Service::get_child_by_name(Entity entity, std::string_view child_name, bool recursive) const
 	{
 		if (child_name.empty())
@@ -530,6 +785,21 @@ namespace engine
 			return null;
 		}
 
+		if (auto indexed_child = name_index.find_child(registry, entity, hash(child_name), recursive))
+		{
+			// Guard against hash collisions.
+			if ((*indexed_child == null) || (get_name(*indexed_child) == child_name))
+			{
+				return *indexed_child;
+			}
+		}
+
+		// Multiple candidates; fall back to enumerating the hierarchy to preserve traversal order.
+		return get_child_by_name_impl(entity, child_name, recursive);
+	}
+
+	Entity Service::get_child_by_name_impl(Entity entity, std::string_view child_name, bool recursive) const
+	{
 		const auto* relationship = registry.try_get<RelationshipComponent>(entity);
 
 		if (!relationship)
@@ -561,7 +831,7 @@ namespace engine
 			
 				if (recursive)
 				{
-					if (auto r_out = get_child_by_name(child, child_name, true); r_out != null)
+					if (auto r_out = get_child_by_name_impl(child, child_name, true); r_out != null)
 					{
 						out = r_out;
 
@@ -617,6 +887,86 @@ namespace engine
 		return forwarding_event_handler;
 	}
 
+#if GLARE_ENGINE_EVENT_PROFILING
+	EventProfiler& Service::get_event_profiler()
+	{
+		return event_profiler;
+	}
+
+	const EventProfiler& Service::get_event_profiler() const
+	{
+		return event_profiler;
+	}
+#endif
+
+	void Service::set_event_recorder(EventLogRecorder* recorder)
+	{
+		if (recorder == event_recorder)
+		{
+			return;
+		}
+
+		if (!event_recorder)
+		{
+			set_input_event_recording(true);
+		}
+		else if (!recorder)
+		{
+			set_input_event_recording(false);
+		}
+
+		event_recorder = recorder;
+	}
+
+	EventLogRecorder* Service::get_event_recorder() const
+	{
+		return event_recorder;
+	}
+
+	void Service::set_event_replay_mode(bool enabled)
+	{
+		replaying_events = enabled;
+	}
+
+	bool Service::is_event_replay_mode() const
+	{
+		return replaying_events;
+	}
+
+	void Service::set_input_event_recording(bool enabled)
+	{
+		auto update_connection = [this, enabled]<typename EventType>()
+		{
+			auto sink = standard_event_handler.sink<EventType>();
+
+			if (enabled)
+			{
+				sink.template connect<&Service::record_input_event<EventType>>(*this);
+			}
+			else
+			{
+				sink.template disconnect<&Service::record_input_event<EventType>>(*this);
+			}
+		};
+
+		update_connection.template operator()<app::input::OnMouseButtonDown>();
+		update_connection.template operator()<app::input::OnMouseButtonUp>();
+		update_connection.template operator()<app::input::OnMouseMove>();
+		update_connection.template operator()<app::input::OnMouseScroll>();
+		update_connection.template operator()<app::input::OnMousePosition>();
+		update_connection.template operator()<app::input::OnMouseVirtualAnalogInput>();
+
+		update_connection.template operator()<app::input::OnKeyboardButtonDown>();
+		update_connection.template operator()<app::input::OnKeyboardButtonUp>();
+		update_connection.template operator()<app::input::OnKeyboardAnalogInput>();
+
+		update_connection.template operator()<app::input::OnGamepadConnected>();
+		update_connection.template operator()<app::input::OnGamepadDisconnected>();
+		update_connection.template operator()<app::input::OnGamepadButtonDown>();
+		update_connection.template operator()<app::input::OnGamepadButtonUp>();
+		update_connection.template operator()<app::input::OnGamepadAnalogInput>();
+	}
+
 	// Retrieves a non-owning pointer to an internal `UniversalVariables` object.
 	// If a `UniversalVariables` object does not already exist for this service, this will return `nullptr`.
 	Service::UniversalVariables* Service::peek_universal_variables() const
@@ -657,39 +1007,53 @@ namespace engine
 
 	void Service::enqueue_timed_event(TimedEvent&& timed_event)
 	{
-		// If the event's timer isn't already active, start it.
-		timed_event.delay.activate();
-
-		pending_timed_events.emplace_back(std::move(timed_event));
+		pending_timed_events.push(std::move(timed_event));
 	}
 
-	// TODO: Look into whether sorting the `pending_timed_events` collection would improve performance.
 	void Service::update_timed_events()
 	{
-		pending_timed_events.erase
+		// NOTE: Released events are root events, and are recorded as such. (See `set_event_recorder`)
+		pending_timed_events.update
 		(
-			std::remove_if
-			(
-				pending_timed_events.begin(),
-				pending_timed_events.end(),
-
-				[this](TimedEvent& timed_event)
+			[this](MetaAny&& event_instance)
+			{
+				if (replaying_events)
 				{
-					using namespace engine::literals;
+					return;
+				}
 
-					if (timed_event.completed())
-					{
-						trigger_opaque_event(std::move(timed_event.event_instance));
+				queue_opaque_event(std::move(event_instance));
+			}
+		);
+	}
 
-						return true;
-					}
+	static std::unordered_map<MetaTypeID, Service::OpaqueEventDispatch>& get_opaque_event_dispatch_table()
+	{
+		static auto opaque_event_dispatch_table = std::unordered_map<MetaTypeID, Service::OpaqueEventDispatch> {};
 
-					return false;
-				}
-			),
+		return opaque_event_dispatch_table;
+	}
 
-			pending_timed_events.end()
-		);
+	void Service::register_opaque_event_dispatch(MetaTypeID type_hash, const OpaqueEventDispatch& dispatch)
+	{
+		get_opaque_event_dispatch_table()[type_hash] = dispatch;
+	}
+
+	const Service::OpaqueEventDispatch* Service::get_opaque_event_dispatch(const MetaType& type)
+	{
+		if (!type)
+		{
+			return nullptr;
+		}
+
+		const auto& opaque_event_dispatch_table = get_opaque_event_dispatch_table();
+
+		if (const auto it = opaque_event_dispatch_table.find(type.info().hash()); it != opaque_event_dispatch_table.end())
+		{
+			return &(it->second);
+		}
+
+		return nullptr;
 	}
 
 	bool Service::trigger_opaque_event(MetaAny&& event_instance)
@@ -705,6 +1069,18 @@ namespace engine
 			return false;
 		}
 
+		if (const auto dispatch = get_opaque_event_dispatch(type); (dispatch) && (dispatch->trigger))
+		{
+			if (dispatch->trigger(*this, std::move(event_instance)))
+			{
+				return true;
+			}
+
+			print_warn("Failed to trigger event type: #{}", type.id());
+
+			return false;
+		}
+
 		auto trigger_fn = type.func("trigger_event_from_meta_any"_hs);
 
 		if (!trigger_fn)
@@ -730,4 +1106,31 @@ namespace engine
 
 		return true;
 	}
+
+	bool Service::queue_opaque_event(MetaAny&& event_instance)
+	{
+		auto type = event_instance.type();
+
+		if (!type)
+		{
+			print_warn("Unable to resolve type of queued event.");
+
+			return false;
+		}
+
+		if (const auto dispatch = get_opaque_event_dispatch(type); (dispatch) && (dispatch->queue))
+		{
+			if (dispatch->queue(*this, std::move(event_instance)))
+			{
+				return true;
+			}
+
+			print_warn("Failed to queue event type: #{}", type.id());
+
+			return false;
+		}
+
+		// No queueing behavior available for this type; trigger immediately instead.
+		return trigger_opaque_event(std::move(event_instance));
+	}
 }
\ No newline at end of file
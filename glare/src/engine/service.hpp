@@ -7,7 +7,12 @@
 #include "system_manager_interface.hpp"
 #include "service_events.hpp"
 #include "timed_event.hpp"
+#include "timed_event_queue.hpp"
+#include "name_index.hpp"
 #include "timer.hpp"
+#include "event_profiler.hpp"
+#include "event_log.hpp"
+#include "service_command_buffer.hpp"
 #include "command.hpp"
 
 #include "event_handler.hpp"
@@ -20,6 +25,8 @@
 #include <app/types.hpp>
 
 #include <util/small_vector.hpp>
+#include <util/mpsc_queue.hpp>
+#include <util/frame_arena.hpp>
 
 //#include <entt/signal/fwd.hpp>
 
@@ -30,7 +37,9 @@
 #include <optional>
 #include <memory>
 #include <string>
-//#include <vector>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
 
 // Debugging related:
 //#include <util/log.hpp>
@@ -66,6 +75,32 @@ namespace engine
 			using EventHandler = entt::dispatcher;
 
 			using OpaqueFunction = std::function<void()>;
+
+			// Type-erased event submission, executed on the thread owning this service.
+			// (See `submit_event`)
+			using EventSubmission = std::move_only_function<void(Service&)>;
+
+			// Pre-resolved dispatch entry for opaque (`MetaAny`) events of a specific type.
+			// 
+			// Entries are registered once per type during reflection, allowing opaque events
+			// to be triggered or queued without looking up and invoking reflected functions.
+			struct OpaqueEventDispatch
+			{
+				using Callback = bool(*)(Service&, MetaAny&&);
+
+				Callback trigger = nullptr;
+				Callback queue   = nullptr;
+			};
+
+			// Registers (or replaces) the opaque dispatch entry for the type identified by `type_hash`.
+			// 
+			// NOTE: `type_hash` must be the `entt::type_hash` value for the event type, not a reflected type ID.
+			// 
+			// This is not thread-safe, and should only be called during reflection.
+			static void register_opaque_event_dispatch(MetaTypeID type_hash, const OpaqueEventDispatch& dispatch);
+
+			// Retrieves the opaque dispatch entry for `type`, if one has been registered.
+			static const OpaqueEventDispatch* get_opaque_event_dispatch(const MetaType& type);
 			using UniversalVariables = EntityVariables<8>;
 
 			Service
@@ -192,18 +227,43 @@ namespace engine
 			template <typename EventType, typename... Args>
 			inline void queue_event(Args&&... args)
 			{
+				if (auto command_buffer = thread_command_buffer) [[unlikely]]
+				{
+					command_buffer->emplace
+					(
+						[event_obj=EventType { std::forward<Args>(args)... }](Service& service) mutable
+						{
+							service.queue_event<EventType>(std::move(event_obj));
+						}
+					);
+
+					return;
+				}
+
 				if constexpr (std::is_same_v<std::decay_t<EventType>, TimedEvent>)
 				{
 					enqueue_timed_event(TimedEvent { std::forward<Args>(args)... });
 				}
 				else if constexpr (std::is_base_of_v<ServiceOriginatedEvent, std::decay_t<EventType>>)
 				{
+					profile_enqueue<EventType>();
+
 					service_event_handler.enqueue<EventType>(std::forward<Args>(args)...);
 				}
 				else
 				{
+					if (is_recording_events())
+					{
+						// Recording requires a materialized event object.
+						queue_event<EventType>(EventType { std::forward<Args>(args)... });
+
+						return;
+					}
+
 					on_queue<EventType>(args...);
 
+					profile_enqueue<EventType>();
+
 					active_event_handler->enqueue<EventType>(std::forward<Args>(args)...); // EventType { ... }
 				}
 			}
@@ -211,6 +271,21 @@ namespace engine
 			template <typename EventType>
 			inline void queue_event(EventType&& event_obj)
 			{
+				if (auto command_buffer = thread_command_buffer) [[unlikely]]
+				{
+					using event_type = std::decay_t<EventType>;
+
+					command_buffer->emplace
+					(
+						[event_obj=event_type { std::forward<EventType>(event_obj) }](Service& service) mutable
+						{
+							service.queue_event<event_type>(std::move(event_obj));
+						}
+					);
+
+					return;
+				}
+
 				if constexpr (std::is_same_v<std::decay_t<EventType>, TimedEvent>)
 				{
 					enqueue_timed_event(std::forward<EventType>(event_obj));
@@ -218,17 +293,22 @@ namespace engine
 				// NOTE: This condition is specific to the forwarding-reference overload of `queue_event`.
 				else if constexpr (std::is_same_v<std::decay_t<EventType>, MetaAny>)
 				{
-					// TODO: Look into implementing 'queue' equivalent for opaque events.
-					event<EventType>(std::forward<EventType>(event_obj)); // trigger_opaque_event(std::move(event_obj));
+					queue_opaque_event(std::move(event_obj));
 				}
 				else if constexpr (std::is_base_of_v<ServiceOriginatedEvent, std::decay_t<EventType>>)
 				{
+					profile_enqueue<EventType>();
+
 					service_event_handler.enqueue(std::forward<EventType>(event_obj));
 				}
 				else
 				{
+					record_event(event_obj, true);
+
 					on_queue<EventType>(event_obj);
 
+					profile_enqueue<EventType>();
+
 					active_event_handler->enqueue(std::forward<EventType>(event_obj));
 				}
 			}
@@ -236,25 +316,69 @@ namespace engine
 			template <typename EventType, typename... Args>
 			inline void event(Args&&... args)
 			{
+				if (auto command_buffer = thread_command_buffer) [[unlikely]]
+				{
+					command_buffer->emplace
+					(
+						[event_obj=EventType { std::forward<Args>(args)... }](Service& service) mutable
+						{
+							service.event<EventType>(std::move(event_obj));
+						}
+					);
+
+					return;
+				}
+
 				if constexpr (std::is_same_v<std::decay_t<EventType>, TimedEvent>)
 				{
 					queue_event<EventType, Args...>(std::forward<Args>(args)...);
 				}
 				else if constexpr (std::is_base_of_v<ServiceOriginatedEvent, std::decay_t<EventType>>)
 				{
-					service_event_handler.trigger<EventType>(EventType { std::forward<Args>(args)... });
+					profile_trigger<EventType>
+					(
+						service_event_handler,
+						[&]() { service_event_handler.trigger<EventType>(EventType { std::forward<Args>(args)... }); }
+					);
 				}
 				else
 				{
+					if (is_recording_events())
+					{
+						// Recording requires a materialized event object.
+						event<EventType>(EventType { std::forward<Args>(args)... });
+
+						return;
+					}
+
 					on_trigger<EventType>(args...);
 
-					active_event_handler->trigger<EventType>(EventType { std::forward<Args>(args)... });
+					profile_trigger<EventType>
+					(
+						*active_event_handler,
+						[&]() { active_event_handler->trigger<EventType>(EventType { std::forward<Args>(args)... }); }
+					);
 				}
 			}
 
 			template <typename EventType>
 			inline void event(EventType&& event_obj)
 			{
+				if (auto command_buffer = thread_command_buffer) [[unlikely]]
+				{
+					using event_type = std::decay_t<EventType>;
+
+					command_buffer->emplace
+					(
+						[event_obj=event_type { std::forward<EventType>(event_obj) }](Service& service) mutable
+						{
+							service.event<event_type>(std::move(event_obj));
+						}
+					);
+
+					return;
+				}
+
 				if constexpr (std::is_same_v<std::decay_t<EventType>, TimedEvent>)
 				{
 					//enqueue_timed_event(std::forward<TimedEvent>(event_obj));
@@ -267,16 +391,85 @@ namespace engine
 				}
 				else if constexpr (std::is_base_of_v<ServiceOriginatedEvent, std::decay_t<EventType>>)
 				{
-					service_event_handler.trigger<EventType>(std::forward<EventType>(event_obj));
+					profile_trigger<EventType>
+					(
+						service_event_handler,
+						[&]() { service_event_handler.trigger<EventType>(std::forward<EventType>(event_obj)); }
+					);
 				}
 				else
 				{
+					record_event(event_obj, false);
+
 					on_trigger<EventType>(event_obj);
 
-					active_event_handler->trigger(std::forward<EventType>(event_obj));
+					profile_trigger<EventType>
+					(
+						*active_event_handler,
+						[&]() { active_event_handler->trigger(std::forward<EventType>(event_obj)); }
+					);
 				}
 			}
 
+			// Binds `command_buffer` to the calling thread, returning the previously bound buffer.
+			// 
+			// While a buffer is bound, calls to `event`, `queue_event` and `timed_event` made on that thread
+			// (for any service) are captured by the buffer, rather than dispatched. Captured events are
+			// dispatched once the buffer is flushed by the thread owning the service. (See `ServiceCommandBuffer`)
+			// 
+			// Pass `nullptr` to unbind the current buffer.
+			static ServiceCommandBuffer* set_thread_command_buffer(ServiceCommandBuffer* command_buffer)
+			{
+				return std::exchange(thread_command_buffer, command_buffer);
+			}
+
+			// Retrieves the command buffer bound to the calling thread, if any.
+			static ServiceCommandBuffer* get_thread_command_buffer()
+			{
+				return thread_command_buffer;
+			}
+
+			// Thread-safe equivalent to `queue_event`; may be called from any thread.
+			// 
+			// Submitted events are held in a lock-free queue until the next call to `update`,
+			// where they are forwarded to `queue_event` (in submission order) before standard events are handled.
+			template <typename EventType, typename... Args>
+			inline void submit_event(Args&&... args)
+			{
+				submitted_events.emplace
+				(
+					[event_obj=EventType { std::forward<Args>(args)... }](Service& service) mutable
+					{
+						service.queue_event<EventType>(std::move(event_obj));
+					}
+				);
+			}
+
+			// Thread-safe equivalent to `queue_event`; may be called from any thread.
+			// 
+			// This overload supports opaque (`MetaAny`) and `TimedEvent` objects, as well as regular event types.
+			template <typename EventType>
+			inline void submit_event(EventType&& event_obj)
+			{
+				using event_type = std::decay_t<EventType>;
+
+				submitted_events.emplace
+				(
+					[event_obj=event_type { std::forward<EventType>(event_obj) }](Service& service) mutable
+					{
+						service.queue_event<event_type>(std::move(event_obj));
+					}
+				);
+			}
+
+			// Thread-safe; submits an arbitrary operation to be executed on the
+			// thread owning this service during the next call to `update`.
+			template <typename Callback>
+			inline void submit(Callback&& callback)
+			{
+				submitted_events.emplace(std::forward<Callback>(callback));
+			}
+
 			template <typename EventType, typename... Args>
 			inline void timed_event(Timer timer, Args&&... args)
 			{
@@ -337,8 +530,7 @@ namespace engine
 				}
 				else
 				{
-					// TODO: Look into implementing 'queue' equivalent for opaque events.
-					trigger_opaque_event(std::move(event_instance));
+					queue_event(std::move(event_instance));
 				}
 			}
 
@@ -383,10 +575,33 @@ namespace engine
 			// New API.
 			// 
 			// TODO: Remove/replace `defer`.
+			// 
+			// Callbacks are stored in a per-frame arena, which is reset once
+			// deferred operations have been handled. (See `handle_deferred_operations`)
 			template <typename Callback>
 			void later(Callback&& callback)
 			{
-				deferred_operations.emplace_back(callback);
+				using callback_type = std::decay_t<Callback>;
+
+				auto* instance = frame_arena.construct<callback_type>(std::forward<Callback>(callback));
+
+				deferred_operations.emplace_back
+				(
+					DeferredOperation
+					{
+						instance,
+
+						[](void* instance)
+						{
+							(*static_cast<callback_type*>(instance))();
+						},
+
+						[](void* instance)
+						{
+							static_cast<callback_type*>(instance)->~callback_type();
+						}
+					}
+				);
 			}
 
 			void update(app::Milliseconds time, float delta);
@@ -433,6 +648,16 @@ namespace engine
 			*/
 			bool remove_parent(Entity entity);
 
+			/*
+				Destroys `entity`, along with its children. (See `ServicePolicy::destroy_children_with_parent`)
+
+				While an event is being dispatched, destruction is deferred until the end of
+				the current update, (see `later`) ensuring that the remaining handlers of that
+				event never observe a destroyed entity. Calls made from threads with a bound
+				command buffer are captured by that buffer. (See `set_thread_command_buffer`)
+			*/
+			void destroy_entity(Entity entity);
+
 			// Returns a label for the entity specified.
 			// If no `NameComponent` is associated with the entity, the entity number will be used.
 			std::string label(Entity entity) const;
@@ -452,6 +677,9 @@ namespace engine
 			// NOTE: Multiple entities may share the same name.
 			Entity get_by_name(std::string_view name) const;
 
+			// Retrieves the name index maintained by this service.
+			const NameIndex& get_name_index() const;
+
 			/*
 				Retrieves the first child-entity found with the name specified,
 				regardless of other attributes/components.
@@ -475,6 +703,33 @@ namespace engine
 			// See `get_active_event_handler` for notes on using service-owned event handlers directly.
 			EventHandler& get_forwarding_event_handler();
 
+#if GLARE_ENGINE_EVENT_PROFILING
+			// Retrieves the event profiler for this service.
+			// 
+			// NOTE: Only available when `GLARE_ENGINE_EVENT_PROFILING` is enabled.
+			EventProfiler& get_event_profiler();
+
+			// See non-const overload for details.
+			const EventProfiler& get_event_profiler() const;
+#endif
+
+			// Attaches `recorder` to this service, recording every root event, as well as calls to `update` and `fixed_update`.
+			// (See `EventLogRecorder` for details)
+			//
+			// The recorder is not owned by this service; pass `nullptr` to detach it.
+			//
+			// NOTE: Device-level input events (e.g. `OnMouseButtonDown`) are enqueued with the standard
+			// event handler directly, and are therefore recorded once they are dispatched.
+			void set_event_recorder(EventLogRecorder* recorder);
+
+			EventLogRecorder* get_event_recorder() const;
+
+			// While enabled, timed events are discarded once released, rather than being queued,
+			// since their delivery is already part of the log being replayed. (See `EventLogPlayer`)
+			void set_event_replay_mode(bool enabled);
+
+			bool is_event_replay_mode() const;
+
 			// Retrieves a non-owning pointer to an internal `UniversalVariables` object.
 			// If a `UniversalVariables` object does not already exist for this service, this will return `nullptr`.
 			UniversalVariables* peek_universal_variables() const;
@@ -501,29 +756,127 @@ namespace engine
 				return Command(command_instance);
 			}
 
-			template <typename EventType, typename Callback, typename ...Args>
-			void on_event(Callback&& callback, const Args&... args)
+			// Retrieves the reflected type ID of `CommandType`, caching the result once resolved.
+			template <typename CommandType>
+			static std::optional<MetaTypeID> get_command_type_id()
 			{
-				if constexpr (std::is_base_of_v<Command, EventType>)
-				{
-					std::optional<MetaTypeID> command_id = std::nullopt;
+				static std::optional<MetaTypeID> command_id = std::nullopt;
 
-					if (auto type = entt::resolve<EventType>())
+				// NOTE: Failed resolutions are not cached, since reflection may not be complete yet.
+				if (!command_id)
+				{
+					if (auto type = entt::resolve<CommandType>())
 					{
 						command_id = type.id();
 					}
+				}
+
+				return command_id;
+			}
+
+			template <typename EventType, typename Callback, typename ...Args>
+			void on_event(Callback&& callback, const Args&... args)
+			{
+				if constexpr (std::is_base_of_v<Command, EventType>)
+				{
+					// NOTE: `OnCommandExecution` is derived from the command itself, and is therefore not a root event.
+					event_dispatch_depth++;
 
 					callback
 					(
 						OnCommandExecution
 						{
 							generalize_command<EventType>(args...),
-							command_id
+							get_command_type_id<EventType>()
 						}
 					);
+
+					event_dispatch_depth--;
 				}
 			}
 
+			// NOTE: The profiling hooks below are compiled out entirely unless `GLARE_ENGINE_EVENT_PROFILING` is enabled.
+			template <typename EventType>
+			inline void profile_enqueue()
+			{
+#if GLARE_ENGINE_EVENT_PROFILING
+				event_profiler.on_enqueue<std::decay_t<EventType>>();
+#endif
+			}
+
+			template <typename EventType, typename Callback>
+			inline void profile_trigger(EventHandler& event_handler, Callback&& callback)
+			{
+				// NOTE: Dispatch depth is tracked regardless of profiling, since it's used to identify root events. (See `is_recording_events`)
+				event_dispatch_depth++;
+
+#if GLARE_ENGINE_EVENT_PROFILING
+				using event_type = std::decay_t<EventType>;
+
+				const auto start = EventProfiler::Clock::now();
+
+				callback();
+
+				event_profiler.on_trigger<event_type>(start, event_handler.sink<event_type>().size());
+#else
+				callback();
+#endif
+
+				event_dispatch_depth--;
+			}
+
+			// Indicates whether events raised at this point should be written to `event_recorder`.
+			// 
+			// Only root events are recorded, since events raised from within
+			// a handler are produced again during playback. (See `EventLogRecorder`)
+			inline bool is_recording_events() const
+			{
+				return ((event_recorder) && (event_dispatch_depth == 0));
+			}
+
+			template <typename EventType>
+			inline void record_event(const EventType& event_obj, bool is_queued)
+			{
+				if (is_recording_events())
+				{
+					event_recorder->record_event(entt::forward_as_meta(event_obj), is_queued);
+				}
+			}
+
+			// Records input events enqueued directly with the standard event handler by input devices.
+			// (See `set_input_event_recording`)
+			// 
+			// NOTE: During playback, input events are re-raised through `queue_event`, where they are already recorded.
+			template <typename EventType>
+			void record_input_event(const EventType& event_obj)
+			{
+				if ((event_recorder) && (!replaying_events))
+				{
+					event_recorder->record_event(entt::forward_as_meta(event_obj), true);
+				}
+			}
+
+			// Connects or disconnects `record_input_event` for each device-level input event type.
+			void set_input_event_recording(bool enabled);
+
+			// Executes `event_handler.update()`, recording the time taken under `pass_name` when profiling is enabled.
+			inline void update_event_handler(EventHandler& event_handler, [[maybe_unused]] std::string_view pass_name)
+			{
+				event_dispatch_depth++;
+
+#if GLARE_ENGINE_EVENT_PROFILING
+				const auto start = EventProfiler::Clock::now();
+
+				event_handler.update();
+
+				event_profiler.on_pass(pass_name, start);
+#else
+				event_handler.update();
+#endif
+
+				event_dispatch_depth--;
+			}
+
 			template <typename EventType, typename ...Args>
 			void on_queue(const Args&... args)
 			{
@@ -567,6 +920,21 @@ namespace engine
 			void on_component_replace(ComponentReplaceCommand& component_replace);
 
 			void on_set_parent(const SetParentCommand& parent_command);
+
+			void apply_direct_component_patch(Entity entity, const MetaAny& component, bool use_member_assignment);
+			void apply_component_replace(Entity entity, MetaAny& component);
+
+			// Stages a direct patch or replacement for coalescing. (See `ServicePolicy::coalesce_component_patches`)
+			void stage_component_write(Entity entity, MetaAny&& component, bool is_replacement, bool use_member_assignment);
+
+			// Applies the staged write for `entity` and `component_type_id` immediately, if one exists.
+			void apply_staged_component_write(Entity entity, MetaTypeID component_type_id);
+
+			// Applies all staged component writes, in the order they were first staged.
+			void apply_staged_component_writes();
+
+			// Enumerates the hierarchy of `entity` directly. (See `get_child_by_name`)
+			Entity get_child_by_name_impl(Entity entity, std::string_view child_name, bool recursive) const;
 		protected:
 			void opaque_function_handler(const FunctionCommand& function_command);
 			void opaque_expression_handler(const ExprCommand& expr_command);
@@ -576,13 +944,21 @@ namespace engine
 			virtual void on_function_command(const FunctionCommand& function_command);
 			virtual void on_expression_command(const ExprCommand& expr_command);
 
+			// Executes and destroys all operations queued via `later`, then resets `frame_arena`.
 			void handle_deferred_operations();
 
+			// Forwards events submitted from other threads to `queue_event`.
+			// (See `submit_event`)
+			void handle_submitted_events();
+
 			Registry& registry; // std::reference_wrapper<Registry>
 			SystemManagerInterface& systems;
 
 			Entity root = null;
 
+			// Hashed index of named entities. (See `get_by_name`, `get_child_by_name`)
+			NameIndex name_index;
+
 			std::shared_ptr<UniversalVariables> universal_variables;
 
 			ServicePolicy policy;
@@ -610,6 +986,15 @@ namespace engine
 			// The return-value of this method indicates success.
 			bool trigger_opaque_event(MetaAny&& event_instance);
 
+			// Enqueues the underlying object in `event_instance` with the active event handler,
+			// allowing it to be dispatched alongside other events of the same type.
+			// 
+			// If the type of `event_instance` has no registered `OpaqueEventDispatch` entry,
+			// this will fall back to triggering the event immediately.
+			// 
+			// The return-value of this method indicates success.
+			bool queue_opaque_event(MetaAny&& event_instance);
+
 			// A pointer to the active event handler object.
 			// (One of the two found below)
 			EventHandler* active_event_handler;
@@ -624,7 +1009,59 @@ namespace engine
 			// (Prevents conflicts during service operations)
 			EventHandler service_event_handler;
 
-			util::small_vector<TimedEvent, 8> pending_timed_events;
-			util::small_vector<OpaqueFunction, 8> deferred_operations;
+			// Deadline-ordered queue of pending timed events. (See `update_timed_events`)
+			TimedEventQueue pending_timed_events;
+
+			// Type-erased callback stored in `frame_arena`. (See `later`)
+			struct DeferredOperation
+			{
+				void* instance = nullptr;
+
+				void(*execute)(void*) = nullptr;
+				void(*destroy)(void*) = nullptr;
+			};
+
+			// Bump allocator for data that only needs to live until the end of the current frame.
+			util::frame_arena frame_arena;
+
+			util::small_vector<DeferredOperation, 8> deferred_operations;
+
+			// A direct component patch or replacement awaiting application. (See `stage_component_write`)
+			struct StagedComponentWrite
+			{
+				Entity entity = null;
+
+				MetaAny component;
+
+				bool is_replacement        : 1 = false;
+				bool use_member_assignment : 1 = false;
+			};
+
+			// Staged component writes, in the order they were first staged.
+			std::vector<StagedComponentWrite> staged_component_writes;
+
+			// Maps (entity, component-type) keys to indices in `staged_component_writes`.
+			std::unordered_map<std::uint64_t, std::size_t> staged_component_write_indices;
+
+#if GLARE_ENGINE_EVENT_PROFILING
+			// Per-event-type dispatch statistics. (See `get_event_profiler`)
+			EventProfiler event_profiler;
+#endif
+
+			// Optional destination for root events. (See `set_event_recorder`)
+			EventLogRecorder* event_recorder = nullptr;
+
+			// Number of event triggers, dispatch passes and deferred operations currently executing.
+			// (Used to distinguish root events from those raised by handlers)
+			std::size_t event_dispatch_depth = 0;
+
+			// See `set_event_replay_mode`.
+			bool replaying_events = false;
+
+			// Lock-free queue of events submitted from any thread. (See `submit_event`)
+			util::mpsc_queue<EventSubmission> submitted_events;
+
+			// See `set_thread_command_buffer`.
+			static inline thread_local ServiceCommandBuffer* thread_command_buffer = nullptr;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <vector>
+#include <functional>
+#include <utility>
+#include <cstddef>
+
+namespace engine
+{
+	class Service;
+
+	// An ordered buffer of deferred `Service` operations.
+	//
+	// While bound to a thread (see `Service::set_thread_command_buffer`), events raised on that
+	// thread are captured here, rather than being dispatched. The captured operations are then
+	// executed in their original order by calling `flush` from the thread owning the service.
+	class ServiceCommandBuffer
+	{
+		public:
+			using Operation = std::move_only_function<void(Service&)>;
+
+			ServiceCommandBuffer() = default;
+
+			ServiceCommandBuffer(const ServiceCommandBuffer&) = delete;
+			ServiceCommandBuffer(ServiceCommandBuffer&&) noexcept = default;
+
+			ServiceCommandBuffer& operator=(const ServiceCommandBuffer&) = delete;
+			ServiceCommandBuffer& operator=(ServiceCommandBuffer&&) noexcept = default;
+
+			template <typename Callback>
+			void emplace(Callback&& callback)
+			{
+				operations.emplace_back(std::forward<Callback>(callback));
+			}
+
+			// Executes each captured operation in order, then clears this buffer.
+			//
+			// NOTE: Operations captured during a flush (e.g. due to rebinding this
+			// buffer to the current thread) are executed as part of the same flush.
+			//
+			// The return-value of this function is the number of operations executed.
+			std::size_t flush(Service& service)
+			{
+				// NOTE: Indexed iteration, since operations may capture additional operations.
+				std::size_t operation_index = 0;
+
+				for (; operation_index < operations.size(); operation_index++)
+				{
+					auto operation = std::move(operations[operation_index]);
+
+					operation(service);
+				}
+
+				operations.clear();
+
+				return operation_index;
+			}
+
+			// Discards all captured operations without executing them.
+			void clear()
+			{
+				operations.clear();
+			}
+
+			std::size_t size() const
+			{
+				return operations.size();
+			}
+
+			bool empty() const
+			{
+				return operations.empty();
+			}
+		protected:
+			std::vector<Operation> operations;
+	};
+}
@@ -5,5 +5,12 @@ namespace engine
 	struct ServicePolicy
 	{
 		bool destroy_children_with_parent : 1 = true;
+
+		// If enabled, direct component patches and replacements targeting the same
+		// (entity, component-type) pair are merged, then applied once per update.
+		// 
+		// NOTE: Coalesced writes are not visible until they are applied, and
+		// component update signals are only emitted for the final write.
+		bool coalesce_component_patches : 1 = false;
 	};
 }
\ No newline at end of file
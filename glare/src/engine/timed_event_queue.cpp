@@ -0,0 +1,52 @@
+#include "timed_event_queue.hpp"
+
+namespace engine
+{
+	void TimedEventQueue::push(TimedEvent&& timed_event)
+	{
+		// If the event's timer isn't already active, start it.
+		timed_event.delay.activate();
+
+		const auto deadline = timed_event.delay.get_projected_end_point().value_or(Clock::now());
+
+		entries.emplace_back
+		(
+			Entry
+			{
+				deadline,
+				next_sequence++,
+				std::move(timed_event)
+			}
+		);
+
+		std::push_heap(entries.begin(), entries.end(), EntryOrder {});
+	}
+
+	std::optional<TimedEventQueue::TimePoint> TimedEventQueue::next_deadline() const
+	{
+		if (entries.empty())
+		{
+			return std::nullopt;
+		}
+
+		return entries.front().deadline;
+	}
+
+	void TimedEventQueue::clear()
+	{
+		entries.clear();
+		due_events.clear();
+
+		next_sequence = {};
+	}
+
+	std::size_t TimedEventQueue::size() const
+	{
+		return entries.size();
+	}
+
+	bool TimedEventQueue::empty() const
+	{
+		return entries.empty();
+	}
+}
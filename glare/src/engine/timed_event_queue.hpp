@@ -0,0 +1,126 @@
+#pragma once
+
+#include "timed_event.hpp"
+#include "timer.hpp"
+
+#include <util/small_vector.hpp>
+
+#include <vector>
+#include <algorithm>
+#include <optional>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+namespace engine
+{
+	// Deadline-ordered storage for pending `TimedEvent` objects.
+	//
+	// Events are held in a binary min-heap keyed on their projected end-point,
+	// meaning that each call to `update` only touches events that are actually due.
+	//
+	// Events sharing the same deadline are released in the order they were pushed. (FIFO)
+	class TimedEventQueue
+	{
+		public:
+			using Clock     = Timer::Clock;
+			using TimePoint = Timer::TimePoint;
+			using Sequence  = std::uint64_t;
+
+			TimedEventQueue() = default;
+
+			TimedEventQueue(const TimedEventQueue&) = delete;
+			TimedEventQueue(TimedEventQueue&&) noexcept = default;
+
+			TimedEventQueue& operator=(const TimedEventQueue&) = delete;
+			TimedEventQueue& operator=(TimedEventQueue&&) noexcept = default;
+
+			// Adds `timed_event` to this queue.
+			//
+			// If the event's timer isn't already active, it will be started.
+			void push(TimedEvent&& timed_event);
+
+			// Releases every event whose deadline is at or before `now`, executing
+			// `callback` with an rvalue-reference to each event's `MetaAny` instance.
+			//
+			// Due events are extracted before any callback is executed, so it is safe
+			// for `callback` to push new events. (Those events will be handled on a later call)
+			//
+			// The return-value of this function is the number of events released.
+			template <typename Callback>
+			std::size_t update(TimePoint now, Callback&& callback)
+			{
+				while ((!entries.empty()) && (entries.front().deadline <= now))
+				{
+					std::pop_heap(entries.begin(), entries.end(), EntryOrder {});
+
+					due_events.emplace_back(std::move(entries.back().timed_event));
+
+					entries.pop_back();
+				}
+
+				const auto released = due_events.size();
+
+				if (released == 0)
+				{
+					return 0;
+				}
+
+				for (auto& timed_event : due_events)
+				{
+					callback(std::move(timed_event.event_instance));
+				}
+
+				due_events.clear();
+
+				return released;
+			}
+
+			// Equivalent to calling `update` with the current point in time.
+			template <typename Callback>
+			std::size_t update(Callback&& callback)
+			{
+				return update(Clock::now(), std::forward<Callback>(callback));
+			}
+
+			// Retrieves the earliest deadline currently pending, if any.
+			std::optional<TimePoint> next_deadline() const;
+
+			// Removes all pending events without triggering them.
+			void clear();
+
+			std::size_t size() const;
+			bool empty() const;
+		protected:
+			struct Entry
+			{
+				TimePoint deadline;
+				Sequence sequence;
+
+				TimedEvent timed_event;
+			};
+
+			// Heap comparator; inverted to produce a min-heap on (deadline, sequence).
+			struct EntryOrder
+			{
+				inline bool operator()(const Entry& lhs, const Entry& rhs) const
+				{
+					if (lhs.deadline == rhs.deadline)
+					{
+						return (lhs.sequence > rhs.sequence);
+					}
+
+					return (lhs.deadline > rhs.deadline);
+				}
+			};
+
+			// Binary heap of pending events. (See `EntryOrder`)
+			std::vector<Entry> entries;
+
+			// Scratch buffer of events released during `update`.
+			util::small_vector<TimedEvent, 8> due_events;
+
+			// Monotonic counter used to preserve FIFO ordering between identical deadlines.
+			Sequence next_sequence = {};
+	};
+}
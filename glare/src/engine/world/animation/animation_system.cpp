@@ -12,6 +12,7 @@
 
 #include <engine/entity/entity_descriptor.hpp>
 #include <engine/entity/components/instance_component.hpp>
+#include <engine/entity/components/pooled_entity_component.hpp>
 
 #include <engine/components/relationship_component.hpp>
 #include <engine/components/forwarding_component.hpp>
@@ -57,7 +58,7 @@ namespace engine
 	{
 		auto& registry = world.get_registry();
 
-		registry.view<AnimationComponent>().each
+		registry.view<AnimationComponent>(entt::exclude<PooledEntityComponent>).each
 		(
 			[&](Entity entity, AnimationComponent& animation)
 			{
@@ -93,7 +94,7 @@ namespace engine
 
 		auto bones_updated = std::size_t {};
 
-		registry.view<RelationshipComponent, TransformComponent, AnimationComponent, SkeletalPoseComponent>().each
+		registry.view<RelationshipComponent, TransformComponent, AnimationComponent, SkeletalPoseComponent>(entt::exclude<PooledEntityComponent>).each
 		(
 			[&](Entity entity, RelationshipComponent& relationship, TransformComponent& transform_component, AnimationComponent& animation, SkeletalPoseComponent& skeletal_component)
 			{
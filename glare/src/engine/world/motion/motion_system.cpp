@@ -23,6 +23,7 @@
 #include <engine/transform.hpp>
 #include <engine/components/transform_component.hpp>
 #include <engine/components/relationship_component.hpp>
+#include <engine/entity/components/pooled_entity_component.hpp>
 //#include <engine/components/transform_history_component.hpp>
 
 #include <engine/world/world.hpp>
@@ -35,10 +36,12 @@
 namespace engine
 {
 	// Utility function that enumerates entities with a fully qualified `Transform` object.
+	// 
+	// NOTE: Inactive (pooled) instances are always excluded. (See `PooledEntityComponent`)
 	template <typename ...ComponentTypes, typename Callable, typename ...Exclude>
 	static void update_transform(Registry& registry, Callable callback, entt::exclude_t<Exclude>... exclude)
 	{
-		registry.view<RelationshipComponent, TransformComponent, ComponentTypes...>(exclude...).each([&](auto entity, auto& rel_comp, auto& tform_comp, ComponentTypes&... comps)
+		registry.view<RelationshipComponent, TransformComponent, ComponentTypes...>(entt::exclude<PooledEntityComponent, Exclude...>).each([&](auto entity, auto& rel_comp, auto& tform_comp, ComponentTypes&... comps)
 		{
 			auto transform = Transform(registry, entity, rel_comp, tform_comp);
 
@@ -237,7 +237,7 @@ namespace engine
 	template <>
 	void reflect<OnAirToGround>()
 	{
-		engine_meta_type<OnAirToGround>()
+		engine_event_type<OnAirToGround>()
 			.data<&OnAirToGround::surface>("surface"_hs)
 			.data<nullptr, &OnAirToGround::landing_vector>("landing_vector"_hs)
 			.data<nullptr, &OnAirToGround::ground>("ground"_hs)
@@ -250,7 +250,7 @@ namespace engine
 	template <>
 	void reflect<OnGroundToAir>()
 	{
-		engine_meta_type<OnGroundToAir>()
+		engine_event_type<OnGroundToAir>()
 			.data<&OnGroundToAir::surface>("surface"_hs)
 			.data<&OnGroundToAir::entity_position>("entity_position"_hs)
 			.data<&OnGroundToAir::escape_vector>("escape_vector"_hs)
@@ -268,7 +268,7 @@ namespace engine
 	template <>
 	void reflect<OnMotionAttachment>()
 	{
-		engine_meta_type<OnMotionAttachment>()
+		engine_event_type<OnMotionAttachment>()
 			.data<&OnMotionAttachment::attached_to>("attached_to"_hs)
 			.ctor<decltype(OnMotionAttachment::entity), decltype(OnMotionAttachment::attached_to)>()
 		;
@@ -277,7 +277,7 @@ namespace engine
 	template <>
 	void reflect<OnMotionDetachment>()
 	{
-		engine_meta_type<OnMotionDetachment>()
+		engine_event_type<OnMotionDetachment>()
 			.data<&OnMotionDetachment::detached_from>("detached_from"_hs)
 			.ctor<decltype(OnMotionDetachment::entity), decltype(OnMotionDetachment::detached_from)>()
 		;
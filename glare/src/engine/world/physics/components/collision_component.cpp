@@ -316,6 +316,86 @@ namespace engine
 		return true;
 	}
 
+	bool CollisionComponent::suspend()
+	{
+		auto* collision = get_collision_object();
+
+		if (!collision)
+		{
+			return false;
+		}
+
+		if (!suspended_activation_state)
+		{
+			suspended_activation_state = collision->getActivationState();
+		}
+
+		collision->forceActivationState(DISABLE_SIMULATION);
+
+		// Exclude this object from new broadphase pairs.
+		// NOTE: Existing pairs are removed by the physics system. (See `PhysicsSystem::on_collider_pooled`)
+		if (auto* broadphase_handle = collision->getBroadphaseHandle())
+		{
+			broadphase_handle->m_collisionFilterGroup = 0;
+			broadphase_handle->m_collisionFilterMask = 0;
+		}
+
+		return true;
+	}
+
+	bool CollisionComponent::resume()
+	{
+		auto* collision = get_collision_object();
+
+		if (!collision)
+		{
+			return false;
+		}
+
+		if (auto* broadphase_handle = collision->getBroadphaseHandle())
+		{
+			broadphase_handle->m_collisionFilterGroup = static_cast<int>(get_group());
+			broadphase_handle->m_collisionFilterMask = static_cast<int>(get_full_mask());
+		}
+
+		if (auto* rigid_body = btRigidBody::upcast(collision))
+		{
+			rigid_body->setLinearVelocity({ 0.0f, 0.0f, 0.0f });
+			rigid_body->setAngularVelocity({ 0.0f, 0.0f, 0.0f });
+			rigid_body->clearForces();
+		}
+
+		const auto previous_activation_state = suspended_activation_state.value_or(ACTIVE_TAG);
+
+		suspended_activation_state = std::nullopt;
+
+		switch (previous_activation_state)
+		{
+			// Kinematic objects are never deactivated. (See `apply_collision_flags`)
+			case DISABLE_DEACTIVATION:
+			// Objects deactivated prior to suspension remain deactivated.
+			case DISABLE_SIMULATION:
+				collision->forceActivationState(previous_activation_state);
+
+				break;
+
+			default:
+				if (is_kinematic())
+				{
+					collision->forceActivationState(DISABLE_DEACTIVATION);
+				}
+				else
+				{
+					collision->forceActivationState(ACTIVE_TAG);
+					collision->activate(true);
+				}
+
+				break;
+		}
+
+		return true;
+	}
+
 	bool CollisionComponent::is_active() const
 	{
 		auto* collision = get_collision_object();
@@ -315,6 +315,18 @@ namespace engine
 			// Returns `true` if deactivation was successful.
 			bool deactivate(bool force=false);
 
+			// Removes the collision object from simulation and broadphase filtering, without releasing it.
+			// This allows the object to be reused later, rather than being rebuilt. (e.g. for pooled entities)
+			// 
+			// Returns `true` if a collision object was suspended.
+			bool suspend();
+
+			// Restores simulation and broadphase filtering after a call to `suspend`.
+			// The activation state prior to suspension is restored, and the velocities and forces of rigid bodies are reset.
+			// 
+			// Returns `true` if a collision object was resumed.
+			bool resume();
+
 			bool is_active() const;
 			bool is_kinematic() const;
 			bool is_dynamic() const;
@@ -374,6 +386,9 @@ namespace engine
 		protected:
 			std::optional<KinematicResolutionConfig> kinematic_resolution;
 
+			// The activation state of the collision object prior to `suspend`, if suspended.
+			std::optional<int> suspended_activation_state;
+
 			std::unique_ptr<CollisionMotionState> motion_state;
 			collision_object_variant_t collision_object;
 			shape_variant_t shape;
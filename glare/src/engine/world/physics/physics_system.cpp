@@ -16,6 +16,7 @@
 #include <engine/world/world_events.hpp>
 
 #include <engine/components/relationship_component.hpp>
+#include <engine/entity/components/pooled_entity_component.hpp>
 #include <engine/transform.hpp>
 
 #include <math/bullet.hpp>
@@ -92,6 +93,7 @@ namespace engine
 		// Core registry events:
 		registry.on_construct<CollisionComponent>().connect<&PhysicsSystem::on_create_collider>(*this);
 		registry.on_destroy<CollisionComponent>().connect<&PhysicsSystem::on_destroy_collider>(*this);
+		registry.on_construct<PooledEntityComponent>().connect<&PhysicsSystem::on_collider_pooled>(*this);
 	}
 
 	// TODO: We need to look at `OnTransformChanged`/`on_transform_change` and how it relates to the collision side of this routine.
@@ -952,6 +954,34 @@ namespace engine
 		collision_world->removeCollisionObject(collision_obj);
 	}
 
+	void PhysicsSystem::on_collider_pooled(Registry& registry, Entity entity)
+	{
+		auto* component = registry.try_get<CollisionComponent>(entity);
+
+		if (!component)
+		{
+			return;
+		}
+
+		auto* collision_obj = component->get_collision_object();
+
+		if (!collision_obj)
+		{
+			return;
+		}
+
+		auto* broadphase_handle = collision_obj->getBroadphaseHandle();
+
+		if (!broadphase_handle)
+		{
+			return;
+		}
+
+		// NOTE: Suspended colliders are already excluded from new pairs, but pairs (and contact manifolds)
+		// established prior to suspension would otherwise continue to produce contacts.
+		broadphase->getOverlappingPairCache()->removeOverlappingPairsContainingProxy(broadphase_handle, collision_dispatcher.get());
+	}
+
 	void PhysicsSystem::update_collision_object(CollisionComponent& col, Transform& transform) // World& world, Entity entity
 	{
 		// TODO: Determine if any addition work needs to be done in this step for other collision-object types. (e.g. `btRigidBody`)
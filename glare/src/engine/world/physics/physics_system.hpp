@@ -76,6 +76,10 @@ namespace engine
 			void on_create_collider(Registry& registry, Entity entity);
 			void on_destroy_collider(Registry& registry, Entity entity); // const CollisionComponent&
 
+			// Removes the overlapping pairs of a collider suspended by `EntityPool::deactivate`.
+			// (See `CollisionComponent::suspend`)
+			void on_collider_pooled(Registry& registry, Entity entity);
+
 			void update_collision_object(CollisionComponent& col, Transform& transform);
 			void update_collision_object(btCollisionObject& obj, Transform& transform);
 
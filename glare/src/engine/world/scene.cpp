@@ -51,6 +51,7 @@
 #include <util/algorithm.hpp>
 
 #include <string>
+#include <vector>
 #include <regex>
 
 namespace engine
@@ -122,11 +123,13 @@ namespace engine
 				else
 				{
 					// Ensure that this is an entity that can take advantage of thread variables.
-					if (registry.try_get<InstanceComponent>(entity))
+					if (const auto instance_comp = registry.try_get<InstanceComponent>(entity))
 					{
 						auto& thread_component = registry.get_or_emplace<EntityThreadComponent>(entity);
 
-						if (auto* global_variables = thread_component.get_global_variables())
+						const auto& descriptor = instance_comp->get_descriptor();
+
+						if (auto* global_variables = thread_component.get_global_variables(descriptor.global_variables))
 						{
 							constexpr auto type_specifier_symbol = std::string_view { ":" };
 
@@ -528,12 +531,49 @@ namespace engine
 		auto& registry = world.get_registry();
 		auto& resource_manager = world.get_resource_manager();
 
-		const auto& config = world.get_config();
-
 		ensure_scene();
 
 		print("Loading objects...");
 
+		auto factory_contexts = std::vector<EntityFactoryContext> {};
+
+		util::json_for_each
+		(
+			data,
+
+			[&](const util::json& obj_cfg)
+			{
+				const auto obj_type = util::get_value<std::string>(obj_cfg, "type", "");
+
+				if (!obj_type.empty())
+				{
+					factory_contexts.emplace_back(get_object_factory_context(obj_cfg, obj_type));
+				}
+			}
+		);
+
+		// Build every factory needed by this scene before instantiating anything.
+		// (Factories are held here, since the resource manager only keeps weak references)
+		const auto preloaded_factories = resource_manager.preload_factories(factory_contexts);
+
+		// Generate inactive instances for archetypes that opt into pooling.
+		resource_manager.prewarm_entity_pools
+		(
+			preloaded_factories,
+
+			{
+				.registry = registry,
+				.resource_manager = resource_manager,
+
+				.parent = null,
+
+				.opt_entity_out = null,
+
+				.opt_service = &world,
+				.opt_system_manager = system_manager
+			}
+		);
+
 		util::json_for_each
 		(
 			data,
@@ -555,49 +595,9 @@ namespace engine
 				{
 					print("Creating object of type \"{}\"...", obj_type);
 
-					auto instance_path = std::filesystem::path {};
-
-					if (auto path_content = util::find_any(obj_cfg, "path", "local_path", "instance_path"); path_content != obj_cfg.end())
-					{
-						const auto user_specified_path = std::filesystem::path { path_content->get<std::string>() };
-
-						instance_path = (root_path / user_specified_path);
-					}
-					else
-					{
-						instance_path = std::filesystem::path { obj_type }; // std::filesystem::path { util::format("{}.json", obj_type) };
-					}
-
-					auto instance_directory = std::filesystem::path {};
-
-					if (auto directory_content = util::find_any(obj_cfg, "directory", "local_directory", "folder", "local_folder", "instance_directory"); directory_content != obj_cfg.end())
-					{
-						const auto user_specified_directory = std::filesystem::path { directory_content->get<std::string>() };
-
-						instance_directory = (root_path / user_specified_directory);
-					}
-					else
-					{
-						instance_directory = root_path;
-					}
-
 					entity = resource_manager.generate_entity
 					(
-						EntityFactoryContext
-						{
-							{
-								.instance_path               = instance_path,
-								.instance_directory          = {}, // <-- Derived from `instance_path`. (see below)
-								.shared_directory            = config.objects.object_path,
-								.service_archetype_root_path = (std::filesystem::path(config.entities.archetype_path) / "world"),
-								.archetype_root_path         = config.entities.archetype_path
-							},
-							
-							instance_directory,
-
-							// Resolve the instance path and directory.
-							true
-						},
+						get_object_factory_context(obj_cfg, obj_type),
 
 						{
 							.registry = registry,
@@ -661,6 +661,53 @@ namespace engine
 		);
 	}
 
+	EntityFactoryContext SceneLoader::get_object_factory_context(const util::json& obj_cfg, const std::string& obj_type) const
+	{
+		const auto& config = world.get_config();
+
+		auto instance_path = std::filesystem::path {};
+
+		if (auto path_content = util::find_any(obj_cfg, "path", "local_path", "instance_path"); path_content != obj_cfg.end())
+		{
+			const auto user_specified_path = std::filesystem::path { path_content->get<std::string>() };
+
+			instance_path = (root_path / user_specified_path);
+		}
+		else
+		{
+			instance_path = std::filesystem::path { obj_type }; // std::filesystem::path { util::format("{}.json", obj_type) };
+		}
+
+		auto instance_directory = std::filesystem::path {};
+
+		if (auto directory_content = util::find_any(obj_cfg, "directory", "local_directory", "folder", "local_folder", "instance_directory"); directory_content != obj_cfg.end())
+		{
+			const auto user_specified_directory = std::filesystem::path { directory_content->get<std::string>() };
+
+			instance_directory = (root_path / user_specified_directory);
+		}
+		else
+		{
+			instance_directory = root_path;
+		}
+
+		return EntityFactoryContext
+		{
+			{
+				.instance_path               = instance_path,
+				.instance_directory          = {}, // <-- Derived from `instance_path`. (see below)
+				.shared_directory            = config.objects.object_path,
+				.service_archetype_root_path = (std::filesystem::path(config.entities.archetype_path) / "world"),
+				.archetype_root_path         = config.entities.archetype_path
+			},
+			
+			instance_directory,
+
+			// Resolve the instance path and directory.
+			true
+		};
+	}
+
 	Entity SceneLoader::entity_reference(std::string_view query) // const
 	{
 		if (auto target = EntityTarget::parse(query))
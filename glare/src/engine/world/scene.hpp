@@ -32,6 +32,8 @@ namespace engine
 	class MetaParsingContext;
 	class SystemManagerInterface;
 
+	struct EntityFactoryContext;
+
 	class SceneLoader
 	{
 		public:
@@ -61,6 +63,9 @@ namespace engine
 
 			Entity entity_reference(std::string_view query); // const
 
+			// Builds the factory context used to instantiate an object of type `obj_type`, described by `obj_cfg`.
+			EntityFactoryContext get_object_factory_context(const util::json& obj_cfg, const std::string& obj_type) const;
+
 			ResourceManager& get_resource_manager() const;
 
 			inline operator Entity() const
@@ -9,6 +9,7 @@
 #include <engine/editor/editor.hpp>
 
 #include <engine/entity/entity_system.hpp>
+#include <engine/entity/archetype_cache.hpp>
 
 #include <engine/world/physics/physics.hpp>
 #include <engine/world/motion/motion.hpp>
@@ -75,6 +76,15 @@ namespace game
 		// Generate reflection data for the `engine` module.
 		engine::reflect_all();
 
+		if (!cfg.entities.use_archetype_cache)
+		{
+			engine::set_archetype_cache_directory({});
+		}
+		else if (!cfg.entities.archetype_cache_path.empty())
+		{
+			engine::set_archetype_cache_directory(cfg.entities.archetype_cache_path);
+		}
+
 		set_input_lock(input_lock_status);
 
 		init_default_systems(delta_mode, (!renderer));
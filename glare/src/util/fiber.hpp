@@ -2,11 +2,13 @@
 
 #include "type_traits.hpp"
 #include "member_traits.hpp"
+#include "fiber_frame_pool.hpp"
 
 #include <coroutine>
 #include <exception>
 #include <utility>
 #include <type_traits>
+#include <cstddef>
 
 #include <cassert>
 
@@ -190,6 +192,17 @@ namespace util
 				}
 
 			public:
+				// Coroutine frames are allocated from `fiber_frame_pool`, rather than the global heap.
+				static void* operator new(std::size_t size)
+				{
+					return fiber_frame_pool::allocate(size);
+				}
+
+				static void operator delete(void* frame, std::size_t size) noexcept
+				{
+					fiber_frame_pool::deallocate(frame, size);
+				}
+
 				fiber<T> get_return_object() noexcept
 				{
 					return { coroutine_handle_t::from_promise(*this) };
@@ -0,0 +1,302 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <new>
+#include <cstddef>
+#include <cstdint>
+
+namespace util
+{
+	// Snapshot of the allocation activity recorded by `fiber_frame_pool`.
+	struct fiber_frame_statistics
+	{
+		using size_type = std::size_t;
+
+		static constexpr size_type SIZE_CLASS_COUNT = 7;
+
+		// The total number of frames allocated and deallocated.
+		size_type allocations   = 0;
+		size_type deallocations = 0;
+
+		// The number of allocations served from a cache, rather than the heap.
+		size_type cache_hits = 0;
+
+		// The number of allocations larger than the largest size class. (Always allocated from the heap)
+		size_type oversized_allocations = 0;
+
+		// The largest frame size requested so far, in bytes.
+		size_type largest_frame = 0;
+
+		// The total number of bytes requested, used to determine the average frame size.
+		size_type total_requested_bytes = 0;
+
+		// The number of allocations made for each size class. (See `fiber_frame_pool::size_classes`)
+		std::array<size_type, SIZE_CLASS_COUNT> size_class_allocations = {};
+
+		inline size_type live_frames() const
+		{
+			return (allocations - deallocations);
+		}
+
+		inline size_type average_frame_size() const
+		{
+			return (allocations) ? (total_requested_bytes / allocations) : 0;
+		}
+	};
+
+	// Size-class pooled allocator for coroutine frames. (See `impl::fiber_promise`)
+	//
+	// Each thread keeps a small cache of free frames for every size class; frames released
+	// beyond a cache's limit are handed to a shared pool, which threads draw from in batches
+	// when their own cache is empty. Frames are never returned to the heap while the program
+	// is running, allowing steady-state coroutine churn to proceed without touching `malloc`.
+	//
+	// Frames may be released on a different thread than the one they were allocated on.
+	class fiber_frame_pool
+	{
+		public:
+			using size_type = std::size_t;
+
+			static constexpr size_type SIZE_CLASS_COUNT = fiber_frame_statistics::SIZE_CLASS_COUNT;
+
+			// Frame sizes served by this pool, in bytes.
+			static constexpr std::array<size_type, SIZE_CLASS_COUNT> size_classes = { 64, 128, 256, 512, 1024, 2048, 4096 };
+
+			// The maximum number of free frames held by each thread, per size class.
+			static constexpr size_type THREAD_CACHE_LIMIT = 64;
+
+			// The number of frames moved between a thread's cache and the shared pool at once.
+			static constexpr size_type TRANSFER_BATCH_SIZE = (THREAD_CACHE_LIMIT / 2);
+
+			static constexpr size_type NO_SIZE_CLASS = SIZE_CLASS_COUNT;
+
+			static constexpr size_type get_size_class(size_type size) noexcept
+			{
+				for (size_type size_class = 0; size_class < SIZE_CLASS_COUNT; size_class++)
+				{
+					if (size <= size_classes[size_class])
+					{
+						return size_class;
+					}
+				}
+
+				return NO_SIZE_CLASS;
+			}
+
+			static void* allocate(size_type size)
+			{
+				auto& stats = get_counters();
+
+				stats.allocations.fetch_add(1, std::memory_order_relaxed);
+				stats.total_requested_bytes.fetch_add(size, std::memory_order_relaxed);
+
+				update_largest_frame(size);
+
+				const auto size_class = get_size_class(size);
+
+				if (size_class == NO_SIZE_CLASS)
+				{
+					stats.oversized_allocations.fetch_add(1, std::memory_order_relaxed);
+
+					return ::operator new(size);
+				}
+
+				stats.size_class_allocations[size_class].fetch_add(1, std::memory_order_relaxed);
+
+				auto& cache = get_thread_cache()[size_class];
+
+				if (cache.empty())
+				{
+					get_shared_pool().acquire(size_class, cache);
+				}
+
+				if (!cache.empty())
+				{
+					auto* frame = cache.back();
+
+					cache.pop_back();
+
+					stats.cache_hits.fetch_add(1, std::memory_order_relaxed);
+
+					return frame;
+				}
+
+				return ::operator new(size_classes[size_class]);
+			}
+
+			static void deallocate(void* frame, size_type size) noexcept
+			{
+				if (!frame)
+				{
+					return;
+				}
+
+				get_counters().deallocations.fetch_add(1, std::memory_order_relaxed);
+
+				const auto size_class = get_size_class(size);
+
+				if (size_class == NO_SIZE_CLASS)
+				{
+					::operator delete(frame);
+
+					return;
+				}
+
+				try
+				{
+					// Frames released after this thread's cache has been destroyed go directly to the shared pool.
+					if (thread_cache_destroyed)
+					{
+						auto single_frame = frame_list { frame };
+
+						get_shared_pool().release(size_class, single_frame, 1);
+
+						return;
+					}
+
+					auto& cache = get_thread_cache()[size_class];
+
+					if (cache.size() >= THREAD_CACHE_LIMIT)
+					{
+						get_shared_pool().release(size_class, cache, TRANSFER_BATCH_SIZE);
+					}
+
+					cache.push_back(frame);
+				}
+				catch (...)
+				{
+					::operator delete(frame);
+				}
+			}
+
+			// Retrieves a snapshot of the allocation activity recorded so far.
+			static fiber_frame_statistics get_statistics()
+			{
+				const auto& stats = get_counters();
+
+				auto snapshot = fiber_frame_statistics
+				{
+					.allocations           = stats.allocations.load(std::memory_order_relaxed),
+					.deallocations         = stats.deallocations.load(std::memory_order_relaxed),
+					.cache_hits            = stats.cache_hits.load(std::memory_order_relaxed),
+					.oversized_allocations = stats.oversized_allocations.load(std::memory_order_relaxed),
+					.largest_frame         = stats.largest_frame.load(std::memory_order_relaxed),
+					.total_requested_bytes = stats.total_requested_bytes.load(std::memory_order_relaxed)
+				};
+
+				for (size_type size_class = 0; size_class < SIZE_CLASS_COUNT; size_class++)
+				{
+					snapshot.size_class_allocations[size_class] = stats.size_class_allocations[size_class].load(std::memory_order_relaxed);
+				}
+
+				return snapshot;
+			}
+
+		private:
+			using frame_list = std::vector<void*>;
+			using frame_lists = std::array<frame_list, SIZE_CLASS_COUNT>;
+
+			struct counters
+			{
+				using counter = std::atomic<size_type>;
+
+				counter allocations           = 0;
+				counter deallocations         = 0;
+				counter cache_hits            = 0;
+				counter oversized_allocations = 0;
+				counter largest_frame         = 0;
+				counter total_requested_bytes = 0;
+
+				std::array<counter, SIZE_CLASS_COUNT> size_class_allocations = {};
+			};
+
+			// Free frames shared between threads.
+			struct shared_pool
+			{
+				std::mutex mutex;
+
+				frame_lists free_frames;
+
+				// Moves up to `TRANSFER_BATCH_SIZE` frames of `size_class` into `cache_out`.
+				void acquire(size_type size_class, frame_list& cache_out)
+				{
+					auto lock = std::scoped_lock { mutex };
+
+					auto& source = free_frames[size_class];
+
+					const auto count = ((source.size() < TRANSFER_BATCH_SIZE) ? source.size() : TRANSFER_BATCH_SIZE);
+
+					cache_out.insert(cache_out.end(), (source.end() - count), source.end());
+
+					source.resize(source.size() - count);
+				}
+
+				// Moves `count` frames of `size_class` from `cache` into this pool.
+				void release(size_type size_class, frame_list& cache, size_type count)
+				{
+					auto lock = std::scoped_lock { mutex };
+
+					auto& destination = free_frames[size_class];
+
+					count = ((cache.size() < count) ? cache.size() : count);
+
+					destination.insert(destination.end(), (cache.end() - count), cache.end());
+
+					cache.resize(cache.size() - count);
+				}
+			};
+
+			// Frames cached by a thread are given to the shared pool when the thread exits.
+			struct thread_cache
+			{
+				frame_lists free_frames;
+
+				~thread_cache()
+				{
+					thread_cache_destroyed = true;
+
+					for (size_type size_class = 0; size_class < SIZE_CLASS_COUNT; size_class++)
+					{
+						get_shared_pool().release(size_class, free_frames[size_class], free_frames[size_class].size());
+					}
+				}
+			};
+
+			// Set once the calling thread's `thread_cache` has been destroyed. (Trivially destructible)
+			inline static thread_local bool thread_cache_destroyed = false;
+
+			static counters& get_counters()
+			{
+				static auto instance = counters {};
+
+				return instance;
+			}
+
+			// NOTE: Intentionally leaked, since frames may be released during static destruction.
+			static shared_pool& get_shared_pool()
+			{
+				static auto* instance = new shared_pool {};
+
+				return *instance;
+			}
+
+			static frame_lists& get_thread_cache()
+			{
+				thread_local auto instance = thread_cache {};
+
+				return instance.free_frames;
+			}
+
+			static void update_largest_frame(size_type size)
+			{
+				auto& largest_frame = get_counters().largest_frame;
+
+				auto current = largest_frame.load(std::memory_order_relaxed);
+
+				while ((size > current) && (!largest_frame.compare_exchange_weak(current, size, std::memory_order_relaxed)));
+			}
+	};
+}
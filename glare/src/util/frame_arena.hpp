@@ -0,0 +1,148 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <utility>
+#include <new>
+#include <cstddef>
+#include <cstdint>
+
+namespace util
+{
+	// Bump allocator intended for short-lived (e.g. per-frame) allocations.
+	// 
+	// Allocations are carved sequentially out of large blocks and are never freed individually.
+	// Calling `reset` rewinds the arena to the beginning of its first block, while retaining
+	// every block previously allocated. Once the arena has grown to fit a typical frame's workload,
+	// subsequent frames allocate without touching the heap.
+	// 
+	// NOTE: `reset` does not run destructors; objects created with `construct`
+	// must be destroyed by the caller beforehand, if required.
+	// 
+	// This type is not thread-safe.
+	class frame_arena
+	{
+		public:
+			using size_type = std::size_t;
+
+			static constexpr size_type DEFAULT_BLOCK_SIZE = (16 * 1024);
+
+			explicit frame_arena(size_type block_size=DEFAULT_BLOCK_SIZE)
+				: block_size(block_size) {}
+
+			frame_arena(const frame_arena&) = delete;
+			frame_arena(frame_arena&&) noexcept = default;
+
+			frame_arena& operator=(const frame_arena&) = delete;
+			frame_arena& operator=(frame_arena&&) noexcept = default;
+
+			// Allocates `size` bytes aligned to `alignment`. (Must be a power of two)
+			void* allocate(size_type size, size_type alignment=alignof(std::max_align_t))
+			{
+				while (current_block < blocks.size())
+				{
+					if (auto ptr = try_allocate_from(blocks[current_block], size, alignment))
+					{
+						return ptr;
+					}
+
+					// Move on to the next (previously allocated) block.
+					current_block++;
+					offset = 0;
+				}
+
+				// Worst-case padding is `alignment - 1` bytes.
+				const auto required_size = (size + alignment - 1);
+
+				blocks.emplace_back
+				(
+					block
+					{
+						std::make_unique<std::byte[]>(((required_size > block_size) ? required_size : block_size)),
+						((required_size > block_size) ? required_size : block_size)
+					}
+				);
+
+				current_block = (blocks.size() - 1);
+				offset = 0;
+
+				return try_allocate_from(blocks[current_block], size, alignment);
+			}
+
+			// Constructs a `T` instance within this arena.
+			template <typename T, typename ...Args>
+			T* construct(Args&&... args)
+			{
+				auto* ptr = allocate(sizeof(T), alignof(T));
+
+				return ::new (ptr) T(std::forward<Args>(args)...);
+			}
+
+			// Rewinds this arena, invalidating every allocation made since the last reset.
+			// Previously allocated blocks are retained for reuse.
+			void reset()
+			{
+				current_block = 0;
+				offset = 0;
+			}
+
+			// Releases all blocks held by this arena.
+			void release()
+			{
+				blocks.clear();
+
+				reset();
+			}
+
+			// The total number of bytes reserved across all blocks.
+			size_type capacity() const
+			{
+				auto total = size_type {};
+
+				for (const auto& b : blocks)
+				{
+					total += b.size;
+				}
+
+				return total;
+			}
+
+			// The number of blocks currently reserved.
+			size_type block_count() const
+			{
+				return blocks.size();
+			}
+		private:
+			struct block
+			{
+				std::unique_ptr<std::byte[]> data;
+
+				size_type size = 0;
+			};
+
+			void* try_allocate_from(block& target_block, size_type size, size_type alignment)
+			{
+				const auto base_address = reinterpret_cast<std::uintptr_t>(target_block.data.get());
+				const auto unaligned_address = (base_address + offset);
+				const auto aligned_address = ((unaligned_address + (alignment - 1)) & ~static_cast<std::uintptr_t>(alignment - 1));
+
+				const auto aligned_offset = static_cast<size_type>(aligned_address - base_address);
+
+				if ((aligned_offset + size) > target_block.size)
+				{
+					return nullptr;
+				}
+
+				offset = (aligned_offset + size);
+
+				return reinterpret_cast<void*>(aligned_address);
+			}
+
+			std::vector<block> blocks;
+
+			size_type block_size = DEFAULT_BLOCK_SIZE;
+
+			size_type current_block = 0;
+			size_type offset = 0;
+	};
+}
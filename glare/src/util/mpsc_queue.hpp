@@ -0,0 +1,146 @@
+#pragma once
+
+#include <atomic>
+#include <utility>
+#include <cstddef>
+
+namespace util
+{
+	// Lock-free, multi-producer/single-consumer queue.
+	// 
+	// Any number of threads may call `push` or `emplace` concurrently, while a single
+	// consumer thread periodically calls `drain` to take ownership of everything submitted so far.
+	// 
+	// Producers link nodes onto an atomic list-head via compare-and-swap.
+	// The consumer detaches the entire list in one atomic exchange, then
+	// reverses it so that elements are visited in submission (FIFO) order.
+	// 
+	// NOTE: Ordering between elements submitted by different threads is determined
+	// by the order in which their respective push operations took effect.
+	template <typename T>
+	class mpsc_queue
+	{
+		public:
+			using value_type = T;
+			using size_type  = std::size_t;
+
+		private:
+			struct node
+			{
+				T value;
+
+				node* next = nullptr;
+			};
+
+			std::atomic<node*> head = nullptr;
+
+			void link(node* n)
+			{
+				auto current_head = head.load(std::memory_order_relaxed);
+
+				do
+				{
+					n->next = current_head;
+				} while (!head.compare_exchange_weak(current_head, n, std::memory_order_release, std::memory_order_relaxed));
+			}
+
+		public:
+			mpsc_queue() = default;
+
+			mpsc_queue(const mpsc_queue&) = delete;
+			mpsc_queue(mpsc_queue&&) noexcept = delete;
+
+			mpsc_queue& operator=(const mpsc_queue&) = delete;
+			mpsc_queue& operator=(mpsc_queue&&) noexcept = delete;
+
+			~mpsc_queue()
+			{
+				clear();
+			}
+
+			// Thread-safe; may be called from any thread.
+			template <typename ...Args>
+			void emplace(Args&&... args)
+			{
+				link(new node { T(std::forward<Args>(args)...) });
+			}
+
+			// Thread-safe; may be called from any thread.
+			void push(const T& value)
+			{
+				emplace(value);
+			}
+
+			// Thread-safe; may be called from any thread.
+			void push(T&& value)
+			{
+				emplace(std::move(value));
+			}
+
+			// Detaches every element submitted so far, executing `callback` with an
+			// rvalue-reference to each element, in submission order.
+			// 
+			// Elements submitted while this function executes (including from `callback`)
+			// are left in the queue for the next call to `drain`.
+			// 
+			// NOTE: Only one thread may call this function at a time.
+			// 
+			// The return-value of this function is the number of elements processed.
+			template <typename Callback>
+			size_type drain(Callback&& callback)
+			{
+				auto* detached = head.exchange(nullptr, std::memory_order_acquire);
+
+				if (!detached)
+				{
+					return 0;
+				}
+
+				// Reverse the detached list to restore submission order.
+				node* ordered = nullptr;
+
+				while (detached)
+				{
+					auto* next = detached->next;
+
+					detached->next = ordered;
+					ordered = detached;
+
+					detached = next;
+				}
+
+				auto count = size_type {};
+
+				while (ordered)
+				{
+					auto* next = ordered->next;
+
+					callback(std::move(ordered->value));
+
+					delete ordered;
+
+					ordered = next;
+
+					count++;
+				}
+
+				return count;
+			}
+
+			// Discards all elements currently submitted.
+			// 
+			// NOTE: Subject to the same single-consumer restriction as `drain`.
+			void clear()
+			{
+				drain([](T&&) {});
+			}
+
+			// Indicates whether any elements are currently awaiting `drain`.
+			// 
+			// NOTE: The result of this function is only a snapshot when producers are active.
+			bool empty() const
+			{
+				return (head.load(std::memory_order_acquire) == nullptr);
+			}
+	};
+}
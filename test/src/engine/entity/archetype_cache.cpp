@@ -0,0 +1,117 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <engine/entity/archetype_cache.hpp>
+
+#include <util/io.hpp>
+
+#include <filesystem>
+#include <string>
+
+namespace engine
+{
+	TEST_CASE("engine::load_archetype_document", "[engine:entity]")
+	{
+		const auto test_directory = (std::filesystem::temp_directory_path() / "glare_archetype_cache_test");
+
+		std::filesystem::remove_all(test_directory);
+		std::filesystem::create_directories(test_directory);
+
+		const auto archetype_path = (test_directory / "archetype.json");
+		const auto cache_directory = (test_directory / "cache");
+		const auto cache_path = get_archetype_cache_path(archetype_path, cache_directory);
+
+		util::save_string(std::string { "{ \"components\": [\"Example\"], // Comment\n \"value\": 10 }" }, archetype_path);
+
+		auto instance = load_archetype_document(archetype_path, cache_directory);
+
+		REQUIRE(instance["value"].get<int>() == 10);
+		REQUIRE(std::filesystem::exists(cache_path));
+
+		SECTION("Cooked archetype matches source")
+		{
+			auto header = ArchetypeCacheHeader {};
+			auto cached_instance = load_archetype_cache(cache_path, &header);
+
+			REQUIRE(cached_instance);
+			REQUIRE((*cached_instance) == instance);
+
+			const auto source_header = ArchetypeCacheHeader::from_source_file(archetype_path);
+
+			REQUIRE(source_header);
+			REQUIRE(header.same_revision(*source_header));
+			REQUIRE(header.source_path == ArchetypeCacheHeader::normalize_source_path(archetype_path));
+		}
+
+		SECTION("Modified source invalidates cooked archetype")
+		{
+			util::save_string(std::string { "{ \"value\": 200 }" }, archetype_path);
+
+			auto updated_instance = load_archetype_document(archetype_path, cache_directory);
+
+			REQUIRE(updated_instance["value"].get<int>() == 200);
+			REQUIRE(!updated_instance.contains("components"));
+
+			auto cached_instance = load_archetype_cache(cache_path);
+
+			REQUIRE(cached_instance);
+			REQUIRE((*cached_instance)["value"].get<int>() == 200);
+		}
+
+		SECTION("Corrupted cooked archetype is ignored")
+		{
+			util::save_string(std::string { "Invalid" }, cache_path);
+
+			REQUIRE(!load_archetype_cache(cache_path));
+			REQUIRE(load_archetype_document(archetype_path, cache_directory)["value"].get<int>() == 10);
+		}
+
+		SECTION("Cooked archetype from another source is ignored")
+		{
+			// Simulates a different source document mapping to the same location, with an identical size and timestamp.
+			auto foreign_header = *ArchetypeCacheHeader::from_source_file(archetype_path);
+
+			foreign_header.source_path = ArchetypeCacheHeader::normalize_source_path(test_directory / "other" / "archetype.json");
+
+			REQUIRE(save_archetype_cache(cache_path, util::json { { "value", 50 } }, foreign_header));
+
+			REQUIRE(load_archetype_document(archetype_path, cache_directory)["value"].get<int>() == 10);
+
+			auto header = ArchetypeCacheHeader {};
+			auto cached_instance = load_archetype_cache(cache_path, &header);
+
+			REQUIRE(cached_instance);
+			REQUIRE((*cached_instance)["value"].get<int>() == 10);
+			REQUIRE(!header.same_source(foreign_header));
+		}
+
+		SECTION("Empty cache directory disables caching")
+		{
+			std::filesystem::remove_all(cache_directory);
+
+			REQUIRE(load_archetype_document(archetype_path, {})["value"].get<int>() == 10);
+			REQUIRE(!std::filesystem::exists(cache_directory));
+		}
+
+		SECTION("Current cache directory is configurable")
+		{
+			const auto previous_cache_directory = get_archetype_cache_directory();
+			const auto configured_cache_directory = (test_directory / "configured");
+
+			set_archetype_cache_directory(configured_cache_directory);
+
+			REQUIRE(load_archetype_document(archetype_path)["value"].get<int>() == 10);
+			REQUIRE(std::filesystem::exists(get_archetype_cache_path(archetype_path, configured_cache_directory)));
+
+			set_archetype_cache_directory({});
+
+			std::filesystem::remove_all(configured_cache_directory);
+
+			REQUIRE(load_archetype_document(archetype_path)["value"].get<int>() == 10);
+			REQUIRE(!std::filesystem::exists(configured_cache_directory));
+
+			set_archetype_cache_directory(previous_cache_directory);
+		}
+
+		std::filesystem::remove_all(test_directory);
+	}
+}
@@ -0,0 +1,545 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "../test_service.hpp"
+
+#include <engine/entity/entity_system.hpp>
+#include <engine/entity/entity_thread.hpp>
+#include <engine/entity/entity_factory_context.hpp>
+#include <engine/entity/entity_construction_context.hpp>
+#include <engine/entity/archetype_cache.hpp>
+#include <engine/entity/entity_descriptor.hpp>
+#include <engine/entity/entity_instruction.hpp>
+#include <engine/entity/entity_target.hpp>
+#include <engine/entity/entity_thread_description.hpp>
+#include <engine/entity/actions/entity_state_transition_action.hpp>
+#include <engine/entity/components/entity_thread_component.hpp>
+#include <engine/entity/components/instance_component.hpp>
+#include <engine/entity/commands/entity_thread_spawn_command.hpp>
+#include <engine/entity/commands/entity_thread_stop_command.hpp>
+#include <engine/entity/commands/entity_thread_resume_command.hpp>
+
+#include <engine/resource_manager/entity_factory_data.hpp>
+
+#include <engine/reflection/reflection.hpp>
+#include <engine/meta/reflect_all.hpp>
+#include <engine/meta/hash.hpp>
+
+#include <util/io.hpp>
+
+#include <filesystem>
+#include <memory>
+#include <string_view>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <string>
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+namespace engine
+{
+	// Records which threads reflected function calls are executed from.
+	struct ParallelCallRecorder
+	{
+		inline static std::thread::id main_thread_id = {};
+
+		inline static std::atomic<std::size_t> calls = 0;
+		inline static std::atomic<std::size_t> worker_calls = 0;
+
+		inline static std::int32_t record()
+		{
+			calls++;
+
+			if (std::this_thread::get_id() != main_thread_id)
+			{
+				worker_calls++;
+			}
+
+			return static_cast<std::int32_t>(calls.load());
+		}
+	};
+
+	template <>
+	void reflect<ParallelCallRecorder>()
+	{
+		engine_meta_type<ParallelCallRecorder>()
+			.func<&ParallelCallRecorder::record>("record"_hs)
+		;
+	}
+
+	TEST_CASE("engine::EntitySystem::set_parallel_thread_execution", "[engine:entity]")
+	{
+		reflect_all();
+		reflect<ParallelCallRecorder>();
+
+		const auto previous_cache_directory = get_archetype_cache_directory();
+
+		set_archetype_cache_directory({});
+
+		const auto test_directory = (std::filesystem::temp_directory_path() / "glare_parallel_threads_test");
+
+		std::filesystem::remove_all(test_directory);
+		std::filesystem::create_directories(test_directory);
+
+		// Every instruction of this thread is a reflected function call.
+		util::save_string
+		(
+			std::string { "{ \"do\": { \"calls\": [\"ParallelCallRecorder::record()\", \"ParallelCallRecorder::record()\", \"ParallelCallRecorder::record()\"] } }" },
+			(test_directory / "calls.json")
+		);
+
+		constexpr std::size_t entity_count = 64;
+		constexpr std::size_t update_count = 5;
+
+		// Progresses the threads of `entity_count` entities, returning the final position of each thread.
+		auto run_threads = [&test_directory](std::size_t worker_count, std::size_t& parallel_thread_update_count)
+		{
+			auto service = TestService {};
+			auto entity_system = EntitySystem { service, service.get_systems(), true };
+
+			// NOTE: A threshold of one entity ensures the parallel path is taken.
+			entity_system.set_parallel_thread_execution(worker_count, 1);
+
+			auto& registry = service.get_registry();
+			auto& resource_manager = service.get_resource_manager();
+
+			const auto factory_context = EntityFactoryContext
+			{
+				{
+					.instance_path      = (test_directory / "calls.json"),
+					.instance_directory = test_directory
+				}
+			};
+
+			const auto entity_context = EntityConstructionContext
+			{
+				.registry         = registry,
+				.resource_manager = resource_manager,
+
+				.opt_service      = &service
+			};
+
+			auto entities = std::vector<Entity> {};
+
+			for (std::size_t i = 0; i < entity_count; i++)
+			{
+				entities.emplace_back(resource_manager.generate_entity(factory_context, entity_context));
+			}
+
+			for (std::size_t update = 0; update < update_count; update++)
+			{
+				service.update({}, 0.0f);
+			}
+
+			auto results = std::vector<std::pair<bool, EntityInstructionIndex>> {};
+
+			for (const auto entity : entities)
+			{
+				const auto& thread_component = registry.get<EntityThreadComponent>(entity);
+
+				REQUIRE(thread_component.threads.size() == 1);
+
+				const auto& thread = thread_component.threads[0];
+
+				results.emplace_back(thread.is_complete, thread.next_instruction);
+			}
+
+			parallel_thread_update_count = entity_system.get_parallel_thread_update_count();
+
+			return results;
+		};
+
+		ParallelCallRecorder::main_thread_id = std::this_thread::get_id();
+
+		ParallelCallRecorder::calls = 0;
+		ParallelCallRecorder::worker_calls = 0;
+
+		std::size_t serial_thread_update_count = 0;
+		std::size_t parallel_thread_update_count = 0;
+
+		const auto serial_results = run_threads(0, serial_thread_update_count);
+
+		REQUIRE(ParallelCallRecorder::calls == (entity_count * 3));
+		REQUIRE(serial_thread_update_count == 0);
+
+		ParallelCallRecorder::calls = 0;
+		ParallelCallRecorder::worker_calls = 0;
+
+		const auto parallel_results = run_threads(4, parallel_thread_update_count);
+
+		SECTION("Function calls are executed serially")
+		{
+			REQUIRE(ParallelCallRecorder::calls == (entity_count * 3));
+			REQUIRE(ParallelCallRecorder::worker_calls == 0);
+
+			// Every instruction of these threads is serial-only.
+			REQUIRE(parallel_thread_update_count == 0);
+		}
+
+		SECTION("Serial-only threads progress as they would without workers")
+		{
+			REQUIRE(parallel_results == serial_results);
+
+			for (const auto& [is_complete, next_instruction] : parallel_results)
+			{
+				REQUIRE(is_complete);
+				REQUIRE(next_instruction == 2);
+			}
+		}
+
+		set_archetype_cache_directory(previous_cache_directory);
+
+		std::filesystem::remove_all(test_directory);
+	}
+
+	// The observable outcome of `run_parallel_eligible_threads` for a single pair of entities.
+	struct ParallelEligibleThreadResult
+	{
+		// Position and status of the actor's thread.
+		EntityInstructionIndex next_instruction = {};
+
+		bool is_paused   : 1 = false;
+		bool is_complete : 1 = false;
+
+		// The state of the actor, after its state transition.
+		std::optional<EntityStateIndex> state_index = std::nullopt;
+
+		// The number of threads held by the actor's partner, after its thread was started and stopped remotely.
+		std::size_t partner_thread_count = 0;
+
+		bool operator==(const ParallelEligibleThreadResult&) const noexcept = default;
+	};
+
+	TEST_CASE("engine::EntitySystem::set_parallel_thread_execution (parallel-eligible threads)", "[engine:entity]")
+	{
+		using namespace instructions;
+
+		reflect_all();
+
+		const auto previous_cache_directory = get_archetype_cache_directory();
+
+		set_archetype_cache_directory({});
+
+		const auto test_directory = (std::filesystem::temp_directory_path() / "glare_parallel_eligible_threads_test");
+
+		std::filesystem::remove_all(test_directory);
+		std::filesystem::create_directories(test_directory);
+
+		util::save_string
+		(
+			std::string { "{ \"states\": { \"idle\": {}, \"active\": {} }, \"default_state\": \"idle\" }" },
+			(test_directory / "actor.json")
+		);
+
+		constexpr std::size_t entity_count = 64;
+		constexpr std::size_t update_count = 10;
+
+		const auto main_thread_id   = hash("main").value();
+		const auto helper_thread_id = hash("helper").value();
+
+		const auto active_state_id = hash("active").value();
+
+		// Progresses the threads of `entity_count` actors, each of which affects a partner entity.
+		auto run_parallel_eligible_threads = [&](std::size_t worker_count, std::size_t& parallel_thread_update_count)
+		{
+			auto service = TestService {};
+			auto entity_system = EntitySystem { service, service.get_systems(), true };
+
+			// NOTE: A threshold of one entity ensures the parallel path is taken.
+			entity_system.set_parallel_thread_execution(worker_count, 1);
+
+			auto& registry = service.get_registry();
+			auto& resource_manager = service.get_resource_manager();
+
+			const auto factory_context = EntityFactoryContext
+			{
+				{
+					.instance_path      = (test_directory / "actor.json"),
+					.instance_directory = test_directory
+				}
+			};
+
+			const auto entity_context = EntityConstructionContext
+			{
+				.registry         = registry,
+				.resource_manager = resource_manager,
+
+				.opt_service      = &service
+			};
+
+			auto actors = std::vector<Entity> {};
+			auto partners = std::vector<Entity> {};
+
+			for (std::size_t i = 0; i < entity_count; i++)
+			{
+				actors.emplace_back(resource_manager.generate_entity(factory_context, entity_context));
+				partners.emplace_back(resource_manager.generate_entity(factory_context, entity_context));
+			}
+
+			// NOTE: Threads are added to the (shared) descriptor directly, rather than being parsed.
+			auto& descriptor = const_cast<EntityDescriptor&>(registry.get<InstanceComponent>(actors[0]).get_descriptor());
+
+			auto add_thread = [&descriptor](EntityThreadID thread_id) -> EntityThreadDescription&
+			{
+				auto& thread = descriptor.shared_storage.allocate<EntityThreadDescription>(EntityThreadCadence::Update);
+
+				thread.thread_id = thread_id;
+
+				return thread;
+			};
+
+			auto pad_thread = [](EntityThreadDescription& thread)
+			{
+				for (std::size_t i = 0; i < 16; i++)
+				{
+					thread.instructions.emplace_back(NoOp {});
+				}
+
+				thread.compile();
+			};
+
+			// Started and stopped remotely by each actor.
+			pad_thread(add_thread(helper_thread_id));
+
+			// NOTE: Each actor's thread refers to its partner as an exact entity,
+			// since exact targets are resolved without evaluating expressions.
+			for (std::size_t i = 0; i < entity_count; i++)
+			{
+				const auto partner_target = EntityTarget::from_entity(partners[i]);
+
+				auto& thread = add_thread(hash("main_" + std::to_string(i)).value());
+
+				thread.instructions.emplace_back(Skip { {}, ControlBlock { 1 } });
+				thread.instructions.emplace_back(NoOp {}); // Skipped.
+				thread.instructions.emplace_back(Start { { partner_target, helper_thread_id } });
+				thread.instructions.emplace_back(NoOp {});
+				thread.instructions.emplace_back(Stop { { partner_target, helper_thread_id } });
+				thread.instructions.emplace_back(EntityStateTransitionAction { active_state_id });
+				thread.instructions.emplace_back(Sleep { {}, std::chrono::hours { 1 } });
+
+				pad_thread(thread);
+
+				// Every instruction of this thread is eligible for parallel execution.
+				for (const auto& bytecode_instruction : thread.bytecode)
+				{
+					REQUIRE(!bytecode_instruction.is_serial_only());
+				}
+
+				service.event<EntityThreadSpawnCommand>(actors[i], actors[i], EntityThreadTarget { thread.thread_id });
+			}
+
+			for (std::size_t update = 0; update < update_count; update++)
+			{
+				service.update({}, 0.0f);
+			}
+
+			auto results = std::vector<ParallelEligibleThreadResult> {};
+
+			for (std::size_t i = 0; i < entity_count; i++)
+			{
+				auto result = ParallelEligibleThreadResult {};
+
+				if (const auto* thread_component = registry.try_get<EntityThreadComponent>(actors[i]))
+				{
+					if (!thread_component->threads.empty())
+					{
+						const auto& thread = thread_component->threads[0];
+
+						result.next_instruction = thread.next_instruction;
+						result.is_paused = thread.is_paused;
+						result.is_complete = thread.is_complete;
+					}
+				}
+
+				result.state_index = entity_system.get_state_index(actors[i]);
+
+				if (const auto* partner_thread_component = registry.try_get<EntityThreadComponent>(partners[i]))
+				{
+					result.partner_thread_count = partner_thread_component->threads.size();
+				}
+
+				results.emplace_back(result);
+			}
+
+			parallel_thread_update_count = entity_system.get_parallel_thread_update_count();
+
+			// Applied in both modes, ensuring that state transitions were executed.
+			REQUIRE(entity_system.get_state_index(actors[0]) == registry.get<InstanceComponent>(actors[0]).get_descriptor().get_state_index(active_state_id));
+
+			return results;
+		};
+
+		std::size_t serial_thread_update_count = 0;
+		std::size_t parallel_thread_update_count = 0;
+
+		const auto serial_results = run_parallel_eligible_threads(0, serial_thread_update_count);
+		const auto parallel_results = run_parallel_eligible_threads(4, parallel_thread_update_count);
+
+		SECTION("Threads are progressed by workers")
+		{
+			REQUIRE(serial_thread_update_count == 0);
+			REQUIRE(parallel_thread_update_count > 0);
+		}
+
+		SECTION("Parallel progression matches serial progression")
+		{
+			REQUIRE(parallel_results.size() == entity_count);
+			REQUIRE(parallel_results == serial_results);
+		}
+
+		set_archetype_cache_directory(previous_cache_directory);
+
+		std::filesystem::remove_all(test_directory);
+	}
+
+	TEST_CASE("engine::EntitySystem thread scheduling", "[engine:entity]")
+	{
+		using namespace instructions;
+
+		reflect_all();
+
+		auto service = TestService {};
+		auto entity_system = EntitySystem { service, service.get_systems(), true };
+
+		auto& registry = service.get_registry();
+
+		auto factory_data = std::make_shared<EntityFactoryData>();
+
+		// NOTE: Threads are added to the descriptor directly, rather than being parsed.
+		auto& descriptor = const_cast<EntityDescriptor&>(factory_data->factory.get_descriptor());
+
+		// Adds a thread named `thread_name`, beginning with `first_instruction`.
+		// (Padded with no-ops, ensuring the thread remains active during this test)
+		auto add_thread = [&descriptor](std::string_view thread_name, EntityInstruction first_instruction)
+		{
+			auto& thread = descriptor.shared_storage.allocate<EntityThreadDescription>(EntityThreadCadence::Update);
+
+			thread.thread_id = hash(thread_name).value();
+
+			thread.instructions.emplace_back(std::move(first_instruction));
+
+			for (std::size_t i = 0; i < 16; i++)
+			{
+				thread.instructions.emplace_back(NoOp {});
+			}
+
+			thread.compile();
+
+			return thread.thread_id;
+		};
+
+		const auto idle_thread    = add_thread("idle", NoOp {});
+		const auto fixed_thread   = add_thread("fixed", CadenceControlBlock { EntityThreadCadence::Fixed });
+		const auto pausing_thread = add_thread("pausing", Pause {});
+
+		auto create_entity = [&registry, &factory_data]()
+		{
+			const auto entity = registry.create();
+
+			registry.emplace<InstanceComponent>(entity, factory_data);
+
+			return entity;
+		};
+
+		auto spawn_thread = [&service](Entity entity, EntityThreadID thread_id)
+		{
+			service.event<EntityThreadSpawnCommand>(entity, entity, EntityThreadTarget { thread_id });
+		};
+
+		auto update = [&service]()
+		{
+			service.update({}, 0.0f);
+		};
+
+		// Listed throughout this test, ensuring that changes to other entities leave it unaffected.
+		const auto bystander = create_entity();
+
+		spawn_thread(bystander, idle_thread);
+
+		const auto entity = create_entity();
+
+		update();
+
+		REQUIRE(entity_system.get_scheduled_thread_count(EntityThreadCadence::Update, bystander) == 1);
+		REQUIRE(entity_system.get_scheduled_thread_count(EntityThreadCadence::Update, entity) == 0);
+
+		SECTION("Spawned threads are listed until stopped")
+		{
+			spawn_thread(entity, idle_thread);
+
+			update();
+
+			REQUIRE(entity_system.get_scheduled_thread_count(EntityThreadCadence::Update, entity) == 1);
+			REQUIRE(entity_system.get_scheduled_thread_count(EntityThreadCadence::Update) == 2);
+
+			service.event<EntityThreadStopCommand>(entity, entity, EntityThreadTarget { idle_thread }, false);
+
+			update();
+
+			REQUIRE(entity_system.get_scheduled_thread_count(EntityThreadCadence::Update, entity) == 0);
+			REQUIRE(entity_system.get_scheduled_thread_count(EntityThreadCadence::Update) == 1);
+		}
+
+		SECTION("Threads move between lists when their cadence changes")
+		{
+			spawn_thread(entity, idle_thread);
+			spawn_thread(entity, fixed_thread);
+
+			// Executes the cadence change; the thread remains listed until the next update.
+			update();
+
+			REQUIRE(entity_system.get_scheduled_thread_count(EntityThreadCadence::Update, entity) == 2);
+
+			update();
+
+			REQUIRE(entity_system.get_scheduled_thread_count(EntityThreadCadence::Update, entity) == 1);
+			REQUIRE(entity_system.get_scheduled_thread_count(EntityThreadCadence::Fixed, entity) == 1);
+
+			service.event<EntityThreadStopCommand>(entity, entity, EntityThreadTarget { fixed_thread }, false);
+
+			update();
+
+			REQUIRE(entity_system.get_scheduled_thread_count(EntityThreadCadence::Update, entity) == 1);
+			REQUIRE(entity_system.get_scheduled_thread_count(EntityThreadCadence::Fixed, entity) == 0);
+		}
+
+		SECTION("Sleeping entities are listed again once woken")
+		{
+			spawn_thread(entity, pausing_thread);
+
+			// The thread pauses itself, after which the entity is put to sleep.
+			update();
+
+			update();
+
+			REQUIRE(entity_system.get_scheduled_thread_count(EntityThreadCadence::Update, entity) == 0);
+			REQUIRE(registry.get<EntityThreadComponent>(entity).threads.size() == 1);
+
+			service.event<EntityThreadResumeCommand>(entity, entity, EntityThreadTarget { pausing_thread }, false);
+
+			update();
+
+			REQUIRE(entity_system.get_scheduled_thread_count(EntityThreadCadence::Update, entity) == 1);
+		}
+
+		SECTION("Destroyed entities are removed")
+		{
+			spawn_thread(entity, idle_thread);
+
+			update();
+
+			REQUIRE(entity_system.get_scheduled_thread_count(EntityThreadCadence::Update) == 2);
+
+			registry.destroy(entity);
+
+			update();
+
+			REQUIRE(entity_system.get_scheduled_thread_count(EntityThreadCadence::Update) == 1);
+		}
+
+		REQUIRE(entity_system.get_scheduled_thread_count(EntityThreadCadence::Update, bystander) == 1);
+	}
+}
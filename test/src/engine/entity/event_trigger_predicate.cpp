@@ -0,0 +1,267 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "../meta/reflection_test.hpp"
+
+#include <engine/entity/event_trigger_predicate.hpp>
+#include <engine/entity/event_trigger_condition.hpp>
+#include <engine/entity/entity_descriptor.hpp>
+#include <engine/entity/components/instance_component.hpp>
+
+#include <engine/resource_manager/entity_factory_data.hpp>
+
+#include <engine/meta/meta_evaluation_context.hpp>
+#include <engine/meta/reflect_all.hpp>
+#include <engine/meta/hash.hpp>
+
+#include <memory>
+#include <string>
+#include <variant>
+#include <vector>
+#include <cstdint>
+
+namespace engine
+{
+	TEST_CASE("engine::EventTriggerPredicate", "[engine:entity]")
+	{
+		using ComparisonMethod = EventTriggerComparisonMethod;
+
+		SECTION("Primitive types")
+		{
+			REQUIRE(EventTriggerPredicate::get_primitive_type(MetaAny { true }.type()) == EventTriggerPrimitiveType::Bool);
+			REQUIRE(EventTriggerPredicate::get_primitive_type(MetaAny { std::int32_t { 1 } }.type()) == EventTriggerPrimitiveType::Int32);
+			REQUIRE(EventTriggerPredicate::get_primitive_type(MetaAny { std::uint8_t { 1 } }.type()) == EventTriggerPrimitiveType::UInt8);
+			REQUIRE(EventTriggerPredicate::get_primitive_type(MetaAny { 1.0f }.type()) == EventTriggerPrimitiveType::Float);
+			REQUIRE(EventTriggerPredicate::get_primitive_type(MetaAny { std::string {} }.type()) == EventTriggerPrimitiveType::None);
+		}
+
+		SECTION("Reading primitives")
+		{
+			const auto value = EventTriggerPredicate::read_primitive(MetaAny { std::int16_t { -5 } }, EventTriggerPrimitiveType::Int16);
+
+			REQUIRE(std::holds_alternative<std::int64_t>(value));
+			REQUIRE(std::get<std::int64_t>(value) == -5);
+
+			// Mismatched types are not converted.
+			REQUIRE(std::holds_alternative<std::monostate>(EventTriggerPredicate::read_primitive(MetaAny { 1.0f }, EventTriggerPrimitiveType::Int32)));
+		}
+
+		SECTION("Comparisons")
+		{
+			const auto signed_value = EventTriggerPrimitive { std::int64_t { -1 } };
+			const auto unsigned_value = EventTriggerPrimitive { std::uint64_t { 1 } };
+			const auto floating_value = EventTriggerPrimitive { 1.0 };
+
+			REQUIRE(EventTriggerPredicate::compare(signed_value, unsigned_value, ComparisonMethod::LessThan) == true);
+			REQUIRE(EventTriggerPredicate::compare(signed_value, unsigned_value, ComparisonMethod::Equal) == false);
+			REQUIRE(EventTriggerPredicate::compare(unsigned_value, floating_value, ComparisonMethod::Equal) == true);
+			REQUIRE(EventTriggerPredicate::compare(floating_value, signed_value, ComparisonMethod::GreaterThanOrEqual) == true);
+
+			REQUIRE(EventTriggerPredicate::compare(EventTriggerPrimitive { true }, EventTriggerPrimitive { true }, ComparisonMethod::Equal) == true);
+
+			// Booleans are only compared for equality, and only against other booleans.
+			REQUIRE(!EventTriggerPredicate::compare(EventTriggerPrimitive { true }, EventTriggerPrimitive { false }, ComparisonMethod::LessThan).has_value());
+			REQUIRE(!EventTriggerPredicate::compare(EventTriggerPrimitive { true }, unsigned_value, ComparisonMethod::Equal).has_value());
+
+			REQUIRE(!EventTriggerPredicate::compare(EventTriggerPrimitive {}, unsigned_value, ComparisonMethod::Equal).has_value());
+		}
+	}
+
+	TEST_CASE("engine::EventTriggerCondition::compile", "[engine:entity]")
+	{
+		using namespace engine::literals;
+
+		using ComparisonMethod = EventTriggerComparisonMethod;
+
+		reflect_all();
+		reflect<ReflectionTest>();
+
+		auto factory_data = std::make_shared<EntityFactoryData>();
+
+		// NOTE: `factory_data` is not itself const, allowing conditions to be allocated directly.
+		auto& descriptor = const_cast<EntityDescriptor&>(factory_data->factory.get_descriptor());
+
+		auto registry = Registry {};
+
+		const auto entity = registry.create();
+
+		registry.emplace<InstanceComponent>(entity, factory_data);
+
+		const auto context = MetaEvaluationContext {};
+
+		auto single = [&descriptor](MetaSymbolID member_id, std::int32_t value, ComparisonMethod comparison_method=ComparisonMethod::Equal)
+		{
+			return descriptor.allocate<EventTriggerCondition>
+			(
+				EventTriggerSingleCondition { member_id, MetaAny { value }, comparison_method, "ReflectionTest"_hs }
+			);
+		};
+
+		// Compiles the condition referenced by `condition_ref`.
+		// NOTE: Conditions must be retrieved after every allocation has been made, since storage may be reallocated.
+		auto compile = [&descriptor](EntityDescriptorShared<EventTriggerCondition> condition_ref) -> const EventTriggerCondition&
+		{
+			auto& condition = condition_ref.get(descriptor);
+
+			REQUIRE(condition.compile(descriptor, condition_ref.get_index()));
+			REQUIRE(condition.has_predicate());
+
+			return condition;
+		};
+
+		// Evaluates `condition` through both its compiled predicate and the reflective path, requiring identical results.
+		auto evaluate = [&registry, entity, &context](const EventTriggerCondition& condition, const MetaAny& event_instance)
+		{
+			const bool compiled_result = condition.predicate.condition_met(event_instance, registry, entity, context);
+			const bool reflective_result = EventTriggerConditionType::get_condition_status(condition, event_instance, registry, entity, context);
+
+			REQUIRE(compiled_result == reflective_result);
+			REQUIRE(condition.condition_met(event_instance, registry, entity, context) == compiled_result);
+
+			return compiled_result;
+		};
+
+		const auto matching_event = MetaAny { ReflectionTest { 1, 2, 3 } };
+		const auto partial_event = MetaAny { ReflectionTest { 1, 5, 3 } };
+		const auto unrelated_event = MetaAny { ReflectionTest { 4, 5, 6 } };
+
+		// An event of a different type, sharing no members with `ReflectionTest`.
+		const auto mismatched_event = MetaAny { ReflectionTest::Nested { 1.0f } };
+
+		SECTION("Single comparisons")
+		{
+			const auto equal_ref = single("x"_hs, 1);
+			const auto greater_ref = single("z"_hs, 2, ComparisonMethod::GreaterThan);
+
+			const auto& equal_condition = compile(equal_ref);
+			const auto& greater_condition = compile(greater_ref);
+
+			REQUIRE(equal_condition.predicate.instructions.front().opcode == EventTriggerPredicateOpcode::Compare);
+
+			REQUIRE(evaluate(equal_condition, matching_event));
+			REQUIRE(!evaluate(equal_condition, unrelated_event));
+
+			REQUIRE(evaluate(greater_condition, matching_event));
+			REQUIRE(evaluate(greater_condition, unrelated_event));
+			REQUIRE(!evaluate(greater_condition, MetaAny { ReflectionTest { 0, 0, 2 } }));
+		}
+
+		SECTION("And")
+		{
+			auto and_condition = EventTriggerAndCondition {};
+
+			and_condition.add_condition(single("x"_hs, 1));
+			and_condition.add_condition(single("y"_hs, 2));
+
+			const auto& condition = compile(descriptor.allocate<EventTriggerCondition>(std::move(and_condition)));
+
+			REQUIRE(condition.predicate.size() == 3);
+			REQUIRE(condition.predicate.instructions.front().opcode == EventTriggerPredicateOpcode::And);
+
+			REQUIRE(evaluate(condition, matching_event));
+			REQUIRE(!evaluate(condition, partial_event));
+			REQUIRE(!evaluate(condition, unrelated_event));
+		}
+
+		SECTION("Or")
+		{
+			auto or_condition = EventTriggerOrCondition {};
+
+			or_condition.add_condition(single("x"_hs, 4));
+			or_condition.add_condition(single("y"_hs, 2));
+
+			const auto& condition = compile(descriptor.allocate<EventTriggerCondition>(std::move(or_condition)));
+
+			REQUIRE(condition.predicate.instructions.front().opcode == EventTriggerPredicateOpcode::Or);
+
+			REQUIRE(evaluate(condition, matching_event));
+			REQUIRE(evaluate(condition, unrelated_event));
+			REQUIRE(!evaluate(condition, partial_event));
+		}
+
+		SECTION("Not")
+		{
+			const auto& condition = compile(descriptor.allocate<EventTriggerCondition>(EventTriggerInverseCondition { single("y"_hs, 2) }));
+
+			REQUIRE(condition.predicate.size() == 2);
+			REQUIRE(condition.predicate.instructions.front().opcode == EventTriggerPredicateOpcode::Not);
+
+			REQUIRE(!evaluate(condition, matching_event));
+			REQUIRE(evaluate(condition, partial_event));
+		}
+
+		SECTION("Nested compound conditions")
+		{
+			auto or_condition = EventTriggerOrCondition {};
+
+			or_condition.add_condition(single("y"_hs, 2));
+			or_condition.add_condition(single("y"_hs, 5));
+
+			auto and_condition = EventTriggerAndCondition {};
+
+			and_condition.add_condition(descriptor.allocate<EventTriggerCondition>(std::move(or_condition)));
+			and_condition.add_condition(descriptor.allocate<EventTriggerCondition>(EventTriggerInverseCondition { single("x"_hs, 4) }));
+
+			const auto& condition = compile(descriptor.allocate<EventTriggerCondition>(std::move(and_condition)));
+
+			// And(Or(Compare, Compare), Not(Compare))
+			REQUIRE(condition.predicate.size() == 6);
+
+			REQUIRE(evaluate(condition, matching_event));
+			REQUIRE(evaluate(condition, partial_event));
+			REQUIRE(!evaluate(condition, unrelated_event));
+		}
+
+		SECTION("Mismatched event types")
+		{
+			auto or_condition = EventTriggerOrCondition {};
+
+			or_condition.add_condition(single("x"_hs, 1));
+			or_condition.add_condition(single("z"_hs, 3, ComparisonMethod::NotEqual));
+
+			const auto condition_ref = descriptor.allocate<EventTriggerCondition>(std::move(or_condition));
+			const auto inverse_ref = descriptor.allocate<EventTriggerCondition>(EventTriggerInverseCondition { single("x"_hs, 1) });
+
+			const auto& condition = compile(condition_ref);
+			const auto& inverse_condition = compile(inverse_ref);
+
+			REQUIRE(!evaluate(condition, mismatched_event));
+			REQUIRE(!evaluate(condition, MetaAny {}));
+
+			REQUIRE(evaluate(inverse_condition, mismatched_event));
+		}
+
+		SECTION("Component fallback")
+		{
+			registry.emplace<ReflectionTest>(entity, 4, 5, 6);
+
+			auto and_condition = EventTriggerAndCondition {};
+
+			and_condition.add_condition(single("x"_hs, 4));
+			and_condition.add_condition(single("z"_hs, 5, ComparisonMethod::GreaterThan));
+
+			const auto condition_ref = descriptor.allocate<EventTriggerCondition>(std::move(and_condition));
+			const auto equal_ref = single("x"_hs, 4);
+			const auto missing_ref = single("y"_hs, 2);
+
+			const auto& condition = compile(condition_ref);
+			const auto& equal_condition = compile(equal_ref);
+			const auto& missing_condition = compile(missing_ref);
+
+			// Neither event satisfies the comparison; the entity's `ReflectionTest` component does.
+			REQUIRE(evaluate(equal_condition, matching_event));
+			REQUIRE(evaluate(equal_condition, mismatched_event));
+
+			REQUIRE(evaluate(condition, matching_event));
+			REQUIRE(evaluate(condition, mismatched_event));
+
+			// Satisfied by the event, but not by the component.
+			REQUIRE(evaluate(missing_condition, matching_event));
+			REQUIRE(!evaluate(missing_condition, mismatched_event));
+
+			registry.remove<ReflectionTest>(entity);
+
+			REQUIRE(!evaluate(equal_condition, matching_event));
+			REQUIRE(!evaluate(condition, mismatched_event));
+		}
+	}
+}
@@ -0,0 +1,301 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "../test_service.hpp"
+
+#include <engine/entity/entity_listener.hpp>
+#include <engine/entity/entity_system.hpp>
+#include <engine/entity/entity_thread.hpp>
+#include <engine/entity/entity_thread_description.hpp>
+#include <engine/entity/entity_descriptor.hpp>
+#include <engine/entity/entity_instruction.hpp>
+#include <engine/entity/event_trigger_condition.hpp>
+#include <engine/entity/components/entity_thread_component.hpp>
+#include <engine/entity/components/instance_component.hpp>
+#include <engine/entity/components/pooled_entity_component.hpp>
+#include <engine/entity/commands/entity_thread_spawn_command.hpp>
+#include <engine/entity/commands/entity_thread_stop_command.hpp>
+
+#include <engine/resource_manager/entity_factory_data.hpp>
+
+#include <engine/reflection/reflection.hpp>
+#include <engine/meta/reflect_all.hpp>
+#include <engine/meta/hash.hpp>
+
+#include <memory>
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+
+namespace engine
+{
+	// An event awaited by the threads of `engine::EntityListener` tests.
+	struct ListenerTestEvent
+	{
+		std::int32_t button = 0;
+	};
+
+	template <>
+	void reflect<ListenerTestEvent>()
+	{
+		engine_event_type<ListenerTestEvent>()
+			.data<&ListenerTestEvent::button>("button"_hs)
+		;
+	}
+
+	TEST_CASE("engine::EntityListener::make_event_filter", "[engine:entity]")
+	{
+		const auto member_id = hash("button").value();
+
+		SECTION("Equality comparison with an integral value")
+		{
+			const auto condition = EventTriggerSingleCondition { member_id, MetaAny { std::int32_t { 7 } }, EventTriggerComparisonMethod::Equal };
+
+			const auto filter = EntityListener::make_event_filter(condition);
+
+			REQUIRE(filter.has_value());
+			REQUIRE(filter->member == member_id);
+			REQUIRE(filter->value == 7);
+		}
+
+		SECTION("Non-equality comparisons are not filtered")
+		{
+			const auto condition = EventTriggerSingleCondition { member_id, MetaAny { std::int32_t { 7 } }, EventTriggerComparisonMethod::GreaterThan };
+
+			REQUIRE(!EntityListener::make_event_filter(condition).has_value());
+		}
+
+		SECTION("Non-integral values are not filtered")
+		{
+			const auto condition = EventTriggerSingleCondition { member_id, MetaAny { 7.0f }, EventTriggerComparisonMethod::Equal };
+
+			REQUIRE(!EntityListener::make_event_filter(condition).has_value());
+		}
+
+		SECTION("Comparisons against the event itself are not filtered")
+		{
+			const auto condition = EventTriggerSingleCondition { MetaAny { std::int32_t { 7 } }, EventTriggerComparisonMethod::Equal };
+
+			REQUIRE(!EntityListener::make_event_filter(condition).has_value());
+		}
+	}
+
+	TEST_CASE("engine::EntityListener waiting threads", "[engine:entity]")
+	{
+		using namespace instructions;
+
+		reflect_all();
+		reflect<ListenerTestEvent>();
+
+		constexpr std::int32_t button_id = 1;
+		constexpr std::int32_t other_button_id = 2;
+
+		const auto event_type_id = resolve<ListenerTestEvent>().id();
+
+		auto service = TestService {};
+		auto entity_system = EntitySystem { service, service.get_systems(), true };
+
+		auto& registry = service.get_registry();
+
+		auto factory_data = std::make_shared<EntityFactoryData>();
+
+		// NOTE: Threads are added to the descriptor directly, rather than being parsed.
+		auto& descriptor = const_cast<EntityDescriptor&>(factory_data->factory.get_descriptor());
+
+		// Adds a thread named `thread_name`, optionally yielding until `ListenerTestEvent::button` is `button_id`.
+		// (Padded with no-ops, ensuring the thread remains active during this test)
+		auto add_thread = [&descriptor, event_type_id](std::string_view thread_name, bool yield_on_event)
+		{
+			auto& thread = descriptor.shared_storage.allocate<EntityThreadDescription>(EntityThreadCadence::Update);
+
+			thread.thread_id = hash(thread_name).value();
+
+			if (yield_on_event)
+			{
+				thread.instructions.emplace_back
+				(
+					Yield
+					{
+						{},
+
+						descriptor.allocate<EventTriggerCondition>
+						(
+							EventTriggerSingleCondition
+							{
+								"button"_hs,
+								MetaAny { button_id },
+								EventTriggerComparisonMethod::Equal,
+								event_type_id
+							}
+						)
+					}
+				);
+			}
+
+			for (std::size_t i = 0; i < 16; i++)
+			{
+				thread.instructions.emplace_back(NoOp {});
+			}
+
+			thread.compile();
+
+			return thread.thread_id;
+		};
+
+		const auto idle_thread    = add_thread("idle", false);
+		const auto waiting_thread = add_thread("waiting", true);
+
+		auto create_entity = [&registry, &factory_data]()
+		{
+			const auto entity = registry.create();
+
+			registry.emplace<InstanceComponent>(entity, factory_data);
+
+			return entity;
+		};
+
+		auto spawn_thread = [&service](Entity entity, EntityThreadID thread_id)
+		{
+			service.event<EntityThreadSpawnCommand>(entity, entity, EntityThreadTarget { thread_id });
+		};
+
+		auto stop_thread = [&service](Entity entity, EntityThreadID thread_id)
+		{
+			service.event<EntityThreadStopCommand>(entity, entity, EntityThreadTarget { thread_id }, false);
+		};
+
+		auto get_thread = [&registry](Entity entity, EntityThreadID thread_id) -> EntityThread*
+		{
+			for (auto& thread : registry.get<EntityThreadComponent>(entity).threads)
+			{
+				if (thread.thread_id == thread_id)
+				{
+					return &thread;
+				}
+			}
+
+			return {};
+		};
+
+		auto update = [&service]()
+		{
+			service.update({}, 0.0f);
+		};
+
+		const auto entity = create_entity();
+
+		// Erased by some sections, moving `waiting_thread` to an earlier local index.
+		spawn_thread(entity, idle_thread);
+		spawn_thread(entity, waiting_thread);
+
+		update();
+
+		auto* listener = entity_system.listen(event_type_id);
+
+		REQUIRE(listener);
+		REQUIRE(listener->waiting_thread_count() == 1);
+
+		REQUIRE(get_thread(entity, waiting_thread));
+		REQUIRE(get_thread(entity, waiting_thread)->is_yielding);
+
+		SECTION("Yielding threads are resumed and their records removed")
+		{
+			service.event(ListenerTestEvent { button_id });
+
+			REQUIRE(!get_thread(entity, waiting_thread)->is_yielding);
+			REQUIRE(listener->waiting_thread_count() == 0);
+		}
+
+		SECTION("Events with a different button ID are skipped")
+		{
+			service.event(ListenerTestEvent { other_button_id });
+
+			REQUIRE(get_thread(entity, waiting_thread)->is_yielding);
+			REQUIRE(listener->waiting_thread_count() == 1);
+
+			// Replace the record's filter with one for `other_button_id`, so that
+			// the thread's own condition would be met if the event were delivered.
+			const auto& thread = *get_thread(entity, waiting_thread);
+
+			const auto filter = EntityListener::make_event_filter
+			(
+				EventTriggerSingleCondition { "button"_hs, MetaAny { other_button_id }, EventTriggerComparisonMethod::Equal, event_type_id }
+			);
+
+			REQUIRE(filter);
+
+			REQUIRE
+			(
+				!listener->add_waiting_thread
+				(
+					EntityListener::WaitingThread
+					{
+						.entity = entity,
+						.local_thread_index = *registry.get<EntityThreadComponent>(entity).get_local_index(thread),
+						.thread_index = thread.thread_index,
+						.thread_id = thread.thread_id,
+						.filter = filter
+					}
+				)
+			);
+
+			service.event(ListenerTestEvent { button_id });
+
+			REQUIRE(get_thread(entity, waiting_thread)->is_yielding);
+			REQUIRE(listener->waiting_thread_count() == 1);
+
+			service.event(ListenerTestEvent { other_button_id });
+
+			REQUIRE(!get_thread(entity, waiting_thread)->is_yielding);
+			REQUIRE(listener->waiting_thread_count() == 0);
+		}
+
+		SECTION("Records of stopped threads are discarded")
+		{
+			stop_thread(entity, waiting_thread);
+
+			REQUIRE(!get_thread(entity, waiting_thread));
+
+			// Stale records are discarded upon delivery.
+			REQUIRE(listener->waiting_thread_count() == 1);
+
+			service.event(ListenerTestEvent { button_id });
+
+			REQUIRE(listener->waiting_thread_count() == 0);
+		}
+
+		SECTION("Records are resolved by ID after an earlier thread is erased")
+		{
+			stop_thread(entity, idle_thread);
+
+			REQUIRE(!get_thread(entity, idle_thread));
+
+			// The waiting thread now occupies the local index previously used by `idle_thread`.
+			REQUIRE(registry.get<EntityThreadComponent>(entity).threads.size() == 1);
+
+			service.event(ListenerTestEvent { button_id });
+
+			REQUIRE(!get_thread(entity, waiting_thread)->is_yielding);
+			REQUIRE(listener->waiting_thread_count() == 0);
+		}
+
+		SECTION("Records of pooled entities are removed")
+		{
+			const auto bystander = create_entity();
+
+			spawn_thread(bystander, waiting_thread);
+
+			update();
+
+			REQUIRE(listener->waiting_thread_count() == 2);
+
+			registry.emplace<PooledEntityComponent>(entity);
+
+			REQUIRE(listener->waiting_thread_count() == 1);
+
+			service.event(ListenerTestEvent { button_id });
+
+			REQUIRE(!get_thread(bystander, waiting_thread)->is_yielding);
+			REQUIRE(listener->waiting_thread_count() == 0);
+		}
+	}
+}
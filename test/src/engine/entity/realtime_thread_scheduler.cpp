@@ -0,0 +1,119 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <engine/entity/realtime_thread_scheduler.hpp>
+
+#include <vector>
+#include <cstddef>
+
+namespace engine
+{
+	TEST_CASE("engine::RealtimeThreadScheduler", "[engine:entity]")
+	{
+		using namespace std::chrono_literals;
+
+		using TimePoint = RealtimeThreadScheduler::TimePoint;
+
+		auto scheduler = RealtimeThreadScheduler {};
+
+		const auto start = TimePoint {} + 1s;
+
+		// Visits entities until `next_group` stops, advancing the clock by `step` per entity.
+		auto run_pass = [&scheduler, start](std::size_t group_count, RealtimeThreadScheduler::Duration step)
+		{
+			auto visited = std::vector<std::size_t> {};
+
+			auto now = start;
+
+			scheduler.begin_pass(group_count, now);
+
+			while (const auto group_index = scheduler.next_group(now))
+			{
+				visited.push_back(*group_index);
+
+				now += step;
+			}
+
+			scheduler.end_pass(visited.size(), now);
+
+			return visited;
+		};
+
+		SECTION("Every entity is progressed without a budget")
+		{
+			REQUIRE(!scheduler.has_budget());
+
+			REQUIRE(run_pass(4, 1000us) == std::vector<std::size_t> { 0, 1, 2, 3 });
+			REQUIRE(scheduler.get_statistics().entities_deferred == 0);
+
+			// The starting entity is rotated between passes.
+			REQUIRE(run_pass(4, 1000us) == std::vector<std::size_t> { 1, 2, 3, 0 });
+		}
+
+		SECTION("Deferred entities are progressed first on the next pass")
+		{
+			scheduler.set_budget(250us);
+
+			REQUIRE(run_pass(8, 100us) == std::vector<std::size_t> { 0, 1, 2 });
+
+			const auto& statistics = scheduler.get_statistics();
+
+			REQUIRE(statistics.entities_progressed == 3);
+			REQUIRE(statistics.entities_deferred == 5);
+			REQUIRE(statistics.elapsed == 300us);
+
+			REQUIRE(run_pass(8, 100us) == std::vector<std::size_t> { 3, 4, 5 });
+			REQUIRE(run_pass(8, 100us) == std::vector<std::size_t> { 6, 7, 0 });
+		}
+
+		SECTION("The first entity of a pass is always progressed")
+		{
+			scheduler.set_budget(10us);
+
+			REQUIRE(run_pass(3, 1000us) == std::vector<std::size_t> { 0 });
+			REQUIRE(run_pass(3, 1000us) == std::vector<std::size_t> { 1 });
+			REQUIRE(run_pass(3, 1000us) == std::vector<std::size_t> { 2 });
+			REQUIRE(run_pass(3, 1000us) == std::vector<std::size_t> { 0 });
+		}
+
+		SECTION("The deadline only applies during a pass")
+		{
+			scheduler.set_budget(100us);
+
+			REQUIRE(!scheduler.deadline_reached(start + 1s));
+
+			scheduler.begin_pass(2, start);
+
+			REQUIRE(!scheduler.deadline_reached(start + 50us));
+			REQUIRE(scheduler.deadline_reached(start + 100us));
+
+			scheduler.on_thread_preempted();
+			scheduler.end_pass(1, start + 100us);
+
+			REQUIRE(scheduler.get_statistics().threads_preempted == 1);
+			REQUIRE(!scheduler.deadline_reached(start + 1s));
+		}
+
+		SECTION("The cursor wraps when the thread list shrinks")
+		{
+			scheduler.set_budget(150us);
+
+			REQUIRE(run_pass(8, 100us) == std::vector<std::size_t> { 0, 1 });
+			REQUIRE(run_pass(8, 100us) == std::vector<std::size_t> { 2, 3 });
+			REQUIRE(run_pass(8, 100us) == std::vector<std::size_t> { 4, 5 });
+
+			REQUIRE(scheduler.get_cursor() == 6);
+
+			REQUIRE(run_pass(4, 100us) == std::vector<std::size_t> { 2, 3 });
+			REQUIRE(run_pass(0, 100us).empty());
+			REQUIRE(scheduler.get_cursor() == 0);
+		}
+
+		SECTION("Negative budgets are treated as unlimited")
+		{
+			scheduler.set_budget(-5us);
+
+			REQUIRE(!scheduler.has_budget());
+			REQUIRE(scheduler.get_budget() == 0us);
+		}
+	}
+}
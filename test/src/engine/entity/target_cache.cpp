@@ -0,0 +1,188 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "../test_service.hpp"
+
+#include <engine/entity/entity_target.hpp>
+#include <engine/entity/entity_target_cache.hpp>
+#include <engine/entity/entity_system.hpp>
+
+#include <engine/components/name_component.hpp>
+#include <engine/components/relationship_component.hpp>
+
+#include <engine/meta/reflect_all.hpp>
+#include <engine/meta/hash.hpp>
+
+#include <engine/types.hpp>
+
+#include <string>
+
+namespace engine
+{
+	TEST_CASE("engine::EntityTargetCache", "[engine:entity]")
+	{
+		auto registry = Registry {};
+
+		const auto parent = registry.create();
+		const auto child = registry.create();
+
+		RelationshipComponent::set_parent(registry, child, parent);
+
+		registry.emplace<NameComponent>(child, std::string { "child" });
+
+		const auto child_target = EntityTarget::from_target_type(EntityTarget::ChildTarget::from_string("child"));
+		const auto parent_target = EntityTarget::from_target_type(EntityTarget::ParentTarget {});
+		const auto self_target = EntityTarget {};
+
+		auto cache = EntityTargetCache {};
+
+		auto generations = EntityTargetCache::Generations {};
+
+		SECTION("Only name-based targets are cached")
+		{
+			REQUIRE(cache.resolve(registry, parent, self_target, generations) == parent);
+			REQUIRE(cache.resolve(registry, child, parent_target, generations) == parent);
+			REQUIRE(cache.empty());
+
+			REQUIRE(cache.resolve(registry, parent, child_target, generations) == child);
+			REQUIRE(cache.size() == 1);
+		}
+
+		SECTION("Cached results are reused until their name is invalidated")
+		{
+			REQUIRE(cache.resolve(registry, parent, child_target, generations) == child);
+
+			// Moving the child without invalidating its name keeps the previous result.
+			const auto other_parent = registry.create();
+
+			RelationshipComponent::set_parent(registry, child, other_parent);
+
+			REQUIRE(cache.resolve(registry, parent, child_target, generations) == child);
+
+			// Unrelated names do not affect this entry.
+			generations.invalidate(hash("other").value());
+
+			REQUIRE(cache.resolve(registry, parent, child_target, generations) == child);
+
+			generations.invalidate(hash("child").value());
+
+			REQUIRE(cache.resolve(registry, parent, child_target, generations) == null);
+		}
+
+		SECTION("Invalidating every name discards every entry")
+		{
+			REQUIRE(cache.resolve(registry, parent, child_target, generations) == child);
+
+			RelationshipComponent::set_parent(registry, child, registry.create());
+
+			generations.invalidate_all();
+
+			REQUIRE(cache.resolve(registry, parent, child_target, generations) == null);
+		}
+
+		SECTION("Entities renamed in-place are not returned")
+		{
+			REQUIRE(cache.resolve(registry, parent, child_target, generations) == child);
+
+			// NOTE: Renamed without notifying the registry, meaning that no generation is advanced.
+			registry.get<NameComponent>(child).set_name("renamed");
+
+			REQUIRE(cache.resolve(registry, parent, child_target, generations) == null);
+		}
+
+		SECTION("Unresolved targets are not cached")
+		{
+			const auto missing_target = EntityTarget::from_target_type(EntityTarget::ChildTarget::from_string("missing"));
+
+			REQUIRE(cache.resolve(registry, parent, missing_target, generations) == null);
+			REQUIRE(cache.empty());
+		}
+
+		SECTION("Destroyed entities are never returned")
+		{
+			const auto source = registry.create();
+			const auto named = registry.create();
+
+			registry.emplace<NameComponent>(named, std::string { "named" });
+
+			const auto name_target = EntityTarget::from_target_type(EntityTarget::EntityNameTarget::from_string("named"));
+
+			REQUIRE(cache.resolve(registry, source, name_target, generations) == named);
+
+			registry.destroy(named);
+
+			REQUIRE(cache.resolve(registry, source, name_target, generations) == null);
+		}
+	}
+
+	TEST_CASE("engine::EntitySystem target cache invalidation", "[engine:entity]")
+	{
+		reflect_all();
+
+		auto service = TestService {};
+		auto entity_system = EntitySystem { service, service.get_systems(), true };
+
+		auto& registry = service.get_registry();
+
+		const auto child_name = hash("child").value();
+		const auto other_name = hash("other").value();
+
+		auto get_generation = [&entity_system](StringHash name_hash)
+		{
+			return entity_system.get_target_cache_generations().get(name_hash);
+		};
+
+		const auto parent = registry.create();
+		const auto child = registry.create();
+
+		service.set_name(child, "child");
+		service.set_parent(child, parent);
+
+		const auto initial_generation = get_generation(child_name);
+
+		SECTION("Unrelated names leave cached targets intact")
+		{
+			// e.g. spawning other named entities.
+			const auto other = registry.create();
+
+			service.set_name(other, "other");
+			service.set_parent(other, parent);
+
+			registry.destroy(other);
+
+			REQUIRE(get_generation(child_name) == initial_generation);
+			REQUIRE(get_generation(other_name) != EntityTargetCache::Generation {});
+		}
+
+		SECTION("Names are invalidated when assigned or removed")
+		{
+			const auto other = registry.create();
+
+			service.set_name(other, "child");
+
+			const auto assigned_generation = get_generation(child_name);
+
+			REQUIRE(assigned_generation != initial_generation);
+
+			registry.destroy(other);
+
+			REQUIRE(get_generation(child_name) != assigned_generation);
+		}
+
+		SECTION("Names within a re-parented hierarchy are invalidated")
+		{
+			const auto grandparent = registry.create();
+
+			service.set_parent(parent, grandparent);
+
+			REQUIRE(get_generation(child_name) != initial_generation);
+		}
+
+		SECTION("Invalidating every target advances every name")
+		{
+			entity_system.invalidate_target_caches();
+
+			REQUIRE(get_generation(child_name) != initial_generation);
+			REQUIRE(get_generation(other_name) != EntityTargetCache::Generation {});
+		}
+	}
+}
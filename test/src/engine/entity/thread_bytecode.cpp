@@ -0,0 +1,293 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <engine/entity/entity_thread_description.hpp>
+#include <engine/entity/entity_thread_bytecode.hpp>
+#include <engine/entity/entity_instruction.hpp>
+#include <engine/entity/entity_target.hpp>
+
+#include <engine/meta/hash.hpp>
+
+#include <util/variant.hpp>
+
+#include <string>
+#include <variant>
+#include <cstddef>
+
+namespace engine
+{
+	namespace
+	{
+		using namespace instructions;
+
+		IfControlBlock make_if_block(EntityInstructionCount size)
+		{
+			return IfControlBlock { { EntityDescriptorShared<EventTriggerCondition> { 0 }, ControlBlock { size } } };
+		}
+
+		// NOTE: Lowering never resolves indirect values, so an empty reference is sufficient.
+		IndirectMetaAny make_indirect_value()
+		{
+			return IndirectMetaAny { MetaTypeID {}, 0 };
+		}
+	}
+
+	TEST_CASE("engine::EntityThreadBytecode", "[engine:entity]")
+	{
+		auto thread = EntityThreadDescription {};
+
+		thread.instructions.emplace_back(NoOp {});
+		thread.instructions.emplace_back(make_if_block(2));
+		thread.instructions.emplace_back(Link {});
+		thread.instructions.emplace_back(CadenceControlBlock { EntityThreadCadence::Fixed });
+		thread.instructions.emplace_back(Rewind { {}, 4 });
+		thread.instructions.emplace_back(CadenceControlBlock { EntityThreadCadence::Multi, ControlBlock { 1 } });
+		thread.instructions.emplace_back(Stop {});
+		thread.instructions.emplace_back(FunctionCall { make_indirect_value() });
+		thread.instructions.emplace_back(AdvancedMetaExpression { make_indirect_value() });
+		thread.instructions.emplace_back(CoroutineCall { make_indirect_value() });
+		thread.instructions.emplace_back(Yield { {}, EntityDescriptorShared<EventTriggerCondition> { 0 } });
+		thread.instructions.emplace_back(Sleep {});
+
+		REQUIRE(!thread.has_bytecode());
+
+		thread.compile();
+
+		REQUIRE(thread.has_bytecode());
+		REQUIRE(thread.bytecode.size() == thread.instructions.size());
+
+		SECTION("Opcodes")
+		{
+			REQUIRE(thread.bytecode[0].opcode == EntityThreadOpcode::NoOp);
+			REQUIRE(thread.bytecode[1].opcode == EntityThreadOpcode::BranchIfNot);
+			REQUIRE(thread.bytecode[2].opcode == EntityThreadOpcode::Link);
+			REQUIRE(thread.bytecode[3].opcode == EntityThreadOpcode::SetCadence);
+			REQUIRE(thread.bytecode[3].cadence == EntityThreadCadence::Fixed);
+			REQUIRE(thread.bytecode[4].opcode == EntityThreadOpcode::Rewind);
+			REQUIRE(thread.bytecode[5].opcode == EntityThreadOpcode::Dispatch);
+			REQUIRE(thread.bytecode[6].opcode == EntityThreadOpcode::Stop);
+			REQUIRE(thread.bytecode[7].opcode == EntityThreadOpcode::Dispatch);
+			REQUIRE(thread.bytecode[10].opcode == EntityThreadOpcode::Dispatch);
+			REQUIRE(thread.bytecode[11].opcode == EntityThreadOpcode::Sleep);
+		}
+
+		SECTION("Precomputed jump targets")
+		{
+			// The instruction following the if-block's body.
+			REQUIRE(thread.bytecode[1].operand == 4);
+		}
+
+		SECTION("Thread instruction operands")
+		{
+			REQUIRE(thread.bytecode[4].operand == 4);
+
+			const auto skip = EntityThreadBytecode::lower(Skip { {}, ControlBlock { 3 }, false }, 0);
+
+			REQUIRE(skip.opcode == EntityThreadOpcode::Skip);
+			REQUIRE(skip.operand == 3);
+			REQUIRE(!skip.check_linked());
+
+			const auto start = EntityThreadBytecode::lower(Start { { {}, hash("other").value() } }, 0);
+
+			REQUIRE(start.opcode == EntityThreadOpcode::Start);
+			REQUIRE(start.operand == 0);
+
+			const auto restart = EntityThreadBytecode::lower(Restart {}, 0);
+
+			REQUIRE(restart.opcode == EntityThreadOpcode::Start);
+			REQUIRE(restart.operand == 1);
+
+			REQUIRE(EntityThreadBytecode::lower(Pause {}, 0).opcode == EntityThreadOpcode::Pause);
+			REQUIRE(EntityThreadBytecode::lower(Resume {}, 0).opcode == EntityThreadOpcode::Resume);
+
+			const auto transition = EntityThreadBytecode::lower(EntityStateTransitionAction { hash("state").value() }, 0);
+
+			REQUIRE(transition.opcode == EntityThreadOpcode::TransitionState);
+			REQUIRE(!transition.is_serial_only());
+
+			// The default target and thread ID refer to the executing thread.
+			REQUIRE(thread.bytecode[4].is_local_target());
+			REQUIRE(thread.bytecode[6].is_local_target());
+			REQUIRE(thread.bytecode[6].check_linked());
+			REQUIRE(restart.is_local_target());
+
+			// Other threads and entities are resolved from the source instruction.
+			REQUIRE(!start.is_local_target());
+			REQUIRE(!EntityThreadBytecode::lower(Stop { { EntityTarget::from_target_type(EntityTarget::ParentTarget {}) } }, 0).is_local_target());
+		}
+
+		SECTION("Flags")
+		{
+			REQUIRE(!thread.bytecode[0].is_implicit_yield());
+			REQUIRE(!thread.bytecode[0].is_serial_only());
+
+			REQUIRE(thread.bytecode[3].is_implicit_yield());
+			REQUIRE(thread.bytecode[3].is_serial_only());
+
+			REQUIRE(thread.bytecode[4].is_implicit_yield());
+
+			REQUIRE(!thread.bytecode[5].is_implicit_yield());
+			REQUIRE(thread.bytecode[5].is_serial_only());
+
+			// Conditions are evaluated reflectively.
+			REQUIRE(thread.bytecode[1].is_serial_only());
+
+			REQUIRE(!thread.bytecode[2].is_serial_only());
+			REQUIRE(!thread.bytecode[4].is_serial_only());
+			REQUIRE(!thread.bytecode[6].is_serial_only());
+
+			// Reflected calls and yield predicates.
+			REQUIRE(thread.bytecode[7].is_serial_only());
+			REQUIRE(thread.bytecode[8].is_serial_only());
+			REQUIRE(thread.bytecode[9].is_serial_only());
+			REQUIRE(thread.bytecode[10].is_serial_only());
+
+			// Side effects are raised as events.
+			REQUIRE(!thread.bytecode[11].is_serial_only());
+		}
+
+		SECTION("Thread instructions are serial-only unless their target is resolved statically")
+		{
+			auto lower_with_target = [](EntityTarget target)
+			{
+				return EntityThreadBytecode::lower(Sleep { { std::move(target) } }, 0);
+			};
+
+			REQUIRE(!lower_with_target(EntityTarget {}).is_serial_only());
+			REQUIRE(!lower_with_target(EntityTarget::from_target_type(EntityTarget::ParentTarget {})).is_serial_only());
+			REQUIRE(!lower_with_target(EntityTarget::from_entity(null)).is_serial_only());
+			REQUIRE(!lower_with_target(EntityTarget::from_target_type(EntityTarget::EntityNameTarget::from_string("name"))).is_serial_only());
+			REQUIRE(!lower_with_target(EntityTarget::from_target_type(EntityTarget::ChildTarget::from_string("child"))).is_serial_only());
+
+			// Indirect targets evaluate reflected expressions.
+			REQUIRE(lower_with_target(EntityTarget::from_target_type(EntityTarget::IndirectTarget { make_indirect_value() })).is_serial_only());
+
+			// Player targets may create component storage.
+			REQUIRE(lower_with_target(EntityTarget::from_target_type(EntityTarget::PlayerTarget { 1 })).is_serial_only());
+
+			REQUIRE(EntityThreadBytecode::lower(Stop { { EntityTarget::from_target_type(EntityTarget::PlayerTarget { 1 }) } }, 0).is_serial_only());
+			REQUIRE(EntityThreadBytecode::lower(Rewind { { EntityTarget::from_target_type(EntityTarget::PlayerTarget { 1 }) }, 1 }, 0).is_serial_only());
+		}
+
+		SECTION("Uncompiled threads lower on demand")
+		{
+			thread.instructions.emplace_back(NoOp {});
+
+			REQUIRE(!thread.has_bytecode());
+			REQUIRE(thread.get_bytecode_instruction(1).operand == 4);
+			REQUIRE(thread.get_bytecode_instruction(12).opcode == EntityThreadOpcode::NoOp);
+		}
+	}
+
+	TEST_CASE("engine::EntityThreadBytecode benchmarks", "[engine:entity][!benchmark]")
+	{
+		// Number of instructions executed per benchmark run.
+		constexpr std::size_t instructions_executed = 100000;
+
+		// Control-flow only; conditions are treated as unmet, and every other instruction is a no-op.
+		auto thread = EntityThreadDescription {};
+
+		for (std::size_t i = 0; i < 1024; i++)
+		{
+			switch (i % 4)
+			{
+				case 0:
+					thread.instructions.emplace_back(make_if_block(1));
+
+					break;
+				case 1:
+					thread.instructions.emplace_back(Link {});
+
+					break;
+				case 2:
+					thread.instructions.emplace_back(CadenceControlBlock { EntityThreadCadence::Update });
+
+					break;
+				default:
+					thread.instructions.emplace_back(NoOp {});
+
+					break;
+			}
+		}
+
+		thread.compile();
+
+		const auto label_suffix = (std::to_string(instructions_executed) + " instructions");
+
+		BENCHMARK("EntityInstruction (std::visit) - " + label_suffix)
+		{
+			auto cadence = EntityThreadCadence::Default;
+			std::size_t links = 0;
+
+			EntityInstructionIndex index = 0;
+
+			for (std::size_t executed = 0; executed < instructions_executed; executed++)
+			{
+				const auto& instruction = thread.get_instruction(index);
+
+				EntityInstructionCount step_stride = 1;
+
+				util::visit
+				(
+					instruction.value,
+
+					[&step_stride](const IfControlBlock& control_block) { step_stride += control_block.execution_range.size; },
+					[&links](const Link&) { links++; },
+					[&cadence](const CadenceControlBlock& control_block) { cadence = control_block.cadence; },
+					[](const auto&) {}
+				);
+
+				index += step_stride;
+
+				if (index >= thread.size())
+				{
+					index = 0;
+				}
+			}
+
+			return (links + static_cast<std::size_t>(cadence));
+		};
+
+		BENCHMARK("EntityThreadBytecode (switch) - " + label_suffix)
+		{
+			auto cadence = EntityThreadCadence::Default;
+			std::size_t links = 0;
+
+			EntityInstructionIndex index = 0;
+
+			for (std::size_t executed = 0; executed < instructions_executed; executed++)
+			{
+				const auto& instruction = thread.bytecode[index];
+
+				switch (instruction.opcode)
+				{
+					case EntityThreadOpcode::BranchIfNot:
+						index = instruction.operand;
+
+						break;
+					case EntityThreadOpcode::Link:
+						links++;
+						index++;
+
+						break;
+					case EntityThreadOpcode::SetCadence:
+						cadence = instruction.cadence;
+						index++;
+
+						break;
+					default:
+						index++;
+
+						break;
+				}
+
+				if (index >= thread.size())
+				{
+					index = 0;
+				}
+			}
+
+			return (links + static_cast<std::size_t>(cadence));
+		};
+	}
+}
@@ -0,0 +1,115 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <engine/entity/entity_descriptor.hpp>
+#include <engine/entity/entity_thread_description.hpp>
+#include <engine/entity/entity_instruction.hpp>
+#include <engine/entity/entity_variables.hpp>
+
+#include <engine/meta/hash.hpp>
+#include <engine/meta/meta_variable_target.hpp>
+#include <engine/meta/meta_variable_evaluation_context.hpp>
+
+#include <cstdint>
+
+namespace engine
+{
+	TEST_CASE("engine::EntityDescriptor::compile_variables", "[engine:entity]")
+	{
+		using namespace engine::literals;
+		using namespace instructions;
+
+		auto descriptor = EntityDescriptor {};
+
+		auto& thread = descriptor.shared_storage.allocate<EntityThreadDescription>();
+
+		thread.instructions.emplace_back(VariableDeclaration { MetaVariableTarget { "thread::a"_hs, MetaVariableScope::Local } });
+		thread.instructions.emplace_back(VariableDeclaration { MetaVariableTarget { "shared"_hs, MetaVariableScope::Global } });
+		thread.instructions.emplace_back(VariableDeclaration { MetaVariableTarget { "thread::b"_hs, MetaVariableScope::Local } });
+		thread.instructions.emplace_back(EventCapture { MetaVariableTarget { "thread::b"_hs, MetaVariableScope::Local } });
+		thread.instructions.emplace_back(EventCapture { MetaVariableTarget { "unknown"_hs, MetaVariableScope::Local } });
+
+		REQUIRE(descriptor.compile_variables() == 4);
+
+		SECTION("Layouts")
+		{
+			REQUIRE(thread.local_variables.size() == 2);
+			REQUIRE(thread.local_variables[0] == "thread::a"_hs);
+			REQUIRE(thread.local_variables[1] == "thread::b"_hs);
+
+			REQUIRE(descriptor.global_variables.size() == 1);
+			REQUIRE(descriptor.global_variables[0] == "shared"_hs);
+		}
+
+		SECTION("Slots")
+		{
+			REQUIRE(std::get<VariableDeclaration>(thread.instructions[0].value).variable_details.slot == 0);
+			REQUIRE(std::get<VariableDeclaration>(thread.instructions[1].value).variable_details.slot == 0);
+			REQUIRE(std::get<VariableDeclaration>(thread.instructions[2].value).variable_details.slot == 1);
+			REQUIRE(std::get<EventCapture>(thread.instructions[3].value).variable_details.slot == 1);
+
+			// Undeclared variables are resolved by name.
+			REQUIRE(std::get<EventCapture>(thread.instructions[4].value).variable_details.slot == META_VARIABLE_SLOT_INVALID);
+		}
+	}
+
+	TEST_CASE("engine::EntityVariables", "[engine:entity]")
+	{
+		using namespace engine::literals;
+
+		auto variables = EntityVariables<2> { MetaVariableLayout { "a"_hs, "b"_hs } };
+
+		auto variable_context = MetaVariableEvaluationContext { &variables };
+
+		SECTION("Reserved slots are not declared")
+		{
+			REQUIRE(!variables.contains("a"_hs));
+			REQUIRE(!variables.contains("b"_hs));
+
+			REQUIRE(!variable_context.exists(MetaVariableScope::Local, "a"_hs));
+		}
+
+		SECTION("Assignment uses reserved slot")
+		{
+			auto variable = MetaVariableTarget { "b"_hs, MetaVariableScope::Local, 1 };
+
+			REQUIRE(!variable.get(variable_context));
+
+			auto value = MetaAny { std::int32_t { 10 } };
+
+			variable.set(value, variable_context);
+
+			REQUIRE(variables.get_index("b"_hs) == 1);
+			REQUIRE(!variables.contains("a"_hs));
+
+			auto result = variable.get(variable_context);
+
+			REQUIRE(result);
+			REQUIRE(result.try_cast<std::int32_t>());
+			REQUIRE((*result.try_cast<std::int32_t>()) == 10);
+		}
+
+		SECTION("Mismatched slot falls back to name")
+		{
+			auto variable = MetaVariableTarget { "a"_hs, MetaVariableScope::Local, 1 };
+
+			auto value = MetaAny { std::int32_t { 5 } };
+
+			variable.set(value, variable_context);
+
+			REQUIRE(variables.get_index("a"_hs) == 0);
+
+			auto result = variable.get(variable_context);
+
+			REQUIRE(result);
+			REQUIRE((*result.try_cast<std::int32_t>()) == 5);
+		}
+
+		SECTION("Unreserved variables are appended")
+		{
+			variables.set("c"_hs, MetaAny { std::int32_t { 3 } });
+
+			REQUIRE(variables.get_index("c"_hs) == 2);
+			REQUIRE(variables.has_slot("c"_hs, 2));
+		}
+	}
+}
@@ -0,0 +1,120 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "test_service.hpp"
+#include "meta/reflection_test.hpp"
+
+#include <engine/event_log.hpp>
+#include <engine/meta/reflect_all.hpp>
+
+#include <util/binary/memory_stream.hpp>
+
+#include <vector>
+#include <cstdint>
+
+namespace engine
+{
+	// Records each `ReflectionTest` event received by a service.
+	struct ReceivedEventLog
+	{
+		std::vector<ReflectionTest> events;
+
+		void on_event(const ReflectionTest& event_obj)
+		{
+			events.push_back(event_obj);
+		}
+	};
+
+	TEST_CASE("engine::EventLogRecorder", "[engine:service]")
+	{
+		reflect_all();
+		reflect<ReflectionTest>();
+
+		auto log_stream = util::MemoryStream { 4096, false };
+
+		{
+			auto service = TestService {};
+
+			auto recorder = EventLogRecorder { log_stream };
+
+			service.set_event_recorder(&recorder);
+
+			service.event<ReflectionTest>(1, 2, 3);
+			service.queue_event<ReflectionTest>(4, 5, 6);
+
+			service.update(16, 1.0f);
+
+			service.event<ReflectionTest>(7, 8, 9);
+
+			service.update(32, 1.0f);
+
+			service.set_event_recorder(nullptr);
+
+			recorder.finish();
+
+			REQUIRE(recorder.get_event_count() == 3);
+			REQUIRE(recorder.get_skipped_event_count() == 0);
+			REQUIRE(recorder.get_update_count() == 2);
+		}
+
+		auto received = ReceivedEventLog {};
+
+		auto service = TestService {};
+
+		service.register_event<ReflectionTest, &ReceivedEventLog::on_event>(received);
+
+		{
+			auto player = EventLogPlayer { service, log_stream };
+
+			REQUIRE(player.is_valid());
+			REQUIRE(service.is_event_replay_mode());
+
+			SECTION("Records are replayed in order, one update at a time")
+			{
+				REQUIRE(player.step());
+
+				// The queued event is handled during the replayed update.
+				REQUIRE(received.events == std::vector<ReflectionTest> { { 1, 2, 3 }, { 4, 5, 6 } });
+
+				REQUIRE(player.step());
+				REQUIRE(received.events.size() == 3);
+				REQUIRE(received.events.back() == ReflectionTest { 7, 8, 9 });
+
+				REQUIRE(!player.step());
+				REQUIRE(player.is_finished());
+			}
+
+			SECTION("The remainder of a log can be replayed at once")
+			{
+				REQUIRE(player.run() == 2);
+
+				REQUIRE(player.get_event_count() == 3);
+				REQUIRE(player.get_failed_event_count() == 0);
+				REQUIRE(received.events.size() == 3);
+			}
+		}
+
+		REQUIRE(!service.is_event_replay_mode());
+
+		service.unregister_event<ReflectionTest, &ReceivedEventLog::on_event>(received);
+	}
+
+	TEST_CASE("engine::EventLogPlayer", "[engine:service]")
+	{
+		reflect_all();
+
+		auto service = TestService {};
+
+		SECTION("Logs with an invalid header are rejected")
+		{
+			auto log_stream = util::MemoryStream { 64, false };
+
+			log_stream.write(std::uint32_t { 0 });
+
+			auto player = EventLogPlayer { service, log_stream };
+
+			REQUIRE(!player.is_valid());
+			REQUIRE(player.is_finished());
+			REQUIRE(player.run() == 0);
+		}
+	}
+}
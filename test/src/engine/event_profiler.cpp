@@ -0,0 +1,199 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "test_service.hpp"
+
+#include <engine/event_profiler.hpp>
+#include <engine/service_events.hpp>
+
+#include <engine/meta/reflect_all.hpp>
+
+#include <util/json.hpp>
+
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+namespace engine
+{
+	struct ProfiledEvent
+	{
+		std::int32_t value = 0;
+	};
+
+	struct UnprofiledEvent
+	{
+		std::int32_t value = 0;
+	};
+
+	struct ProfiledEventCounter
+	{
+		std::size_t calls = 0;
+
+		void on_event(const ProfiledEvent& event_obj)
+		{
+			calls++;
+		}
+	};
+
+	TEST_CASE("engine::EventProfiler", "[engine:service]")
+	{
+		auto profiler = EventProfiler {};
+
+		profiler.on_enqueue<ProfiledEvent>();
+		profiler.on_enqueue<ProfiledEvent>();
+
+		profiler.on_trigger<ProfiledEvent>(EventProfiler::Clock::now(), 3);
+
+		profiler.on_pass("test_pass", EventProfiler::Clock::now());
+
+		SECTION("Statistics are recorded per event type")
+		{
+			const auto* stats = profiler.get_stats<ProfiledEvent>();
+
+			REQUIRE(stats);
+			REQUIRE(stats->type_name == "ProfiledEvent");
+
+			REQUIRE(stats->enqueue_count == 2);
+			REQUIRE(stats->trigger_count == 1);
+			REQUIRE(stats->handler_count == 3);
+
+			REQUIRE(!profiler.get_stats<UnprofiledEvent>());
+
+			REQUIRE(profiler.get_event_stats().size() == 1);
+		}
+
+		SECTION("Triggers and passes are traced")
+		{
+			const auto& trace = profiler.get_trace();
+
+			REQUIRE(trace.size() == 2);
+
+			REQUIRE(trace[0].name == "ProfiledEvent");
+			REQUIRE(trace[0].category == "event");
+
+			REQUIRE(trace[1].name == "test_pass");
+			REQUIRE(trace[1].category == "pass");
+		}
+
+		SECTION("Trace entries beyond the configured capacity are discarded")
+		{
+			profiler.set_trace_capacity(1);
+
+			REQUIRE(profiler.get_trace().size() == 1);
+
+			profiler.on_trigger<ProfiledEvent>(EventProfiler::Clock::now(), 0);
+
+			REQUIRE(profiler.get_trace().size() == 1);
+			REQUIRE(profiler.get_stats<ProfiledEvent>()->trigger_count == 2);
+		}
+
+		SECTION("Reports follow the Chrome trace-event format")
+		{
+			const auto report = util::json::parse(profiler.to_chrome_trace());
+
+			REQUIRE(report.contains("traceEvents"));
+			REQUIRE(report.contains("displayTimeUnit"));
+
+			const auto& trace_events = report["traceEvents"];
+
+			REQUIRE(trace_events.size() == 2);
+
+			for (const auto& trace_event : trace_events)
+			{
+				for (const auto* key : { "name", "cat", "ph", "ts", "dur", "pid", "tid" })
+				{
+					REQUIRE(trace_event.contains(key));
+				}
+			}
+
+			const auto& event_summary = report["otherData"]["event_types"]["ProfiledEvent"];
+
+			REQUIRE(event_summary["enqueue_count"] == 2);
+			REQUIRE(event_summary["trigger_count"] == 1);
+			REQUIRE(event_summary["handler_count"] == 3);
+			REQUIRE(event_summary.contains("handler_time_us"));
+		}
+
+		SECTION("Resetting clears all statistics")
+		{
+			profiler.reset();
+
+			REQUIRE(profiler.get_event_stats().empty());
+			REQUIRE(profiler.get_trace().empty());
+			REQUIRE(profiler.get_pass_time("test_pass") == EventProfiler::Duration {});
+		}
+	}
+
+#if GLARE_ENGINE_EVENT_PROFILING
+	TEST_CASE("engine::Service::get_event_profiler", "[engine:service]")
+	{
+		reflect_all();
+
+		auto service = TestService {};
+
+		auto first_counter = ProfiledEventCounter {};
+		auto second_counter = ProfiledEventCounter {};
+
+		service.register_event<ProfiledEvent, &ProfiledEventCounter::on_event>(first_counter);
+		service.register_event<ProfiledEvent, &ProfiledEventCounter::on_event>(second_counter);
+
+		const auto& profiler = service.get_event_profiler();
+
+		service.event<ProfiledEvent>(1);
+		service.event<ProfiledEvent>(ProfiledEvent { 2 });
+
+		service.queue_event<ProfiledEvent>(3);
+		service.queue_event<ProfiledEvent>(ProfiledEvent { 4 });
+		service.queue_event<ProfiledEvent>(5);
+
+		service.update({}, 0.0f);
+
+		REQUIRE(first_counter.calls == 5);
+		REQUIRE(second_counter.calls == 5);
+
+		const auto* stats = profiler.get_stats<ProfiledEvent>();
+
+		REQUIRE(stats);
+
+		REQUIRE(stats->trigger_count == 2);
+		REQUIRE(stats->enqueue_count == 3);
+
+		// Only handlers invoked by immediate triggers are counted. (Queued events are attributed to passes)
+		REQUIRE(stats->handler_count == 4);
+
+		// Service-originated events are profiled as well.
+		REQUIRE(profiler.get_stats<OnServiceUpdate>());
+
+		const auto report = util::json::parse(profiler.to_chrome_trace());
+
+		const auto& event_types = report["otherData"]["event_types"];
+
+		REQUIRE(event_types.contains("ProfiledEvent"));
+		REQUIRE(event_types.contains("OnServiceUpdate"));
+
+		REQUIRE(event_types["ProfiledEvent"]["trigger_count"] == 2);
+		REQUIRE(event_types["ProfiledEvent"]["enqueue_count"] == 3);
+		REQUIRE(event_types["ProfiledEvent"]["handler_count"] == 4);
+
+		auto has_pass = [&report](const std::string& pass_name)
+		{
+			for (const auto& trace_event : report["traceEvents"])
+			{
+				if ((trace_event["cat"] == "pass") && (trace_event["name"] == pass_name))
+				{
+					return true;
+				}
+			}
+
+			return false;
+		};
+
+		REQUIRE(has_pass("standard_event_handler"));
+		REQUIRE(has_pass("forwarding_event_handler"));
+		REQUIRE(has_pass("service_event_handler"));
+
+		service.unregister(first_counter);
+		service.unregister(second_counter);
+	}
+#endif
+}
@@ -0,0 +1,157 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <engine/meta/component_storage.hpp>
+#include <engine/meta/reflect_all.hpp>
+#include <engine/meta/hash.hpp>
+
+#include <engine/components/name_component.hpp>
+#include <engine/components/player_target_component.hpp>
+
+#include <engine/types.hpp>
+
+#include <string>
+#include <utility>
+
+namespace engine
+{
+	TEST_CASE("engine::ComponentStorage", "[engine:meta]")
+	{
+		reflect_all();
+
+		auto registry = Registry {};
+
+		const auto entity = registry.create();
+
+		const auto name_type_id = resolve<NameComponent>().id();
+		const auto player_target_type_id = resolve<PlayerTargetComponent>().id();
+
+		const auto* name_ops = ComponentStorageOps::get(name_type_id);
+		const auto* player_target_ops = ComponentStorageOps::get(player_target_type_id);
+
+		REQUIRE(name_ops);
+		REQUIRE(!name_ops->trivially_copyable);
+
+		REQUIRE(player_target_ops);
+		REQUIRE(player_target_ops->trivially_copyable);
+
+		registry.emplace<NameComponent>(entity, std::string { "a name long enough to require a heap allocation" });
+		registry.emplace<PlayerTargetComponent>(entity, PlayerIndex { 2 });
+
+		const auto description = MetaStorageDescription { name_type_id, player_target_type_id };
+
+		auto storage = ComponentStorage {};
+
+		SECTION("Store and retrieve")
+		{
+			REQUIRE(storage.store(registry, entity, description) == 2);
+
+			REQUIRE(!registry.all_of<NameComponent>(entity));
+			REQUIRE(!registry.all_of<PlayerTargetComponent>(entity));
+
+			for (const auto& stored_component : storage.components)
+			{
+				REQUIRE(stored_component.is_direct());
+			}
+
+			// Stored instances must survive being moved and copied.
+			auto storage_copy = storage;
+			auto moved_storage = std::move(storage);
+
+			REQUIRE(moved_storage.retrieve(registry, entity) == 2);
+			REQUIRE(moved_storage.empty());
+
+			REQUIRE(registry.get<NameComponent>(entity).get_name() == "a name long enough to require a heap allocation");
+			REQUIRE(registry.get<PlayerTargetComponent>(entity).player_index == 2);
+
+			registry.erase<NameComponent>(entity);
+
+			REQUIRE(storage_copy.retrieve(registry, entity) == 2);
+			REQUIRE(registry.get<NameComponent>(entity).get_name() == "a name long enough to require a heap allocation");
+		}
+
+		SECTION("Store as copy")
+		{
+			REQUIRE(storage.store(registry, entity, description, true) == 2);
+
+			REQUIRE(registry.all_of<NameComponent, PlayerTargetComponent>(entity));
+
+			registry.get<PlayerTargetComponent>(entity).player_index = 3;
+
+			REQUIRE(storage.retrieve(registry, entity) == 2);
+			REQUIRE(registry.get<PlayerTargetComponent>(entity).player_index == 2);
+		}
+
+		SECTION("Skip existing")
+		{
+			REQUIRE(storage.store(registry, entity, description, true) == 2);
+			REQUIRE(storage.store(registry, entity, description, true, true) == 0);
+			REQUIRE(storage.components.size() == 2);
+		}
+	}
+
+	TEST_CASE("engine::ComponentStorage benchmarks", "[engine:meta][!benchmark]")
+	{
+		using namespace engine::literals;
+
+		reflect_all();
+
+		auto registry = Registry {};
+
+		const auto entity = registry.create();
+
+		registry.emplace<NameComponent>(entity, std::string { "a name long enough to require a heap allocation" });
+		registry.emplace<PlayerTargetComponent>(entity, PlayerIndex { 1 });
+
+		const auto description = MetaStorageDescription
+		{
+			resolve<NameComponent>().id(),
+			resolve<PlayerTargetComponent>().id()
+		};
+
+		// Simulates an entity flipping between two states, each storing the other's components.
+		BENCHMARK("ComponentStorage (direct) state toggle")
+		{
+			auto storage = ComponentStorage {};
+
+			storage.store(registry, entity, description);
+
+			return storage.retrieve(registry, entity);
+		};
+
+		// Previous approach: reflected `store_meta_component` and `emplace_meta_component` calls, held as `MetaAny`.
+		BENCHMARK("MetaAny (reflected) state toggle")
+		{
+			auto stored_components = util::small_vector<MetaAny, 3> {};
+
+			for (const auto type_id : description)
+			{
+				auto component_type = resolve(type_id);
+
+				stored_components.emplace_back
+				(
+					component_type.func("store_meta_component"_hs).invoke
+					(
+						{},
+						entt::forward_as_meta(registry),
+						entt::forward_as_meta(entity)
+					)
+				);
+			}
+
+			std::size_t count = 0;
+
+			for (auto& instance : stored_components)
+			{
+				auto restore_fn = instance.type().func("emplace_meta_component"_hs);
+
+				if (restore_fn.invoke({}, entt::forward_as_meta(registry), entt::forward_as_meta(entity), entt::forward_as_meta(std::move(instance))))
+				{
+					count++;
+				}
+			}
+
+			return count;
+		};
+	}
+}
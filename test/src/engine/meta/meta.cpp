@@ -9,6 +9,7 @@
 #include <engine/meta/serial.hpp>
 #include <engine/meta/meta_value_operation.hpp>
 #include <engine/meta/meta_value_operator.hpp>
+#include <engine/meta/meta_function_call.hpp>
 #include <engine/meta/meta_variable_context.hpp>
 #include <engine/meta/meta_variable_evaluation_context.hpp>
 #include <engine/meta/meta_evaluation_context.hpp>
@@ -226,6 +227,63 @@ TEST_CASE("engine::meta_any_from_string", "[engine:meta]")
 		REQUIRE((*string_function_result_raw) == "string");
 	}
 
+	SECTION("Function call cache")
+	{
+		using namespace engine::literals;
+
+		auto function_call = engine::MetaFunctionCall
+		{
+			engine::resolve<engine::ReflectionTest>().id(),
+			"overloaded_function"_hs
+		};
+
+		function_call.arguments.emplace_back(std::int32_t { 10 });
+
+		auto first_result = function_call.get();
+
+		REQUIRE(first_result);
+		REQUIRE(first_result.try_cast<std::string>());
+		REQUIRE((*first_result.try_cast<std::string>()) == "integer");
+
+		REQUIRE(function_call.get_cache_hits() == 0);
+		REQUIRE(function_call.get_cache_misses() == 1);
+
+		auto second_result = function_call.get();
+
+		REQUIRE(second_result);
+		REQUIRE(second_result.try_cast<std::string>());
+		REQUIRE((*second_result.try_cast<std::string>()) == "integer");
+
+		REQUIRE(function_call.get_cache_hits() == 1);
+		REQUIRE(function_call.get_cache_misses() == 1);
+
+		// Arguments of a different type resolve (and cache) a different overload.
+		function_call.arguments[0] = engine::MetaAny { std::string { "Test" } };
+
+		auto string_result = function_call.get();
+
+		REQUIRE(string_result);
+		REQUIRE(string_result.try_cast<std::string>());
+		REQUIRE((*string_result.try_cast<std::string>()) == "string");
+
+		REQUIRE(function_call.get_cache_misses() == 2);
+		REQUIRE(function_call.cache.size() == 2);
+
+		auto cached_string_result = function_call.get();
+
+		REQUIRE(cached_string_result);
+		REQUIRE((*cached_string_result.try_cast<std::string>()) == "string");
+
+		REQUIRE(function_call.get_cache_hits() == 2);
+
+		// Copies begin with an empty cache.
+		auto function_call_copy = function_call;
+
+		REQUIRE(function_call_copy.cache.empty());
+		REQUIRE(function_call_copy.get_cache_hits() == 0);
+		REQUIRE(function_call_copy.get_cache_misses() == 0);
+	}
+
 	SECTION("Subscript operator on variable")
 	{
 		engine::MetaVariableContext variable_declaration_context;
@@ -0,0 +1,120 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <engine/meta/meta_value_operation.hpp>
+#include <engine/meta/meta_value_operation_program.hpp>
+#include <engine/meta/reflect_all.hpp>
+
+#include <math/types.hpp>
+
+#include <string>
+#include <variant>
+#include <cstdint>
+
+namespace engine
+{
+	TEST_CASE("engine::MetaValueOperationProgram", "[engine:meta]")
+	{
+		reflect_all();
+
+		using Operator = MetaValueOperator;
+		using Program = MetaValueOperationProgram;
+
+		SECTION("Typed operations")
+		{
+			REQUIRE(std::get<float>(Program::apply_binary(Operator::Multiply, 2.0f, 4.0f)) == 8.0f);
+			REQUIRE(std::get<std::int32_t>(Program::apply_binary(Operator::Modulus, std::int32_t { 7 }, std::int32_t { 4 })) == 3);
+			REQUIRE(std::get<bool>(Program::apply_binary(Operator::LessThan, std::int32_t { 1 }, std::int32_t { 2 })));
+			REQUIRE(std::get<bool>(Program::apply_binary(Operator::BitwiseXOR, true, false)));
+
+			REQUIRE(std::get<math::Vector>(Program::apply_binary(Operator::Multiply, math::Vector { 1.0f, 2.0f, 3.0f }, 2.0f)) == math::Vector { 2.0f, 4.0f, 6.0f });
+			REQUIRE(std::get<math::Vector>(Program::apply_unary(Operator::UnaryMinus, math::Vector { 1.0f, 0.0f, 0.0f })) == math::Vector { -1.0f, 0.0f, 0.0f });
+
+			REQUIRE(std::get<std::int32_t>(Program::apply_unary(Operator::UnaryMinus, std::int32_t { 5 })) == -5);
+			REQUIRE(std::get<bool>(Program::apply_unary(Operator::LogicalNot, false)));
+		}
+
+		SECTION("Operand conversion")
+		{
+			// The right-hand operand is converted to the type of the left-hand operand.
+			REQUIRE(std::get<std::int32_t>(Program::apply_binary(Operator::Add, std::int32_t { 1 }, 2.5f)) == 3);
+			REQUIRE(std::get<float>(Program::apply_binary(Operator::Add, 2.5f, std::int32_t { 1 })) == 3.5f);
+
+			REQUIRE(std::get<float>(Program::convert(std::int32_t { 2 }, MetaValueRegisterType::Float)) == 2.0f);
+			REQUIRE(std::holds_alternative<std::monostate>(Program::convert(2.0f, MetaValueRegisterType::Vector)));
+		}
+
+		SECTION("Unsupported operations")
+		{
+			REQUIRE(std::holds_alternative<std::monostate>(Program::apply_binary(Operator::Divide, std::int32_t { 1 }, std::int32_t { 0 })));
+			REQUIRE(std::holds_alternative<std::monostate>(Program::apply_binary(Operator::Add, true, std::int32_t { 1 })));
+			REQUIRE(std::holds_alternative<std::monostate>(Program::apply_binary(Operator::Multiply, 2.0f, math::Vector {})));
+			REQUIRE(std::holds_alternative<std::monostate>(Program::apply_binary(Operator::LogicalAnd, true, true)));
+		}
+
+		SECTION("Constant folding")
+		{
+			auto operation = MetaValueOperation
+			{
+				{
+					{ MetaAny { 2.0f }, Operator::Multiply },
+					{ MetaAny { 3.0f }, Operator::Add },
+					{ MetaAny { 1.0f }, Operator::Add }
+				}
+			};
+
+			REQUIRE(operation.compile());
+			REQUIRE(operation.program.is_constant());
+
+			auto result = operation.get();
+
+			REQUIRE(result);
+			REQUIRE(result.cast<float>() == 7.0f);
+		}
+
+		SECTION("Nested operations")
+		{
+			auto nested = MetaValueOperation
+			{
+				{
+					{ MetaAny { std::int32_t { 3 } }, Operator::Multiply },
+					{ MetaAny { std::int32_t { 4 } }, Operator::Multiply }
+				}
+			};
+
+			auto operation = MetaValueOperation
+			{
+				{
+					{ MetaAny { std::int32_t { 2 } }, Operator::Add },
+					{ MetaAny { std::move(nested) }, Operator::Add }
+				}
+			};
+
+			REQUIRE(operation.compile());
+			REQUIRE(operation.get().cast<std::int32_t>() == 14);
+		}
+
+		SECTION("Untyped operations are not compiled")
+		{
+			auto operation = MetaValueOperation
+			{
+				{
+					{ MetaAny { std::string { "a" } }, Operator::Add },
+					{ MetaAny { std::string { "b" } }, Operator::Add }
+				}
+			};
+
+			REQUIRE(!operation.compile());
+			REQUIRE(!operation.is_compiled());
+
+			auto division_by_zero = MetaValueOperation
+			{
+				{
+					{ MetaAny { std::int32_t { 1 } }, Operator::Divide },
+					{ MetaAny { std::int32_t { 0 } }, Operator::Divide }
+				}
+			};
+
+			REQUIRE(!division_by_zero.compile());
+		}
+	}
+}
@@ -0,0 +1,72 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <engine/name_index.hpp>
+
+#include <engine/components/name_component.hpp>
+#include <engine/components/relationship_component.hpp>
+
+#include <engine/meta/hash.hpp>
+#include <engine/types.hpp>
+
+#include <string>
+
+namespace engine
+{
+	TEST_CASE("engine::NameIndex", "[engine:name_index]")
+	{
+		auto registry = Registry {};
+
+		// Entities named before the index exists should still be indexed.
+		const auto existing = registry.create();
+
+		registry.emplace<NameComponent>(existing, std::string { "existing" });
+
+		auto name_index = NameIndex { registry };
+
+		REQUIRE(NameIndex::get(registry) == &name_index);
+		REQUIRE(name_index.get_first(hash("existing")) == existing);
+
+		SECTION("Construct, update and destroy")
+		{
+			const auto entity = registry.create();
+
+			registry.emplace<NameComponent>(entity, std::string { "a" });
+
+			REQUIRE(name_index.get_first(hash("a")) == entity);
+
+			registry.replace<NameComponent>(entity, std::string { "b" });
+
+			REQUIRE(name_index.get_first(hash("a")) == null);
+			REQUIRE(name_index.get_first(hash("b")) == entity);
+
+			registry.destroy(entity);
+
+			REQUIRE(name_index.get_first(hash("b")) == null);
+		}
+
+		SECTION("Child lookup")
+		{
+			const auto parent = registry.create();
+			const auto child = registry.create();
+			const auto grandchild = registry.create();
+			const auto unrelated = registry.create();
+
+			RelationshipComponent::set_parent(registry, child, parent);
+			RelationshipComponent::set_parent(registry, grandchild, child);
+
+			registry.emplace<NameComponent>(child, std::string { "child" });
+			registry.emplace<NameComponent>(grandchild, std::string { "grandchild" });
+			registry.emplace<NameComponent>(unrelated, std::string { "grandchild" });
+
+			REQUIRE(name_index.find_child(registry, parent, hash("child"), false) == child);
+			REQUIRE(name_index.find_child(registry, parent, hash("grandchild"), false) == null);
+			REQUIRE(name_index.find_child(registry, parent, hash("grandchild"), true) == grandchild);
+			REQUIRE(name_index.find_child(registry, parent, hash("missing"), true) == null);
+
+			// Two matching descendants are ambiguous; callers are expected to enumerate the hierarchy instead.
+			RelationshipComponent::set_parent(registry, unrelated, child);
+
+			REQUIRE(!name_index.find_child(registry, parent, hash("grandchild"), true).has_value());
+		}
+	}
+}
@@ -0,0 +1,160 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "../test_service.hpp"
+
+#include <engine/resource_manager/resource_manager.hpp>
+#include <engine/resource_manager/entity_pool.hpp>
+
+#include <engine/entity/entity_system.hpp>
+#include <engine/entity/entity_listener.hpp>
+#include <engine/entity/entity_factory_context.hpp>
+#include <engine/entity/entity_construction_context.hpp>
+#include <engine/entity/archetype_cache.hpp>
+#include <engine/entity/components/state_component.hpp>
+#include <engine/entity/components/pooled_entity_component.hpp>
+
+#include <engine/components/name_component.hpp>
+
+#include <engine/input/events.hpp>
+
+#include <engine/meta/reflect_all.hpp>
+#include <engine/meta/hash.hpp>
+
+#include <util/io.hpp>
+
+#include <filesystem>
+#include <string>
+
+namespace engine
+{
+	TEST_CASE("engine::EntityPool", "[engine:resource_manager]")
+	{
+		reflect_all();
+
+		const auto previous_cache_directory = get_archetype_cache_directory();
+
+		set_archetype_cache_directory({});
+
+		const auto test_directory = (std::filesystem::temp_directory_path() / "glare_entity_pool_test");
+
+		std::filesystem::remove_all(test_directory);
+		std::filesystem::create_directories(test_directory);
+
+		// The default state listens for `OnInput`, allowing state-rule registration to be observed.
+		util::save_string
+		(
+			std::string { "{ \"pool\": { \"capacity\": 1 }, \"states\": { \"idle\": { \"triggers\": { \"OnInput\": { \"state\": \"idle\" } } } }, \"default_state\": \"idle\" }" },
+			(test_directory / "pooled.json")
+		);
+
+		auto service = TestService {};
+		auto entity_system = EntitySystem { service, service.get_systems(), true };
+
+		auto& registry = service.get_registry();
+		auto& resource_manager = service.get_resource_manager();
+
+		const auto factory_context = EntityFactoryContext
+		{
+			{
+				.instance_path      = (test_directory / "pooled.json"),
+				.instance_directory = test_directory
+			}
+		};
+
+		const auto entity_context = EntityConstructionContext
+		{
+			.registry         = registry,
+			.resource_manager = resource_manager,
+
+			.opt_service      = &service
+		};
+
+		auto acquire = [&resource_manager, &factory_context, &entity_context]()
+		{
+			return resource_manager.generate_entity(factory_context, entity_context);
+		};
+
+		auto release = [&resource_manager, &registry, &service](Entity entity)
+		{
+			return resource_manager.release_entity(registry, entity, &service);
+		};
+
+		auto is_listening = [&entity_system](Entity entity)
+		{
+			const auto* listener = entity_system.listen(resolve<OnInput>().id());
+
+			return ((listener) && (listener->contains(entity)));
+		};
+
+		const auto entity = acquire();
+
+		REQUIRE(entity != null);
+		REQUIRE(registry.all_of<StateComponent>(entity));
+		REQUIRE(service.get_by_name("pooled") == entity);
+		REQUIRE(is_listening(entity));
+
+		SECTION("Released instances are removed from the world until reused")
+		{
+			REQUIRE(release(entity));
+
+			REQUIRE(registry.valid(entity));
+			REQUIRE(registry.all_of<PooledEntityComponent>(entity));
+			REQUIRE(!registry.any_of<StateComponent, NameComponent>(entity));
+
+			REQUIRE(service.get_by_name("pooled") == null);
+			REQUIRE(!is_listening(entity));
+
+			const auto reused_entity = acquire();
+
+			REQUIRE(reused_entity == entity);
+
+			REQUIRE(!registry.all_of<PooledEntityComponent>(entity));
+			REQUIRE(registry.get<StateComponent>(entity).state_index == 0);
+			REQUIRE(registry.get<NameComponent>(entity).get_name() == "pooled");
+
+			REQUIRE(service.get_by_name("pooled") == entity);
+			REQUIRE(is_listening(entity));
+		}
+
+		SECTION("Instances beyond the capacity of a pool are destroyed")
+		{
+			const auto second_entity = acquire();
+
+			REQUIRE(second_entity != entity);
+
+			REQUIRE(release(entity));
+			REQUIRE(!release(second_entity));
+
+			REQUIRE(registry.valid(entity));
+			REQUIRE(!registry.valid(second_entity));
+
+			// Released instances are reused ahead of creating new instances.
+			REQUIRE(acquire() == entity);
+		}
+
+		SECTION("Clearing a pool destroys its inactive instances")
+		{
+			REQUIRE(release(entity));
+
+			auto* pools = try_get_entity_pools(registry);
+
+			REQUIRE(pools);
+			REQUIRE(pools->size() == 1);
+
+			auto& pool = pools->begin()->second;
+
+			REQUIRE(pool.size() == 1);
+
+			pool.clear(registry, &service);
+
+			REQUIRE(pool.empty());
+			REQUIRE(!registry.valid(entity));
+
+			REQUIRE(acquire() != entity);
+		}
+
+		set_archetype_cache_directory(previous_cache_directory);
+
+		std::filesystem::remove_all(test_directory);
+	}
+}
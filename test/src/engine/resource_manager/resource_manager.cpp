@@ -0,0 +1,360 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "../meta/reflection_test.hpp"
+
+#include <engine/resource_manager/resource_manager.hpp>
+#include <engine/resource_manager/entity_factory_data.hpp>
+
+#include <engine/entity/entity_factory_context.hpp>
+#include <engine/entity/archetype_cache.hpp>
+#include <engine/entity/entity_construction_context.hpp>
+#include <engine/entity/components/instance_component.hpp>
+
+#include <engine/components/name_component.hpp>
+#include <engine/components/relationship_component.hpp>
+
+#include <engine/meta/reflect_all.hpp>
+
+#include <util/io.hpp>
+
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <array>
+#include <utility>
+#include <chrono>
+
+namespace engine
+{
+	// Tracks the number of times each factory is built, optionally intercepting each build.
+	class FactoryCacheTestResourceManager : public ResourceManager
+	{
+		public:
+			using BuildCallback = std::function<void(const EntityFactoryContext&)>;
+
+			FactoryCacheTestResourceManager() :
+				ResourceManager(std::shared_ptr<graphics::Context> {})
+			{}
+
+			// Retrieves the number of times the factory for `filename` has been built.
+			std::size_t get_build_count(const std::string& filename) const
+			{
+				auto lock = std::scoped_lock { build_mutex };
+
+				if (auto it = build_counts.find(filename); it != build_counts.end())
+				{
+					return it->second;
+				}
+
+				return 0;
+			}
+
+			// Called prior to building each factory; may block or throw.
+			BuildCallback on_build;
+
+		protected:
+			std::shared_ptr<EntityFactoryData> build_factory(const EntityFactoryContext& context) const override
+			{
+				{
+					auto lock = std::scoped_lock { build_mutex };
+
+					build_counts[context.paths.instance_path.filename().string()]++;
+				}
+
+				if (on_build)
+				{
+					on_build(context);
+				}
+
+				return ResourceManager::build_factory(context);
+			}
+
+			mutable std::mutex build_mutex;
+			mutable std::unordered_map<std::string, std::size_t> build_counts;
+	};
+
+	TEST_CASE("engine::ResourceManager::get_factory", "[engine:resource_manager]")
+	{
+		using namespace std::chrono_literals;
+
+		reflect_all();
+
+		// Cooked archetypes are not relevant here.
+		const auto previous_cache_directory = get_archetype_cache_directory();
+
+		set_archetype_cache_directory({});
+
+		const auto test_directory = (std::filesystem::temp_directory_path() / "glare_factory_cache_test");
+
+		std::filesystem::remove_all(test_directory);
+		std::filesystem::create_directories(test_directory);
+
+		util::save_string(std::string { "{ \"children\": [\"child.json\"] }" }, (test_directory / "parent_a.json"));
+		util::save_string(std::string { "{ \"children\": [\"child.json\"] }" }, (test_directory / "parent_b.json"));
+		util::save_string(std::string { "{}" }, (test_directory / "child.json"));
+
+		auto make_context = [&test_directory](const std::string& filename)
+		{
+			return EntityFactoryContext
+			{
+				{
+					.instance_path      = (test_directory / filename),
+					.instance_directory = test_directory
+				}
+			};
+		};
+
+		const auto context_a = make_context("parent_a.json");
+		const auto context_b = make_context("parent_b.json");
+
+		auto resource_manager = FactoryCacheTestResourceManager {};
+
+		// Blocks the first build of `parent_a.json` until `release_build` is fulfilled.
+		auto build_started = std::promise<void> {};
+		auto release_build = std::promise<void> {};
+
+		auto release_future = release_build.get_future().share();
+
+		bool block_first_build = true;
+		bool fail_first_build = false;
+
+		resource_manager.on_build = [&](const EntityFactoryContext& context)
+		{
+			if (context.paths.instance_path.filename() != "parent_a.json")
+			{
+				return;
+			}
+
+			if (!block_first_build)
+			{
+				return;
+			}
+
+			block_first_build = false;
+
+			build_started.set_value();
+			release_future.wait();
+
+			if (fail_first_build)
+			{
+				throw std::runtime_error("Failed to build factory.");
+			}
+		};
+
+		// Starts a request for `parent_a.json` on a worker thread, then starts a second, concurrent request.
+		auto start_concurrent_requests = [&]()
+		{
+			auto first_request = std::async(std::launch::async, [&]() { return resource_manager.get_factory(context_a); });
+
+			build_started.get_future().wait();
+
+			auto second_request = std::async(std::launch::async, [&]() { return resource_manager.get_factory(context_a); });
+
+			// The second request waits on the pending result, rather than building a duplicate.
+			const bool second_request_pending = (second_request.wait_for(100ms) == std::future_status::timeout);
+			const auto build_count = resource_manager.get_build_count("parent_a.json");
+
+			// NOTE: Released before checking results, so that a failure cannot leave the first request blocked.
+			release_build.set_value();
+
+			REQUIRE(second_request_pending);
+			REQUIRE(build_count == 1);
+
+			return std::pair { std::move(first_request), std::move(second_request) };
+		};
+
+		SECTION("Concurrent requests share a pending factory")
+		{
+			auto [first_request, second_request] = start_concurrent_requests();
+
+			const auto first_factory = first_request.get();
+			const auto second_factory = second_request.get();
+
+			REQUIRE(first_factory);
+			REQUIRE(first_factory == second_factory);
+			REQUIRE(resource_manager.get_build_count("parent_a.json") == 1);
+
+			// Completed factories are retrieved from the cache.
+			REQUIRE(resource_manager.get_factory(context_a) == first_factory);
+			REQUIRE(resource_manager.get_build_count("parent_a.json") == 1);
+		}
+
+		SECTION("Failures propagate to pending requests")
+		{
+			fail_first_build = true;
+
+			auto [first_request, second_request] = start_concurrent_requests();
+
+			REQUIRE_THROWS_AS(first_request.get(), std::runtime_error);
+			REQUIRE_THROWS_AS(second_request.get(), std::runtime_error);
+
+			// Failed factories are not cached; the next request builds the factory again.
+			const auto factory = resource_manager.get_factory(context_a);
+
+			REQUIRE(factory);
+			REQUIRE(resource_manager.get_build_count("parent_a.json") == 2);
+		}
+
+		SECTION("Shared child factories are built once")
+		{
+			block_first_build = false;
+
+			resource_manager.set_factory_worker_count(2);
+
+			// NOTE: Duplicate contexts are only requested once.
+			const auto factories = resource_manager.preload_factories({ context_a, context_b, context_a });
+
+			REQUIRE(factories.size() == 2);
+
+			REQUIRE(resource_manager.get_build_count("parent_a.json") == 1);
+			REQUIRE(resource_manager.get_build_count("parent_b.json") == 1);
+			REQUIRE(resource_manager.get_build_count("child.json") == 1);
+
+			REQUIRE(factories[0]->children.size() == 1);
+			REQUIRE(factories[1]->children.size() == 1);
+			REQUIRE(factories[0]->children[0] == factories[1]->children[0]);
+		}
+
+		set_archetype_cache_directory(previous_cache_directory);
+
+		std::filesystem::remove_all(test_directory);
+	}
+
+	// Records the order construction signals are received in.
+	struct ConstructionLog
+	{
+		std::vector<std::pair<MetaTypeID, Entity>> constructed;
+
+		void on_reflection_test(Registry& registry, Entity entity)
+		{
+			constructed.emplace_back(entt::type_hash<ReflectionTest>::value(), entity);
+		}
+
+		void on_name(Registry& registry, Entity entity)
+		{
+			constructed.emplace_back(entt::type_hash<NameComponent>::value(), entity);
+		}
+	};
+
+	TEST_CASE("engine::ResourceManager::generate_entities", "[engine:resource_manager]")
+	{
+		reflect_all();
+		reflect<ReflectionTest>();
+
+		const auto previous_cache_directory = get_archetype_cache_directory();
+
+		set_archetype_cache_directory({});
+
+		const auto test_directory = (std::filesystem::temp_directory_path() / "glare_create_batch_test");
+
+		std::filesystem::remove_all(test_directory);
+		std::filesystem::create_directories(test_directory);
+
+		util::save_string(std::string { "{ \"components\": { \"ReflectionTest\": { \"x\": 1, \"y\": 2, \"z\": 3 } } }" }, (test_directory / "batched.json"));
+
+		const auto factory_context = EntityFactoryContext
+		{
+			{
+				.instance_path      = (test_directory / "batched.json"),
+				.instance_directory = test_directory
+			}
+		};
+
+		auto resource_manager = ResourceManager { std::shared_ptr<graphics::Context> {} };
+
+		auto registry = Registry {};
+
+		const auto parent = registry.create();
+
+		const auto entity_context = EntityConstructionContext
+		{
+			.registry         = registry,
+			.resource_manager = resource_manager,
+
+			.parent           = parent
+		};
+
+		auto construction_log = ConstructionLog {};
+
+		registry.on_construct<ReflectionTest>().connect<&ConstructionLog::on_reflection_test>(construction_log);
+		registry.on_construct<NameComponent>().connect<&ConstructionLog::on_name>(construction_log);
+
+		constexpr std::size_t entity_count = 3;
+
+		auto individual_entities = std::array<Entity, entity_count> {};
+
+		for (auto& entity : individual_entities)
+		{
+			entity = resource_manager.generate_entity(factory_context, entity_context);
+		}
+
+		const auto individual_log = construction_log.constructed;
+
+		construction_log.constructed.clear();
+
+		auto batch_entities = std::array<Entity, entity_count> {};
+
+		REQUIRE(resource_manager.generate_entities(factory_context, entity_context, entity_count, batch_entities.data()) == entity_count);
+
+		const auto batch_log = construction_log.constructed;
+
+		SECTION("Batch creation matches repeated creation")
+		{
+			const auto& reference_entity = individual_entities[0];
+
+			const auto& reference_instance = registry.get<InstanceComponent>(reference_entity);
+
+			for (const auto entity : individual_entities)
+			{
+				REQUIRE(registry.get<InstanceComponent>(entity).instance == reference_instance.instance);
+			}
+
+			for (const auto entity : batch_entities)
+			{
+				REQUIRE(entity != null);
+
+				REQUIRE(registry.get<ReflectionTest>(entity) == registry.get<ReflectionTest>(reference_entity));
+				REQUIRE(registry.get<ReflectionTest>(entity) == ReflectionTest { 1, 2, 3 });
+
+				REQUIRE(registry.get<NameComponent>(entity).get_name() == registry.get<NameComponent>(reference_entity).get_name());
+				REQUIRE(registry.get<NameComponent>(entity).get_name() == "batched");
+
+				REQUIRE(registry.get<InstanceComponent>(entity).instance == reference_instance.instance);
+
+				REQUIRE(registry.get<RelationshipComponent>(entity).get_parent() == parent);
+			}
+		}
+
+		SECTION("Batch construction signals fire type by type")
+		{
+			REQUIRE(individual_log.size() == (entity_count * 2));
+			REQUIRE(batch_log.size() == (entity_count * 2));
+
+			// Individually created entities receive each of their components in turn.
+			for (std::size_t index = 0; index < entity_count; index++)
+			{
+				REQUIRE(individual_log[(index * 2)] == std::pair { MetaTypeID { entt::type_hash<ReflectionTest>::value() }, individual_entities[index] });
+				REQUIRE(individual_log[((index * 2) + 1)] == std::pair { MetaTypeID { entt::type_hash<NameComponent>::value() }, individual_entities[index] });
+			}
+
+			// Batched entities receive each component type in turn.
+			for (std::size_t index = 0; index < entity_count; index++)
+			{
+				REQUIRE(batch_log[index] == std::pair { MetaTypeID { entt::type_hash<ReflectionTest>::value() }, batch_entities[index] });
+				REQUIRE(batch_log[(entity_count + index)] == std::pair { MetaTypeID { entt::type_hash<NameComponent>::value() }, batch_entities[index] });
+			}
+		}
+
+		registry.on_construct<ReflectionTest>().disconnect(construction_log);
+		registry.on_construct<NameComponent>().disconnect(construction_log);
+
+		set_archetype_cache_directory(previous_cache_directory);
+
+		std::filesystem::remove_all(test_directory);
+	}
+}
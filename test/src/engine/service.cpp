@@ -0,0 +1,363 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "test_service.hpp"
+#include "meta/reflection_test.hpp"
+
+#include <engine/reflection/reflection.hpp>
+
+#include <engine/meta/reflect_all.hpp>
+#include <engine/meta/meta_type_descriptor.hpp>
+#include <engine/meta/meta_variable.hpp>
+#include <engine/meta/hash.hpp>
+
+#include <engine/commands/component_patch_command.hpp>
+#include <engine/commands/component_replace_command.hpp>
+#include <engine/commands/indirect_component_patch_command.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace engine
+{
+	TEST_CASE("engine::Service::later", "[engine:service]")
+	{
+		reflect_all();
+
+		auto shared_value = std::make_shared<std::string>("Captured by a deferred operation.");
+
+		auto weak_value = std::weak_ptr<std::string> { shared_value };
+
+		SECTION("Pending operations are destroyed alongside the service")
+		{
+			bool executed = false;
+
+			{
+				auto service = TestService {};
+
+				service.later
+				(
+					[value=std::move(shared_value), &executed]()
+					{
+						executed = true;
+					}
+				);
+
+				REQUIRE(!weak_value.expired());
+			}
+
+			REQUIRE(!executed);
+			REQUIRE(weak_value.expired());
+		}
+
+		SECTION("Handled operations are destroyed once executed")
+		{
+			auto service = TestService {};
+
+			std::string executed_with;
+
+			service.later
+			(
+				[value=std::move(shared_value), &executed_with]()
+				{
+					executed_with = *value;
+				}
+			);
+
+			service.update({}, 0.0f);
+
+			REQUIRE(executed_with == "Captured by a deferred operation.");
+			REQUIRE(weak_value.expired());
+		}
+	}
+
+	// Records the order in which components of type `ReflectionTest` are patched.
+	struct ComponentUpdateLog
+	{
+		std::vector<Entity> updates;
+
+		void on_update(Registry& registry, Entity entity)
+		{
+			updates.push_back(entity);
+		}
+	};
+
+	TEST_CASE("engine::Service::stage_component_write", "[engine:service]")
+	{
+		using namespace engine::literals;
+
+		reflect_all();
+		reflect<ReflectionTest>();
+
+		auto service = TestService { ServicePolicy { .coalesce_component_patches = true } };
+
+		auto& registry = service.get_registry();
+
+		auto update_log = ComponentUpdateLog {};
+
+		registry.on_update<ReflectionTest>().connect<&ComponentUpdateLog::on_update>(update_log);
+
+		const auto entity = registry.create();
+
+		registry.emplace<ReflectionTest>(entity, 0, 0, 0);
+
+		auto patch = [&service](Entity target, ReflectionTest value, bool use_member_assignment=false)
+		{
+			service.event<ComponentPatchCommand>(null, target, MetaAny { std::move(value) }, use_member_assignment);
+		};
+
+		SECTION("Later writes supersede earlier writes")
+		{
+			patch(entity, { 1, 1, 1 });
+			patch(entity, { 2, 2, 2 });
+
+			service.event<ComponentReplaceCommand>(null, entity, MetaAny { ReflectionTest { 3, 3, 3 } });
+
+			patch(entity, { 4, 4, 4 });
+
+			// Writes are not visible until they are applied.
+			REQUIRE(registry.get<ReflectionTest>(entity) == ReflectionTest { 0, 0, 0 });
+
+			service.update({}, 0.0f);
+
+			REQUIRE(registry.get<ReflectionTest>(entity) == ReflectionTest { 4, 4, 4 });
+			REQUIRE(update_log.updates.size() == 1);
+		}
+
+		SECTION("Indirect patches act as a barrier")
+		{
+			auto changes = MetaTypeDescriptor { "ReflectionTest"_hs };
+
+			changes.set_variable(MetaVariable { "x"_hs, MetaAny { std::int32_t { 10 } } });
+
+			patch(entity, { 1, 2, 3 });
+
+			// The staged write is applied before the indirect patch, which only changes `x`.
+			service.event<IndirectComponentPatchCommand>(null, entity, &changes);
+
+			REQUIRE(registry.get<ReflectionTest>(entity) == ReflectionTest { 10, 2, 3 });
+
+			// Writes staged after the barrier are applied afterward.
+			patch(entity, { 4, 5, 6 });
+
+			REQUIRE(registry.get<ReflectionTest>(entity) == ReflectionTest { 10, 2, 3 });
+
+			service.update({}, 0.0f);
+
+			REQUIRE(registry.get<ReflectionTest>(entity) == ReflectionTest { 4, 5, 6 });
+		}
+
+		SECTION("Writes are applied in the order they were first staged")
+		{
+			const auto other_entity = registry.create();
+
+			registry.emplace<ReflectionTest>(other_entity, 0, 0, 0);
+
+			patch(other_entity, { 1, 1, 1 });
+			patch(entity, { 2, 2, 2 });
+			patch(other_entity, { 3, 3, 3 });
+
+			service.update({}, 0.0f);
+
+			REQUIRE(update_log.updates == std::vector<Entity> { other_entity, entity });
+
+			REQUIRE(registry.get<ReflectionTest>(other_entity) == ReflectionTest { 3, 3, 3 });
+			REQUIRE(registry.get<ReflectionTest>(entity) == ReflectionTest { 2, 2, 2 });
+		}
+
+		SECTION("Member-wise writes do not supersede full assignments")
+		{
+			patch(entity, { 1, 2, 3 });
+
+			// The full assignment is applied immediately, preserving its order relative to the member-wise write.
+			patch(entity, { 4, 5, 6 }, true);
+
+			REQUIRE(registry.get<ReflectionTest>(entity) == ReflectionTest { 1, 2, 3 });
+			REQUIRE(update_log.updates.size() == 1);
+
+			service.update({}, 0.0f);
+
+			REQUIRE(registry.get<ReflectionTest>(entity) == ReflectionTest { 4, 5, 6 });
+			REQUIRE(update_log.updates.size() == 2);
+		}
+
+		SECTION("Writes to destroyed entities are discarded")
+		{
+			patch(entity, { 1, 1, 1 });
+
+			registry.destroy(entity);
+
+			service.update({}, 0.0f);
+
+			REQUIRE(update_log.updates.empty());
+		}
+
+		registry.on_update<ReflectionTest>().disconnect(update_log);
+	}
+
+	// Requests the destruction of `entity` from within an event handler.
+	struct DestroyEntityRequest
+	{
+		Entity entity = null;
+	};
+
+	struct DestroyEntityHandler
+	{
+		Service& service;
+
+		bool destroyed_during_dispatch = false;
+
+		void on_request(const DestroyEntityRequest& request)
+		{
+			service.destroy_entity(request.entity);
+
+			destroyed_during_dispatch = (!service.get_registry().valid(request.entity));
+		}
+	};
+
+	TEST_CASE("engine::Service::destroy_entity", "[engine:service]")
+	{
+		reflect_all();
+
+		auto service = TestService {};
+
+		auto& registry = service.get_registry();
+
+		const auto entity = registry.create();
+
+		SECTION("Entities are destroyed immediately outside of event dispatch")
+		{
+			service.destroy_entity(entity);
+
+			REQUIRE(!registry.valid(entity));
+		}
+
+		SECTION("Destruction is deferred while an event is dispatched")
+		{
+			auto handler = DestroyEntityHandler { service };
+
+			service.register_event<DestroyEntityRequest, &DestroyEntityHandler::on_request>(handler);
+
+			service.event<DestroyEntityRequest>(entity);
+
+			REQUIRE(!handler.destroyed_during_dispatch);
+			REQUIRE(registry.valid(entity));
+
+			service.update({}, 0.0f);
+
+			REQUIRE(!registry.valid(entity));
+
+			service.unregister(handler);
+		}
+
+		SECTION("Children are destroyed alongside their parent")
+		{
+			const auto child = registry.create();
+
+			service.set_parent(child, entity);
+
+			service.destroy_entity(entity);
+
+			REQUIRE(!registry.valid(entity));
+			REQUIRE(!registry.valid(child));
+		}
+	}
+
+	// Reflected as an event type, registering an opaque dispatch entry.
+	struct OpaqueQueuedEvent
+	{
+		std::int32_t value = 0;
+	};
+
+	// Reflected as a standard type, without an opaque dispatch entry.
+	struct OpaqueUnregisteredEvent
+	{
+		std::int32_t value = 0;
+	};
+
+	template <>
+	void reflect<OpaqueQueuedEvent>()
+	{
+		engine_event_type<OpaqueQueuedEvent>()
+			.data<&OpaqueQueuedEvent::value>("value"_hs)
+		;
+	}
+
+	template <>
+	void reflect<OpaqueUnregisteredEvent>()
+	{
+		engine_meta_type<OpaqueUnregisteredEvent>()
+			.data<&OpaqueUnregisteredEvent::value>("value"_hs)
+		;
+	}
+
+	struct OpaqueEventLog
+	{
+		std::vector<std::int32_t> queued_values;
+		std::vector<std::int32_t> unregistered_values;
+
+		void on_queued_event(const OpaqueQueuedEvent& event_obj)
+		{
+			queued_values.push_back(event_obj.value);
+		}
+
+		void on_unregistered_event(const OpaqueUnregisteredEvent& event_obj)
+		{
+			unregistered_values.push_back(event_obj.value);
+		}
+	};
+
+	TEST_CASE("engine::Service::queue_event (opaque)", "[engine:service]")
+	{
+		reflect_all();
+		reflect<ReflectionTest>();
+		reflect<OpaqueQueuedEvent>();
+		reflect<OpaqueUnregisteredEvent>();
+
+		auto service = TestService {};
+
+		auto event_log = OpaqueEventLog {};
+
+		service.register_event<OpaqueQueuedEvent, &OpaqueEventLog::on_queued_event>(event_log);
+		service.register_event<OpaqueUnregisteredEvent, &OpaqueEventLog::on_unregistered_event>(event_log);
+
+		SECTION("Only event and command types have dispatch entries")
+		{
+			REQUIRE(Service::get_opaque_event_dispatch(resolve<OpaqueQueuedEvent>()));
+			REQUIRE(Service::get_opaque_event_dispatch(resolve<ComponentPatchCommand>()));
+
+			REQUIRE(!Service::get_opaque_event_dispatch(resolve<OpaqueUnregisteredEvent>()));
+			REQUIRE(!Service::get_opaque_event_dispatch(resolve<ReflectionTest>()));
+		}
+
+		SECTION("Registered types are queued through their dispatch entry")
+		{
+			service.queue_event(MetaAny { OpaqueQueuedEvent { 1 } });
+
+			service.queue_event(MetaAny { OpaqueQueuedEvent { 2 } });
+
+			// Queued alongside typed events of the same type, rather than triggered.
+			service.queue_event<OpaqueQueuedEvent>(3);
+
+			REQUIRE(event_log.queued_values.empty());
+
+			service.update({}, 0.0f);
+
+			REQUIRE(event_log.queued_values == std::vector<std::int32_t> { 1, 2, 3 });
+		}
+
+		SECTION("Unregistered types fall back to being triggered immediately")
+		{
+			service.queue_event(MetaAny { OpaqueUnregisteredEvent { 1 } });
+
+			REQUIRE(event_log.unregistered_values == std::vector<std::int32_t> { 1 });
+
+			service.update({}, 0.0f);
+
+			REQUIRE(event_log.unregistered_values == std::vector<std::int32_t> { 1 });
+		}
+
+		service.unregister(event_log);
+	}
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <engine/types.hpp>
+#include <engine/service.hpp>
+#include <engine/service_policy.hpp>
+#include <engine/system_manager_interface.hpp>
+
+#include <engine/resource_manager/resource_manager.hpp>
+
+#include <memory>
+
+namespace engine
+{
+	// Storage for `TestService`, initialized before the underlying `Service`.
+	struct TestServiceResources
+	{
+		Registry test_registry;
+		SystemManagerInterface test_systems;
+		ResourceManager test_resource_manager { std::shared_ptr<graphics::Context> {} };
+	};
+
+	// Minimal `Service` implementation for tests, without a graphics context or world.
+	class TestService : private TestServiceResources, public Service
+	{
+		public:
+			TestService(const ServicePolicy& policy={}) :
+				TestServiceResources(),
+				Service(test_registry, test_systems, policy)
+			{}
+
+			ResourceManager& get_resource_manager() override
+			{
+				return test_resource_manager;
+			}
+
+			const ResourceManager& get_resource_manager() const override
+			{
+				return test_resource_manager;
+			}
+
+			SystemManagerInterface& get_systems()
+			{
+				return test_systems;
+			}
+	};
+}
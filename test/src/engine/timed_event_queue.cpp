@@ -0,0 +1,187 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <engine/timed_event_queue.hpp>
+#include <engine/timed_event.hpp>
+#include <engine/timer.hpp>
+
+#include <util/small_vector.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace engine
+{
+	TEST_CASE("engine::TimedEventQueue", "[engine:timed_event_queue]")
+	{
+		using namespace std::chrono_literals;
+
+		SECTION("Deadline ordering")
+		{
+			auto queue = TimedEventQueue {};
+
+			queue.push(TimedEvent { Timer(30ms), MetaAny { std::int32_t { 3 } } });
+			queue.push(TimedEvent { Timer(10ms), MetaAny { std::int32_t { 1 } } });
+			queue.push(TimedEvent { Timer(20ms), MetaAny { std::int32_t { 2 } } });
+
+			REQUIRE(queue.size() == 3);
+
+			const auto start = TimedEventQueue::Clock::now();
+
+			auto released = std::vector<std::int32_t> {};
+
+			// Nothing should be due before any timer has had a chance to complete.
+			REQUIRE(queue.update(start - 1s, [&](MetaAny&& instance) { released.emplace_back(instance.cast<std::int32_t>()); }) == 0);
+			REQUIRE(released.empty());
+
+			REQUIRE(queue.update(start + 1s, [&](MetaAny&& instance) { released.emplace_back(instance.cast<std::int32_t>()); }) == 3);
+			REQUIRE(queue.empty());
+
+			REQUIRE(released == std::vector<std::int32_t> { 1, 2, 3 });
+		}
+
+		SECTION("FIFO for shared deadlines")
+		{
+			auto queue = TimedEventQueue {};
+
+			// Copies of an already-started timer share the same projected end-point.
+			const auto timer = Timer(50ms);
+
+			for (std::int32_t i = 0; i < 16; i++)
+			{
+				queue.push(TimedEvent { timer, MetaAny { i } });
+			}
+
+			auto released = std::vector<std::int32_t> {};
+
+			queue.update
+			(
+				*timer.get_projected_end_point(),
+
+				[&](MetaAny&& instance)
+				{
+					released.emplace_back(instance.cast<std::int32_t>());
+				}
+			);
+
+			REQUIRE(released.size() == 16);
+			REQUIRE(std::is_sorted(released.begin(), released.end()));
+		}
+
+		SECTION("Push during update")
+		{
+			auto queue = TimedEventQueue {};
+
+			queue.push(TimedEvent { Timer(0ms), MetaAny { std::int32_t { 1 } } });
+
+			const auto now = TimedEventQueue::Clock::now() + 1s;
+
+			auto released = std::size_t {};
+
+			queue.update
+			(
+				now,
+
+				[&](MetaAny&& instance)
+				{
+					released++;
+
+					// Newly pushed events must not be released by the active update.
+					queue.push(TimedEvent { Timer(0ms), std::move(instance) });
+				}
+			);
+
+			REQUIRE(released == 1);
+			REQUIRE(queue.size() == 1);
+		}
+	}
+
+	TEST_CASE("engine::TimedEventQueue benchmarks", "[engine:timed_event_queue][!benchmark]")
+	{
+		using namespace std::chrono_literals;
+
+		constexpr auto pending_event_counts = std::array<std::size_t, 2> { 10000, 100000 };
+
+		for (const auto pending_event_count : pending_event_counts)
+		{
+			const auto populate = [pending_event_count](auto&& push)
+			{
+				for (std::size_t i = 0; i < pending_event_count; i++)
+				{
+					// Spread deadlines over a range far enough in the future that nothing completes mid-benchmark.
+					push(TimedEvent { Timer(10min + std::chrono::milliseconds(i % 1000)), MetaAny { static_cast<std::int32_t>(i) } });
+				}
+			};
+
+			auto queue = TimedEventQueue {};
+
+			populate([&queue](TimedEvent&& timed_event) { queue.push(std::move(timed_event)); });
+
+			auto pending_timed_events = std::vector<TimedEvent> {};
+
+			pending_timed_events.reserve(pending_event_count);
+
+			populate([&pending_timed_events](TimedEvent&& timed_event) { pending_timed_events.emplace_back(std::move(timed_event)); });
+
+			const auto label_suffix = std::to_string(pending_event_count);
+
+			// Steady-state frame: no pending events are due.
+			BENCHMARK("TimedEventQueue::update (none due) - " + label_suffix)
+			{
+				return queue.update([](MetaAny&&) {});
+			};
+
+			// Previous approach: polling every pending event each frame.
+			BENCHMARK("Linear polling (none due) - " + label_suffix)
+			{
+				auto released = std::size_t {};
+
+				pending_timed_events.erase
+				(
+					std::remove_if
+					(
+						pending_timed_events.begin(),
+						pending_timed_events.end(),
+
+						[&released](TimedEvent& timed_event)
+						{
+							if (timed_event.completed())
+							{
+								released++;
+
+								return true;
+							}
+
+							return false;
+						}
+					),
+
+					pending_timed_events.end()
+				);
+
+				return released;
+			};
+
+			BENCHMARK_ADVANCED("TimedEventQueue push + release all - " + label_suffix)(Catch::Benchmark::Chronometer meter)
+			{
+				const auto release_point = TimedEventQueue::Clock::now() + 1h;
+
+				meter.measure
+				(
+					[&]
+					{
+						auto local_queue = TimedEventQueue {};
+
+						populate([&local_queue](TimedEvent&& timed_event) { local_queue.push(std::move(timed_event)); });
+
+						return local_queue.update(release_point, [](MetaAny&&) {});
+					}
+				);
+			};
+		}
+	}
+}
@@ -0,0 +1,126 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <util/fiber.hpp>
+#include <util/fiber_frame_pool.hpp>
+
+#include <vector>
+#include <cstddef>
+
+namespace
+{
+	util::fiber<int> count_to(int limit)
+	{
+		for (auto i = 0; i < limit; i++)
+		{
+			co_yield i;
+		}
+	}
+}
+
+TEST_CASE("util::fiber_frame_pool", "[util]")
+{
+	using pool = util::fiber_frame_pool;
+
+	SECTION("Size classes")
+	{
+		REQUIRE(pool::get_size_class(1) == 0);
+		REQUIRE(pool::get_size_class(64) == 0);
+		REQUIRE(pool::get_size_class(65) == 1);
+		REQUIRE(pool::get_size_class(4096) == (pool::SIZE_CLASS_COUNT - 1));
+		REQUIRE(pool::get_size_class(4097) == pool::NO_SIZE_CLASS);
+	}
+
+	SECTION("Released frames are reused")
+	{
+		auto* frame = pool::allocate(200);
+
+		pool::deallocate(frame, 200);
+
+		const auto stats_before = pool::get_statistics();
+
+		// Any size within the same class should receive the cached frame.
+		auto* reused_frame = pool::allocate(129);
+
+		const auto stats_after = pool::get_statistics();
+
+		REQUIRE(reused_frame == frame);
+		REQUIRE(stats_after.cache_hits == (stats_before.cache_hits + 1));
+		REQUIRE(stats_after.size_class_allocations[2] == (stats_before.size_class_allocations[2] + 1));
+
+		pool::deallocate(reused_frame, 129);
+	}
+
+	SECTION("Cache overflow")
+	{
+		auto frames = std::vector<void*> {};
+
+		for (std::size_t i = 0; i < (pool::THREAD_CACHE_LIMIT * 2); i++)
+		{
+			frames.push_back(pool::allocate(1000));
+		}
+
+		for (auto* frame : frames)
+		{
+			pool::deallocate(frame, 1000);
+		}
+
+		// Frames handed to the shared pool are still reused.
+		const auto stats_before = pool::get_statistics();
+
+		for (auto& frame : frames)
+		{
+			frame = pool::allocate(1000);
+		}
+
+		const auto stats_after = pool::get_statistics();
+
+		REQUIRE(stats_after.cache_hits == (stats_before.cache_hits + frames.size()));
+
+		for (auto* frame : frames)
+		{
+			pool::deallocate(frame, 1000);
+		}
+	}
+
+	SECTION("Oversized frames")
+	{
+		const auto stats_before = pool::get_statistics();
+
+		auto* frame = pool::allocate(8192);
+
+		pool::deallocate(frame, 8192);
+
+		const auto stats_after = pool::get_statistics();
+
+		REQUIRE(stats_after.oversized_allocations == (stats_before.oversized_allocations + 1));
+		REQUIRE(stats_after.largest_frame >= 8192);
+		REQUIRE(stats_after.live_frames() == stats_before.live_frames());
+	}
+
+	SECTION("Coroutine frames")
+	{
+		const auto stats_before = pool::get_statistics();
+
+		for (auto iteration = 0; iteration < 4; iteration++)
+		{
+			auto fiber = count_to(3);
+
+			auto total = 0;
+
+			while (auto value = fiber.try_get())
+			{
+				total += *value;
+			}
+
+			REQUIRE(total == 3);
+		}
+
+		const auto stats_after = pool::get_statistics();
+
+		REQUIRE(stats_after.allocations == (stats_before.allocations + 4));
+		REQUIRE(stats_after.live_frames() == stats_before.live_frames());
+
+		// Every frame after the first is served from the cache.
+		REQUIRE(stats_after.cache_hits >= (stats_before.cache_hits + 3));
+	}
+}
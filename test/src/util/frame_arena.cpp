@@ -0,0 +1,65 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <util/frame_arena.hpp>
+
+#include <cstdint>
+#include <cstddef>
+
+TEST_CASE("util::frame_arena", "[util]")
+{
+	auto arena = util::frame_arena { 256 };
+
+	SECTION("Alignment")
+	{
+		for (auto i = 0; i < 64; i++)
+		{
+			auto* byte_value = arena.construct<std::uint8_t>(static_cast<std::uint8_t>(i));
+			auto* double_value = arena.construct<double>(static_cast<double>(i));
+
+			REQUIRE(*byte_value == static_cast<std::uint8_t>(i));
+			REQUIRE(*double_value == static_cast<double>(i));
+
+			REQUIRE((reinterpret_cast<std::uintptr_t>(double_value) % alignof(double)) == 0);
+		}
+
+		auto* over_aligned = arena.allocate(32, 64);
+
+		REQUIRE((reinterpret_cast<std::uintptr_t>(over_aligned) % 64) == 0);
+	}
+
+	SECTION("Reuse after reset")
+	{
+		const auto fill = [&arena]()
+		{
+			for (auto i = 0; i < 128; i++)
+			{
+				arena.construct<std::int64_t>(i);
+			}
+
+			// Larger than the configured block size.
+			arena.allocate(1024);
+		};
+
+		fill();
+
+		const auto block_count = arena.block_count();
+		const auto capacity = arena.capacity();
+
+		REQUIRE(block_count > 1);
+
+		// Run several times to ensure that steady-state frames do not allocate additional blocks.
+		for (auto frame = 0; frame < 4; frame++)
+		{
+			arena.reset();
+
+			fill();
+
+			REQUIRE(arena.block_count() == block_count);
+			REQUIRE(arena.capacity() == capacity);
+		}
+
+		arena.release();
+
+		REQUIRE(arena.block_count() == 0);
+	}
+}
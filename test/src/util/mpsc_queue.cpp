@@ -0,0 +1,95 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <util/mpsc_queue.hpp>
+
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+TEST_CASE("util::mpsc_queue", "[util]")
+{
+	SECTION("Single producer ordering")
+	{
+		auto queue = util::mpsc_queue<std::int32_t> {};
+
+		REQUIRE(queue.empty());
+
+		// Run twice to ensure determinism.
+		for (auto i = 1; i <= 2; i++)
+		{
+			queue.push(1);
+			queue.push(2);
+			queue.emplace(3);
+
+			REQUIRE(!queue.empty());
+
+			auto values = std::vector<std::int32_t> {};
+
+			REQUIRE(queue.drain([&values](std::int32_t&& value) { values.emplace_back(value); }) == 3);
+
+			REQUIRE(queue.empty());
+			REQUIRE(values == std::vector<std::int32_t> { 1, 2, 3 });
+		}
+	}
+
+	SECTION("Multiple producers")
+	{
+		using T = std::int64_t;
+
+		constexpr auto producer_count = std::size_t { 4 };
+		constexpr auto values_per_producer = T { 10000 };
+
+		auto queue = util::mpsc_queue<T> {};
+
+		auto producers = std::vector<std::thread> {};
+
+		for (std::size_t producer_index = 0; producer_index < producer_count; producer_index++)
+		{
+			producers.emplace_back
+			(
+				[&queue, producer_index]()
+				{
+					for (T value = 0; value < values_per_producer; value++)
+					{
+						queue.push((static_cast<T>(producer_index) * values_per_producer) + value);
+					}
+				}
+			);
+		}
+
+		auto last_value_per_producer = std::vector<T>(producer_count, T { -1 });
+		auto ordered = true;
+		auto received = std::size_t {};
+
+		const auto consume = [&](T&& value)
+		{
+			const auto producer_index = static_cast<std::size_t>(value / values_per_producer);
+			const auto local_value = (value % values_per_producer);
+
+			// Values from the same producer must arrive in the order they were pushed.
+			if (local_value <= last_value_per_producer[producer_index])
+			{
+				ordered = false;
+			}
+
+			last_value_per_producer[producer_index] = local_value;
+
+			received++;
+		};
+
+		while (received < (producer_count * static_cast<std::size_t>(values_per_producer)))
+		{
+			queue.drain(consume);
+		}
+
+		for (auto& producer : producers)
+		{
+			producer.join();
+		}
+
+		REQUIRE(queue.drain(consume) == 0);
+		REQUIRE(received == (producer_count * static_cast<std::size_t>(values_per_producer)));
+		REQUIRE(ordered);
+	}
+}